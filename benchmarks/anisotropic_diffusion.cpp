@@ -0,0 +1,93 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark runs the pipeline of examples/anisotropic_diffusion.cpp on
+// synthetic frames. The diffusion iterates on a device only image, so only
+// the input and the output of a frame cross to the host.
+
+#include "include/common.hpp"
+
+// tunable parameters
+constexpr float k{15.0f};    // edge preserving parameter
+constexpr size_t iters{15};  // controls the blur
+
+// operator which implements the simplified anisotropic diffusion
+struct AniDiff {
+  template <typename T>
+  visioncpp::pixel::F32C3 operator()(T nbr) {
+    cl::sycl::float4 out(0, 0, 0, 0);
+    cl::sycl::float4 sum_w(0, 0, 0, 0);
+    cl::sycl::float4 p1(nbr.at(nbr.I_c, nbr.I_r)[0],
+                        nbr.at(nbr.I_c, nbr.I_r)[1],
+                        nbr.at(nbr.I_c, nbr.I_r)[2], 0);
+    for (int i = -1; i <= 1; i++) {
+      for (int j = -1; j <= 1; j++) {
+        cl::sycl::float4 p2(nbr.at(nbr.I_c + i, nbr.I_r + j)[0],
+                            nbr.at(nbr.I_c + i, nbr.I_r + j)[1],
+                            nbr.at(nbr.I_c + i, nbr.I_r + j)[2], 0);
+        cl::sycl::float4 w = cl::sycl::exp((-k) * cl::sycl::fabs(p1 - p2));
+        sum_w += w;
+        out += w * p2;
+      }
+    }
+    out = out / sum_w;
+    return visioncpp::pixel::F32C3(out.x(), out.y(), out.z());
+  }
+};
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void anisotropic_diffusion(benchmark::State &state) {
+  auto frame = common::synthetic_frame(COLS, ROWS, 3);
+  std::vector<unsigned char> output(COLS * ROWS * 3);
+
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+  auto out = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+  auto device_memory =
+      visioncpp::terminal<visioncpp::pixel::F32C3, COLS, ROWS,
+                          visioncpp::memory_type::Buffer2D>();
+
+  auto frgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in);
+  auto exec1 = visioncpp::assign(device_memory, frgb);
+  auto anidiff =
+      visioncpp::neighbour_operation<AniDiff, 1, 1, 1, 1>(device_memory);
+  auto exec2 = visioncpp::assign(device_memory, anidiff);
+  auto urgb =
+      visioncpp::point_operation<visioncpp::OP_F32C3ToU8C3>(device_memory);
+  auto exec3 = visioncpp::assign(out, urgb);
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() {
+      in.reset_input(frame.data());
+      visioncpp::execute<Policy, 32, 32, 16, 16>(exec1, common::get_device());
+      for (size_t i = 0; i < iters; i++) {
+        visioncpp::execute<Policy, 32, 32, 16, 16>(exec2,
+                                                   common::get_device());
+      }
+      visioncpp::execute<Policy, 32, 32, 16, 16>(exec3, common::get_device());
+      out.read_output(output.data());
+    });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(anisotropic_diffusion);
+
+BENCHMARK_MAIN();
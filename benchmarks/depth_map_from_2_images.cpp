@@ -0,0 +1,113 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark runs the pipeline of examples/depth_map_from_2_images.cpp on
+// a pair of synthetic frames: the depth map from the stereo block match.
+
+#include "include/common.hpp"
+
+#include <limits>
+
+// Tunable parameters for the algorithm
+constexpr int blockSize = 11;
+constexpr int maxDisp = 25;
+
+constexpr int halfBlock = blockSize / 2;
+
+// Stereo block matching algorithm for depth map reconstruction
+struct Stereo_BMA {
+  float SAD(const float im1[blockSize * blockSize],
+            const float im2[blockSize * blockSize]) {
+    float r = 0;
+    for (size_t i = 0; i < blockSize * blockSize; i++) {
+      r += cl::sycl::fabs(im1[i] - im2[i]);
+    }
+    return r;
+  }
+
+  template <typename T>
+  void getBlock(const T &I, const int &c, const int &r, const int &layer,
+                float block[blockSize * blockSize]) {
+    int cnt = 0;
+    for (int i2 = -halfBlock; i2 <= halfBlock; i2++) {
+      for (int j2 = -halfBlock; j2 <= halfBlock; j2++) {
+        block[cnt++] = I.at(c + i2, r + j2)[layer];
+      }
+    }
+  }
+
+  template <typename T>
+  visioncpp::pixel::U8C1 operator()(const T &I) {
+    float block_l[blockSize * blockSize];
+    getBlock(I, I.I_c, I.I_r, 0, block_l);
+    float bestSAD = std::numeric_limits<float>::infinity();
+    int bestJ = I.I_c;
+    float block_r[blockSize * blockSize];
+    for (int m = 0; m < maxDisp; m++) {
+      getBlock(I, I.I_c - m, I.I_r, 1, block_r);
+      float temp = SAD(block_l, block_r);
+      if (temp < bestSAD) {
+        bestSAD = temp;
+        bestJ = I.I_c - m;
+      }
+    }
+    return visioncpp::pixel::U8C1(I.I_c - bestJ);
+  }
+};
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void depth_map_from_2_images(benchmark::State &state) {
+  constexpr size_t SM = 16;
+  auto left = common::synthetic_frame(COLS, ROWS, 1, 1);
+  auto right = common::synthetic_frame(COLS, ROWS, 1, 2);
+  std::vector<unsigned char> output(COLS * ROWS);
+
+  auto in_l = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                  visioncpp::memory_type::Buffer2D>();
+  auto in_r = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                  visioncpp::memory_type::Buffer2D>();
+  auto out = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+
+  auto fgrey_l = visioncpp::point_operation<visioncpp::OP_U8C1ToFloat>(in_l);
+  auto fgrey_r = visioncpp::point_operation<visioncpp::OP_U8C1ToFloat>(in_r);
+  auto merge =
+      visioncpp::point_operation<visioncpp::OP_Merge2Chns>(fgrey_l, fgrey_r);
+  auto depth = visioncpp::neighbour_operation<
+      Stereo_BMA, halfBlock, halfBlock + maxDisp, halfBlock, halfBlock>(merge);
+  auto scale_node = visioncpp::terminal<float, visioncpp::memory_type::Const>(
+      static_cast<float>(8.0f));
+  auto display =
+      visioncpp::point_operation<visioncpp::OP_Scale>(depth, scale_node);
+
+  auto pipe = visioncpp::make_pipeline<Policy, SM, SM, SM, SM>(
+      visioncpp::assign(out, display), common::get_device(),
+      visioncpp::inputs(in_l, in_r), visioncpp::outputs(out));
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() {
+      pipe.run(left.data(), right.data(), output.data());
+    });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(depth_map_from_2_images);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark runs the pipeline of examples/edge_detector.cpp on synthetic
+// frames: a mean filter followed by the magnitude of the Sobel derivatives.
+
+#include "include/common.hpp"
+
+struct OP_Magnitude {
+  template <typename T1, typename T2>
+  float operator()(const T1& t1, const T2& t2) {
+    return cl::sycl::clamp(cl::sycl::sqrt(t1 * t1 + t2 * t2), 0.0f, 1.0f);
+  }
+};
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void edge_detector(benchmark::State& state) {
+  auto frame = common::synthetic_frame(COLS, ROWS, 3);
+  std::vector<unsigned char> output(COLS * ROWS);
+
+  float sobel_x[9] = {-1.0f, 0.0f, 1.0f, -2.0f, 0.0f, 2.0f, -1.0f, 0.0f, 1.0f};
+  float sobel_y[9] = {-1.0f, -2.0f, -1.0f, 0.0, 0.0f, 0.0f, 1.0f, 2.0f, 1.0f};
+
+  constexpr size_t filter_size = 3;
+  constexpr size_t N = filter_size * filter_size;
+
+  float mean_array[N];
+  for (size_t i = 0; i < N; i++) {
+    mean_array[i] = 1.0f / static_cast<float>(N);
+  }
+
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+  auto out = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+
+  auto frgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in);
+  auto fgrey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(frgb);
+
+  auto mean_filter =
+      visioncpp::terminal<float, filter_size, filter_size,
+                          visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(mean_array);
+  auto mean = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+      fgrey, mean_filter);
+
+  auto x_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sobel_x);
+  auto sobel_x_op = visioncpp::neighbour_operation<
+      visioncpp::OP_Filter2D_One>(mean, x_filter);
+
+  auto y_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sobel_y);
+  auto sobel_y_op = visioncpp::neighbour_operation<
+      visioncpp::OP_Filter2D_One>(mean, y_filter);
+
+  auto intensity =
+      visioncpp::point_operation<OP_Magnitude>(sobel_x_op, sobel_y_op);
+  auto uintensity =
+      visioncpp::point_operation<visioncpp::OP_FloatToU8C1>(intensity);
+
+  auto pipe = visioncpp::make_pipeline<Policy, 8, 8, 8, 8>(
+      visioncpp::assign(out, uintensity), common::get_device(),
+      visioncpp::inputs(in), visioncpp::outputs(out));
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() { pipe.run(frame.data(), output.data()); });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(edge_detector);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,51 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark runs the pipeline of examples/greyscale.cpp on synthetic
+// frames. Each frame is uploaded, converted to greyscale and downloaded.
+
+#include "include/common.hpp"
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void greyscale(benchmark::State &state) {
+  auto frame = common::synthetic_frame(COLS, ROWS, 3);
+  std::vector<unsigned char> output(COLS * ROWS);
+
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+  auto out = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+
+  auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(in);
+  auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+  auto node3 = visioncpp::point_operation<visioncpp::OP_GREYToCVBGR>(node2);
+
+  auto pipe = visioncpp::make_pipeline<Policy, 8, 8, 8, 8>(
+      visioncpp::assign(out, node3), common::get_device(),
+      visioncpp::inputs(in), visioncpp::outputs(out));
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() { pipe.run(frame.data(), output.data()); });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(greyscale);
+
+BENCHMARK_MAIN();
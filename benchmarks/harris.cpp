@@ -0,0 +1,186 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark runs the pipeline of examples/harris.cpp on synthetic frames:
+// the Harris corner response followed by a non-maximal suppression and a
+// threshold.
+
+#include "include/common.hpp"
+
+constexpr float k_param = 0.04f;   // k parameter (usually 0.02 - 0.04)
+constexpr float threshold = 0.5f;  // threhold parameter
+constexpr int windowSize = 7;      // window size for non-maximal suppresion
+constexpr int halfWindowSize = windowSize / 2;  // half window size
+
+struct PowerOf2 {
+  template <typename T>
+  const float operator()(const T &t) {
+    return t * t;
+  }
+};
+
+struct Mul {
+  template <typename T1, typename T2>
+  float operator()(const T1 &t1, const T2 &t2) {
+    return t1 * t2;
+  }
+};
+
+struct Add {
+  template <typename T1, typename T2>
+  float operator()(const T1 &t1, const T2 &t2) {
+    return t1 + t2;
+  }
+};
+
+struct Sub {
+  template <typename T1, typename T2>
+  float operator()(const T1 &t1, const T2 &t2) {
+    return t1 - t2;
+  }
+};
+
+struct Filter2D {
+  template <typename T1, typename T2>
+  float operator()(const T1 &nbr, const T2 &fltr) {
+    int hs_c = (fltr.cols / 2);
+    int hs_r = (fltr.rows / 2);
+
+    float out = 0;
+    for (int i2 = -hs_c, i = 0; i2 <= hs_c; i2++, i++)
+      for (int j2 = -hs_r, j = 0; j2 <= hs_r; j2++, j++)
+        out += (nbr.at(nbr.I_c + i2, nbr.I_r + j2) * fltr.at(i, j));
+    return out;
+  }
+};
+
+struct Thresh {
+  template <typename T, typename Thresh>
+  float operator()(const T &t, const Thresh &thresh) {
+    return t > thresh ? 1.0f : 0.0f;
+  }
+};
+
+struct NonMaximalSuppresion {
+  template <typename T>
+  float operator()(const T &im) {
+    float currentPixel{im.at(im.I_c, im.I_r)};
+    for (int i = -halfWindowSize; i <= halfWindowSize; i++) {
+      for (int j = -halfWindowSize; j <= halfWindowSize; j++) {
+        if (currentPixel < im.at(im.I_c + i, im.I_r + j)) {
+          return 0.0f;
+        }
+      }
+    }
+    return currentPixel;
+  }
+};
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void harris(benchmark::State &state) {
+  constexpr size_t SM = 16;
+  auto frame = common::synthetic_frame(COLS, ROWS, 3);
+  std::vector<unsigned char> output(COLS * ROWS);
+
+  float sobel_x[9] = {-1.0f, 0.0f, 1.0f, -2.0f, 0.0f, 2.0f, -1.0f, 0.0f, 1.0f};
+  float sobel_y[9] = {-1.0f, -2.0f, -1.0f, 0.0, 0.0f, 0.0f, 1.0f, 2.0f, 1.0f};
+  float sum_mask[9] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+  auto out = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+
+  auto frgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in);
+  auto fgrey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(frgb);
+
+  auto px_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sobel_x);
+  auto px = visioncpp::neighbour_operation<Filter2D>(fgrey, px_filter);
+
+  auto py_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sobel_y);
+  auto py = visioncpp::neighbour_operation<Filter2D>(fgrey, py_filter);
+
+  auto px2 = visioncpp::point_operation<PowerOf2>(px);
+  auto py2 = visioncpp::point_operation<PowerOf2>(py);
+  auto pxy = visioncpp::point_operation<Mul>(px, py);
+
+  auto kpx2 = visioncpp::schedule<Policy, SM, SM, SM, SM>(px2);
+  auto kpy2 = visioncpp::schedule<Policy, SM, SM, SM, SM>(py2);
+  auto kpxy = visioncpp::schedule<Policy, SM, SM, SM, SM>(pxy);
+
+  auto sum_mask_node =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sum_mask);
+
+  auto sumpx2 = visioncpp::neighbour_operation<Filter2D>(kpx2, sum_mask_node);
+  auto sumpy2 = visioncpp::neighbour_operation<Filter2D>(kpy2, sum_mask_node);
+  auto sumpxy = visioncpp::neighbour_operation<Filter2D>(kpxy, sum_mask_node);
+
+  auto ksumpx2 = visioncpp::schedule<Policy, SM, SM, SM, SM>(sumpx2);
+  auto ksumpy2 = visioncpp::schedule<Policy, SM, SM, SM, SM>(sumpy2);
+  auto ksumpxy = visioncpp::schedule<Policy, SM, SM, SM, SM>(sumpxy);
+
+  auto mul1 = visioncpp::point_operation<Mul>(ksumpx2, ksumpy2);
+  auto mul2 = visioncpp::point_operation<PowerOf2>(ksumpxy);
+  auto det = visioncpp::point_operation<Sub>(mul1, mul2);
+
+  auto trace = visioncpp::point_operation<Add>(ksumpx2, ksumpy2);
+  auto trace2 = visioncpp::point_operation<PowerOf2>(trace);
+
+  auto k_node =
+      visioncpp::terminal<float, visioncpp::memory_type::Const>(k_param);
+  auto ktrace2 = visioncpp::point_operation<Mul>(trace2, k_node);
+
+  auto harris = visioncpp::point_operation<Sub>(det, ktrace2);
+  auto kharris = visioncpp::schedule<Policy, SM, SM, SM, SM>(harris);
+
+  auto harris_non_maximum =
+      visioncpp::neighbour_operation<NonMaximalSuppresion, halfWindowSize,
+                                     halfWindowSize, halfWindowSize,
+                                     halfWindowSize>(kharris);
+  auto kharris_non_maximum =
+      visioncpp::schedule<Policy, SM, SM, SM, SM>(harris_non_maximum);
+
+  auto thresh_node = visioncpp::terminal<float, visioncpp::memory_type::Const>(
+      static_cast<float>(threshold));
+  auto harrisTresh =
+      visioncpp::point_operation<Thresh>(kharris_non_maximum, thresh_node);
+
+  auto scale_node = visioncpp::terminal<float, visioncpp::memory_type::Const>(
+      static_cast<float>(255.0f));
+  auto display =
+      visioncpp::point_operation<visioncpp::OP_Scale>(harrisTresh, scale_node);
+
+  auto pipe = visioncpp::make_pipeline<Policy, SM, SM, SM, SM>(
+      visioncpp::assign(out, display), common::get_device(),
+      visioncpp::inputs(in), visioncpp::outputs(out));
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() { pipe.run(frame.data(), output.data()); });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(harris);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef VISIONCPP_BENCHMARKS_INCLUDE_COMMON_HPP_
+#define VISIONCPP_BENCHMARKS_INCLUDE_COMMON_HPP_
+
+#include <benchmark/benchmark.h>
+#include <visioncpp.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// the backend and the device executing the benchmarks. They can be changed
+// when configuring the build, e.g. -DVISIONCPP_BENCHMARK_DEVICE=gpu
+#ifndef VISIONCPP_BENCHMARK_BACKEND
+#define VISIONCPP_BENCHMARK_BACKEND sycl
+#endif
+#ifndef VISIONCPP_BENCHMARK_DEVICE
+#define VISIONCPP_BENCHMARK_DEVICE cpu
+#endif
+
+// registers a pipeline benchmark for each resolution and execution policy.
+// The benchmark is a function template taking the policy, the column and the
+// row size of the frames.
+#define VISIONCPP_BENCHMARK_POLICY(fn, policy)                       \
+  BENCHMARK_TEMPLATE(fn, policy, 640, 480)                           \
+      ->UseManualTime()                                              \
+      ->Unit(benchmark::kMillisecond);                               \
+  BENCHMARK_TEMPLATE(fn, policy, 1280, 720)                          \
+      ->UseManualTime()                                              \
+      ->Unit(benchmark::kMillisecond);                               \
+  BENCHMARK_TEMPLATE(fn, policy, 1920, 1080)                         \
+      ->UseManualTime()                                              \
+      ->Unit(benchmark::kMillisecond)
+#define VISIONCPP_BENCHMARK(fn)                                      \
+  VISIONCPP_BENCHMARK_POLICY(fn, visioncpp::policy::Fuse);           \
+  VISIONCPP_BENCHMARK_POLICY(fn, visioncpp::policy::NoFuse)
+
+namespace common {
+// the device shared by all the benchmarks of an executable, so the queue and
+// the buffer pool are created once
+inline const visioncpp::internal::Device_<
+    visioncpp::backend::VISIONCPP_BENCHMARK_BACKEND,
+    visioncpp::device::VISIONCPP_BENCHMARK_DEVICE> &
+get_device() {
+  static const auto dev =
+      visioncpp::make_device<visioncpp::backend::VISIONCPP_BENCHMARK_BACKEND,
+                             visioncpp::device::VISIONCPP_BENCHMARK_DEVICE>();
+  return dev;
+}
+
+// creates a synthetic frame of cols x rows pixels with the given number of
+// channels. It is a gradient with noise, so the filters and the flow see some
+// structure, and a different seed gives a slightly moved frame.
+inline std::vector<unsigned char> synthetic_frame(size_t cols, size_t rows,
+                                                  size_t channels,
+                                                  unsigned seed = 1) {
+  std::vector<unsigned char> frame(cols * rows * channels);
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> noise(0, 31);
+  for (size_t r = 0; r < rows; r++) {
+    for (size_t c = 0; c < cols; c++) {
+      for (size_t ch = 0; ch < channels; ch++) {
+        frame[(r * cols + c) * channels + ch] = static_cast<unsigned char>(
+            ((c + seed) * 255 / cols + r * 255 / rows) / 2 + noise(gen));
+      }
+    }
+  }
+  return frame;
+}
+
+// measures the latency of each frame. The time of the frame is given to the
+// benchmark as the iteration time, and the throughput and the latency
+// percentiles are reported as counters.
+class FrameTimer {
+  std::vector<double> latencies;
+
+  double percentile(double p) const {
+    const size_t i = static_cast<size_t>(p * (latencies.size() - 1) + 0.5);
+    return latencies[i];
+  }
+
+ public:
+  // runs the frame and records its latency
+  template <typename Frame>
+  void frame(benchmark::State &state, Frame run) {
+    auto begin = visioncpp::internal::tools::get_current_time();
+    run();
+    const double time = visioncpp::internal::tools::get_elapse_time(
+        begin, visioncpp::internal::tools::get_current_time());
+    state.SetIterationTime(time);
+    latencies.push_back(time);
+  }
+
+  // reports the megapixels processed per second (MPixels) and the 50th, 90th
+  // and 99th percentiles of the frame latency in milliseconds
+  void report(benchmark::State &state, size_t pixels) {
+    state.counters["MPixels"] = benchmark::Counter(
+        pixels * 1e-6, benchmark::Counter::kIsIterationInvariantRate);
+    if (latencies.empty()) {
+      return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p50_ms"] = percentile(0.50) * 1e3;
+    state.counters["p90_ms"] = percentile(0.90) * 1e3;
+    state.counters["p99_ms"] = percentile(0.99) * 1e3;
+  }
+};
+}  // namespace common
+
+#endif  // VISIONCPP_BENCHMARKS_INCLUDE_COMMON_HPP_
@@ -0,0 +1,166 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark runs the pipeline of examples/optical_flow_LK.cpp on two
+// synthetic frames: the Lucas-Kanade optical flow displayed in HSV.
+
+#include "include/common.hpp"
+
+#include <cmath>
+
+struct OP_UVtoPolar {
+  visioncpp::pixel::F32C3 operator()(visioncpp::pixel::F32C2 t) {
+    float intensity = cl::sycl::clamp(
+        cl::sycl::sqrt(t[0] * t[0] + t[1] * t[1]) / 2.0f, 0.0f, 1.0f);
+    float angle = cl::sycl::atan2(t[1], t[0]) / (2.0f * M_PI);
+    float chn = 1.0f;
+    return visioncpp::pixel::F32C3(angle, chn, intensity);
+  }
+};
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void optical_flow_LK(benchmark::State &state) {
+  constexpr size_t SM = 16;
+  constexpr size_t N = 15;
+  constexpr size_t NxN = N * N;
+  auto current = common::synthetic_frame(COLS, ROWS, 3, 2);
+  auto previous = common::synthetic_frame(COLS, ROWS, 3, 1);
+  std::vector<unsigned char> rgbFlow(COLS * ROWS * 3);
+
+  float sum_mask[NxN];
+  for (size_t i = 0; i < NxN; i++) {
+    sum_mask[i] = 1.0f;
+  }
+  float prewitt_x[9] = {-1.0f, 0.0f,  1.0f, -2.0f, 0.0f,
+                        2.0f,  -1.0f, 0.0f, 1.0f};
+  float prewitt_y[9] = {-1.0f, -2.0f, -1.0f, 0.0, 0.0f, 0.0f, 1.0f, 2.0f, 1.0f};
+
+  auto out = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+  auto prev = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                  visioncpp::memory_type::Buffer2D>();
+
+  auto ifrgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in);
+  auto ifgrey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(ifrgb);
+  auto pfrgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(prev);
+  auto pfgrey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(pfrgb);
+
+  auto px_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(prewitt_x);
+  auto py_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(prewitt_y);
+
+  auto iifgrey = visioncpp::schedule<Policy, SM, SM, SM, SM>(ifgrey);
+  auto ppfgrey = visioncpp::schedule<Policy, SM, SM, SM, SM>(pfgrey);
+
+  auto ipx = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      iifgrey, px_filter);
+  auto ipy = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      iifgrey, py_filter);
+  auto ppx = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppfgrey, px_filter);
+  auto ppy = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppfgrey, py_filter);
+
+  auto iipx = visioncpp::schedule<Policy, SM, SM, SM, SM>(ipx);
+  auto iipy = visioncpp::schedule<Policy, SM, SM, SM, SM>(ipy);
+  auto pppx = visioncpp::schedule<Policy, SM, SM, SM, SM>(ppx);
+  auto pppy = visioncpp::schedule<Policy, SM, SM, SM, SM>(ppy);
+
+  auto px = visioncpp::point_operation<visioncpp::OP_Add>(iipx, pppx);
+  auto py = visioncpp::point_operation<visioncpp::OP_Add>(iipy, pppy);
+  auto pt = visioncpp::point_operation<visioncpp::OP_Sub>(ifgrey, pfgrey);
+
+  auto px2 = visioncpp::point_operation<visioncpp::OP_PowerOf2>(px);
+  auto py2 = visioncpp::point_operation<visioncpp::OP_PowerOf2>(py);
+  auto pxy = visioncpp::point_operation<visioncpp::OP_Mul>(px, py);
+  auto pxt = visioncpp::point_operation<visioncpp::OP_Mul>(px, pt);
+  auto pyt = visioncpp::point_operation<visioncpp::OP_Mul>(py, pt);
+
+  auto ppx2 = visioncpp::schedule<Policy, SM, SM, SM, SM>(px2);
+  auto ppy2 = visioncpp::schedule<Policy, SM, SM, SM, SM>(py2);
+  auto ppxy = visioncpp::schedule<Policy, SM, SM, SM, SM>(pxy);
+  auto ppxt = visioncpp::schedule<Policy, SM, SM, SM, SM>(pxt);
+  auto ppyt = visioncpp::schedule<Policy, SM, SM, SM, SM>(pyt);
+
+  auto sum_mask_node =
+      visioncpp::terminal<float, N, N, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sum_mask);
+
+  auto sumpx2 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppx2, sum_mask_node);
+  auto sumpy2 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppy2, sum_mask_node);
+  auto sumpxy = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppxy, sum_mask_node);
+  auto sumpxt = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppxt, sum_mask_node);
+  auto sumpyt = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppyt, sum_mask_node);
+
+  auto ksumpx2 = visioncpp::schedule<Policy, SM, SM, SM, SM>(sumpx2);
+  auto ksumpy2 = visioncpp::schedule<Policy, SM, SM, SM, SM>(sumpy2);
+  auto ksumpxy = visioncpp::schedule<Policy, SM, SM, SM, SM>(sumpxy);
+  auto ksumpxt = visioncpp::schedule<Policy, SM, SM, SM, SM>(sumpxt);
+  auto ksumpyt = visioncpp::schedule<Policy, SM, SM, SM, SM>(sumpyt);
+
+  auto px2py2 = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpx2, ksumpy2);
+  auto pxy2 = visioncpp::point_operation<visioncpp::OP_PowerOf2>(ksumpxy);
+  auto px2py2_Sub_pxy2 =
+      visioncpp::point_operation<visioncpp::OP_Sub>(px2py2, pxy2);
+  auto norm = visioncpp::schedule<Policy, SM, SM, SM, SM>(px2py2_Sub_pxy2);
+
+  auto pxtpxy = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpxt, ksumpxy);
+  auto px2pyt = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpx2, ksumpyt);
+  auto pxtpxy_Sub_px2pyt =
+      visioncpp::point_operation<visioncpp::OP_Sub>(pxtpxy, px2pyt);
+  auto v =
+      visioncpp::point_operation<visioncpp::OP_Div>(pxtpxy_Sub_px2pyt, norm);
+
+  auto pxypyt = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpxy, ksumpyt);
+  auto py2pxt = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpy2, ksumpxt);
+  auto pxypft_Sub_py2pxt =
+      visioncpp::point_operation<visioncpp::OP_Sub>(pxypyt, py2pxt);
+  auto u =
+      visioncpp::point_operation<visioncpp::OP_Div>(pxypft_Sub_py2pxt, norm);
+
+  auto uv = visioncpp::point_operation<visioncpp::OP_Merge2Chns>(u, v);
+  auto polar = visioncpp::point_operation<OP_UVtoPolar>(uv);
+  auto frgb = visioncpp::point_operation<visioncpp::OP_HSVToRGB>(polar);
+  auto urgb = visioncpp::point_operation<visioncpp::OP_F32C3ToU8C3>(frgb);
+
+  auto pipe = visioncpp::make_pipeline<Policy, SM, SM, SM, SM>(
+      visioncpp::assign(out, urgb), common::get_device(),
+      visioncpp::inputs(in, prev), visioncpp::outputs(out));
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() {
+      pipe.run(current.data(), previous.data(), rgbFlow.data());
+    });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(optical_flow_LK);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark runs the pipeline of examples/pyramid.cpp on synthetic
+// frames: a two level pyramid, the HSV of the first level and the greyscale of
+// the second level.
+
+#include "include/common.hpp"
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void pyramid(benchmark::State &state) {
+  auto frame = common::synthetic_frame(COLS, ROWS, 3);
+  std::vector<unsigned char> output_lvl1(COLS / 2 * ROWS / 2 * 3);
+  std::vector<unsigned char> output_lvl2(COLS / 4 * ROWS / 4);
+  float filter_array[3] = {1.0f / 3.0f, 1.0f / 3.0f, 1.0f / 3.0f};
+
+  auto filter_col =
+      visioncpp::terminal<float, 3, 1, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(filter_array);
+  auto filter_row =
+      visioncpp::terminal<float, 1, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(filter_array);
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+
+  auto pyr_node =
+      visioncpp::pyramid_down<visioncpp::OP_SepFilterCol,
+                              visioncpp::OP_SepFilterRow,
+                              visioncpp::OP_DownsampleClosest, 2>(
+          in, filter_col, filter_row);
+
+  auto out_lvl1 = visioncpp::terminal<visioncpp::pixel::U8C3, COLS / 2,
+                                      ROWS / 2,
+                                      visioncpp::memory_type::Buffer2D>();
+  auto node_hsv = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(
+      pyr_node.template get<0>());
+  auto node2_hsv = visioncpp::point_operation<visioncpp::OP_RGBToHSV>(node_hsv);
+  auto node3_hsv =
+      visioncpp::point_operation<visioncpp::OP_HSVToU8C3>(node2_hsv);
+  auto hsv_node = visioncpp::assign(out_lvl1, node3_hsv);
+
+  auto out_lvl2 = visioncpp::terminal<visioncpp::pixel::U8C1, COLS / 4,
+                                      ROWS / 4,
+                                      visioncpp::memory_type::Buffer2D>();
+  auto node_grey = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(
+      pyr_node.template get<1>());
+  auto node2_grey =
+      visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node_grey);
+  auto node3_grey =
+      visioncpp::point_operation<visioncpp::OP_GREYToCVBGR>(node2_grey);
+  auto grey_node = visioncpp::assign(out_lvl2, node3_grey);
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() {
+      in.reset_input(frame.data());
+      visioncpp::execute<Policy, 32, 32, 16, 16>(hsv_node,
+                                                 common::get_device());
+      visioncpp::execute<Policy, 32, 32, 16, 16>(grey_node,
+                                                 common::get_device());
+      out_lvl1.read_output(output_lvl1.data());
+      out_lvl2.read_output(output_lvl2.data());
+    });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(pyramid);
+
+BENCHMARK_MAIN();
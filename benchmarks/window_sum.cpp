@@ -0,0 +1,90 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This benchmark compares the two ways of computing the 15x15 windowed sums of
+// examples/optical_flow_LK.cpp on the greyscale of a synthetic frame: the
+// OP_Filter2D with a mask of ones, which reads the 225 pixels of the window,
+// and the box_sum reading the four corners of the window in the integral
+// image.
+
+#include "include/common.hpp"
+
+constexpr size_t N = 15;
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void window_sum_filter2d(benchmark::State &state) {
+  constexpr size_t SM = 16;
+  auto frame = common::synthetic_frame(COLS, ROWS, 1);
+  std::vector<float> output(COLS * ROWS);
+  float sum_mask[N * N];
+  for (size_t i = 0; i < N * N; i++) {
+    sum_mask[i] = 1.0f;
+  }
+
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+  auto out = visioncpp::terminal<visioncpp::pixel::F32C1, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+  auto sum_mask_node =
+      visioncpp::terminal<float, N, N, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sum_mask);
+
+  auto fgrey = visioncpp::point_operation<visioncpp::OP_U8C1ToFloat>(in);
+  auto sum = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      fgrey, sum_mask_node);
+
+  auto pipe = visioncpp::make_pipeline<Policy, SM, SM, SM, SM>(
+      visioncpp::assign(out, sum), common::get_device(),
+      visioncpp::inputs(in), visioncpp::outputs(out));
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() { pipe.run(frame.data(), output.data()); });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(window_sum_filter2d);
+
+template <bool Policy, size_t COLS, size_t ROWS>
+void window_sum_integral(benchmark::State &state) {
+  constexpr size_t SM = 16;
+  auto frame = common::synthetic_frame(COLS, ROWS, 1);
+  std::vector<float> output(COLS * ROWS);
+
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+  auto out = visioncpp::terminal<visioncpp::pixel::F32C1, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+
+  auto fgrey = visioncpp::point_operation<visioncpp::OP_U8C1ToFloat>(in);
+  auto sum = visioncpp::box_sum<N / 2>(visioncpp::integral_image(fgrey));
+
+  auto pipe = visioncpp::make_pipeline<Policy, SM, SM, SM, SM>(
+      visioncpp::assign(out, sum), common::get_device(),
+      visioncpp::inputs(in), visioncpp::outputs(out));
+
+  common::FrameTimer timer;
+  for (auto _ : state) {
+    timer.frame(state, [&]() { pipe.run(frame.data(), output.data()); });
+  }
+  timer.report(state, COLS * ROWS);
+}
+VISIONCPP_BENCHMARK(window_sum_integral);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,47 @@
+# include common configs
+include(common)
+
+project(visioncpp-Benchmarks CXX)
+
+# the benchmarks are only built when Google Benchmark is available
+find_package(benchmark QUIET)
+if(NOT benchmark_FOUND)
+  message(STATUS "Google Benchmark not found, skipping the benchmarks")
+  return()
+endif()
+
+set(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/bin/benchmark)
+
+# the backend and the device the benchmarks run on
+set(VISIONCPP_BENCHMARK_BACKEND "sycl" CACHE STRING
+  "Backend of the benchmarks, options are: sycl native")
+set(VISIONCPP_BENCHMARK_DEVICE "cpu" CACHE STRING
+  "Device of the benchmarks, options are: cpu gpu host")
+
+# builds all the benchmarks with "make benchmarks"
+add_custom_target(benchmarks)
+
+file(GLOB _srcs ${PROJECT_SOURCE_DIR}/benchmarks/*.cpp)
+# for each benchmark in folder
+foreach(_src ${_srcs})
+
+  # take name of file
+  get_filename_component(filename ${_src} NAME_WE)
+
+  # add executable of the benchmark
+  add_executable(benchmark_${filename} ${_src})
+  target_include_directories(benchmark_${filename}
+    PRIVATE ${PROJECT_SOURCE_DIR}/benchmarks)
+  target_compile_definitions(benchmark_${filename} PRIVATE
+    VISIONCPP_BENCHMARK_BACKEND=${VISIONCPP_BENCHMARK_BACKEND}
+    VISIONCPP_BENCHMARK_DEVICE=${VISIONCPP_BENCHMARK_DEVICE})
+  # link google benchmark and the pthreads library to the executable
+  target_link_libraries(benchmark_${filename}
+    PRIVATE benchmark::benchmark Threads::Threads)
+  # link sycl with the executable
+  add_sycl_to_target(
+    TARGET benchmark_${filename}
+    SOURCES ${_src})
+  add_dependencies(benchmarks benchmark_${filename})
+
+endforeach(_src ${_srcs})
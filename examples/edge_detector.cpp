@@ -90,71 +90,69 @@ int main(int argc, char** argv) {
     mean_array[i] = 1.0f / static_cast<float>(N);
   }
 
+  // the node which receives the input data from OpenCV on every frame
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                visioncpp::memory_type::Buffer2D>();
+
+  // the node which provides the output data on every frame
+  auto out = visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
+                                 visioncpp::memory_type::Buffer2D>();
+
+  // convert to Float
+  auto frgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in);
+
+  // convert to grey scale
+  auto fgrey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(frgb);
+
+  // apply mean filter to smooth the image
+  auto mean_filter =
+      visioncpp::terminal<float, filter_size, filter_size,
+                          visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(mean_array);
+  auto mean = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+      fgrey, mean_filter);
+
+  // applying sobel_x filter
+  auto x_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sobel_x);
+  auto sobel_x_op = visioncpp::neighbour_operation<
+      visioncpp::OP_Filter2D_One>(mean, x_filter);
+
+  auto y_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sobel_y);
+  auto sobel_y_op = visioncpp::neighbour_operation<
+      visioncpp::OP_Filter2D_One>(mean, y_filter);
+
+  auto intensity =
+      visioncpp::point_operation<OP_Magnitude>(sobel_x_op, sobel_y_op);
+
+  // convert to uchar
+  auto uintensity =
+      visioncpp::point_operation<visioncpp::OP_FloatToU8C1>(intensity);
+
+  // the pipeline is built once and reused for every frame, so no memory is
+  // created inside the frame loop
+  auto pipe = visioncpp::make_pipeline<visioncpp::policy::Fuse, 8, 8, 8, 8>(
+      visioncpp::assign(out, uintensity), dev, visioncpp::inputs(in),
+      visioncpp::outputs(out));
+
   for (;;) {
-    // Starting building the tree (use  {} during the creation of the tree)
-    {
-      // read frame
-      cap.read(input);
-
-      // check if image was loaded
-      if (!input.data) {
-        break;
-      }
-
-      // resize input for the desirable size
-      cv::resize(input, input, cv::Size(COLS, ROWS), 0, 0, cv::INTER_CUBIC);
-
-      // the node which gets the input data from OpenCV
-      auto in =
-          visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
-                              visioncpp::memory_type::Buffer2D>(input.data);
-
-      // the node which gets the output data
-      auto out =
-          visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
-                              visioncpp::memory_type::Buffer2D>(output.get());
-
-      // convert to Float
-      auto frgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in);
-
-      // convert to grey scale
-      auto fgrey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(frgb);
-
-      // apply mean filter to smooth the image
-      auto mean_filter =
-          visioncpp::terminal<float, filter_size, filter_size,
-                              visioncpp::memory_type::Buffer2D,
-                              visioncpp::scope::Constant>(mean_array);
-      auto mean = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
-          fgrey, mean_filter);
-
-      // applying sobel_x filter
-      auto x_filter =
-          visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
-                              visioncpp::scope::Constant>(sobel_x);
-      auto sobel_x = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
-          mean, x_filter);
-
-      auto y_filter =
-          visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
-                              visioncpp::scope::Constant>(sobel_y);
-      auto sobel_y = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
-          mean, y_filter);
-
-      auto intensity =
-          visioncpp::point_operation<OP_Magnitude>(sobel_x, sobel_y);
-
-      // convert to uchar
-      auto uintensity =
-          visioncpp::point_operation<visioncpp::OP_FloatToU8C1>(intensity);
-
-      // assign operation
-      auto pipe = visioncpp::assign(out, uintensity);
-
-      // execute the pipe
-      visioncpp::execute<visioncpp::policy::Fuse, 8, 8, 8, 8>(pipe, dev);
+    // read frame
+    cap.read(input);
+
+    // check if image was loaded
+    if (!input.data) {
+      break;
     }
 
+    // resize input for the desirable size
+    cv::resize(input, input, cv::Size(COLS, ROWS), 0, 0, cv::INTER_CUBIC);
+
+    // execute the pipe on the new frame
+    pipe.run(input.data, output.get());
+
     // Display results
     cv::imshow("Reference Image", input);
     cv::imshow("Edge Detector", outputImage);
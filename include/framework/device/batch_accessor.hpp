@@ -0,0 +1,209 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file batch_accessor.hpp
+/// \brief This file contains the accessor used by the devices when an
+/// expression is executed on a batch of images. The images of a batch are
+/// stored one after the other in the memory, so the accessor of each memory is
+/// offset to the image processed by the thread. The rest of the evaluator is
+/// unaware of the batch.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_BATCH_ACCESSOR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_BATCH_ACCESSOR_HPP_
+
+#include <utility>
+#include <vector>
+
+namespace visioncpp {
+namespace internal {
+/// \brief BatchKernel is used to name the kernel of a batched expression, so
+/// it does not clash with the kernel of the same expression executed on a
+/// single image.
+/// \tparam Expr: the expression executed by the kernel
+template <typename Expr>
+class BatchKernel;
+
+/// \class BatchAccessor
+/// \brief BatchAccessor wraps the accessor of a memory holding a batch of
+/// images. Its pointer starts at the image processed by the thread. The
+/// stride is zero when the memory holds a single image, which is then shared
+/// by all the images of the batch.
+/// template parameters:
+/// \tparam Acc: the wrapped accessor
+template <typename Acc>
+class BatchAccessor {
+ public:
+  using value_type = typename Acc::value_type;
+
+  /// \param acc: the wrapped accessor
+  /// \param stride: the number of elements of an image of the memory
+  BatchAccessor(Acc acc, size_t stride)
+      : acc(acc), stride(stride), offset(0) {}
+
+  /// \brief returns the accessor pointing to the given image of the batch
+  /// \param b: the index of the image in the batch
+  /// \return BatchAccessor
+  BatchAccessor at(size_t b) const {
+    BatchAccessor image(*this);
+    image.offset = stride * b;
+    return image;
+  }
+
+  /// \brief this function is used to mimic the get_pointer function of the
+  /// accessor used by evaluator expression.
+  /// \return the pointer of the wrapped accessor moved to the image
+  auto get_pointer() const -> decltype(std::declval<Acc>().get_pointer()) {
+    return acc.get_pointer() + offset;
+  }
+
+ private:
+  Acc acc;
+  size_t stride;
+  size_t offset;
+};
+
+/// specialisation of the Trait class when the accessor is a batch accessor
+template <typename Acc>
+struct Trait<BatchAccessor<Acc>> : public Trait<Acc> {};
+
+/// \struct BatchView
+/// \brief BatchView is used to wrap the accessors extracted from an
+/// expression into batch accessors.
+/// template parameters:
+/// \tparam Acc: the accessor extracted from the expression
+template <typename Acc>
+struct BatchView {
+  using Type = BatchAccessor<Acc>;
+  static inline Type wrap(Acc acc, size_t stride) { return Type(acc, stride); }
+};
+
+/// \brief specialisation of the BatchView when the accessor is a constant
+/// variable. It is the same for all the images of the batch.
+template <typename T>
+struct BatchView<ConstMemory<T>> {
+  using Type = ConstMemory<T>;
+  static inline Type wrap(Type acc, size_t) { return acc; }
+};
+
+/// \struct BatchStride
+/// \brief BatchStride collects the stride of each memory of the expression by
+/// using the same in-order traverse algorithm as the accessor extraction, so
+/// the strides are in the same order as the accessors.
+/// template parameters:
+/// \tparam Category: the category of the node
+/// \tparam Expr: the type of the node
+template <size_t Category, typename Expr>
+struct BatchStride;
+
+/// \brief specialisation of the BatchStride when the node is a LeafNode
+template <typename RHS, size_t LVL>
+struct BatchStride<expr_category::Unary, LeafNode<RHS, LVL>> {
+  static inline void get(const LeafNode<RHS, LVL> &expr,
+                         std::vector<size_t> &strides) {
+    const auto &mem = expr.vilibMemory;
+    strides.push_back(
+        (mem.get_batch() > 1) ? mem.get_cols() * mem.get_rows() : 0);
+  }
+};
+
+/// \brief specialisation of the BatchStride when the node has one child
+template <typename Expr>
+struct BatchStride<expr_category::Unary, Expr> {
+  static inline void get(const Expr &expr, std::vector<size_t> &strides) {
+    BatchStride<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr>::get(
+        expr.rhs, strides);
+  }
+};
+
+/// \brief specialisation of the BatchStride when the node has two children
+template <typename Expr>
+struct BatchStride<expr_category::Binary, Expr> {
+  static inline void get(const Expr &expr, std::vector<size_t> &strides) {
+    BatchStride<Expr::LHSExpr::ND_Category, typename Expr::LHSExpr>::get(
+        expr.lhs, strides);
+    BatchStride<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr>::get(
+        expr.rhs, strides);
+  }
+};
+
+/// function batch_accessors_impl
+/// \brief wraps each accessor of the tuple with the stride of its memory
+template <typename... Accs, size_t... I>
+tools::tuple::Tuple<typename BatchView<Accs>::Type...> batch_accessors_impl(
+    tools::tuple::Tuple<Accs...> t, const std::vector<size_t> &strides,
+    tools::tuple::Index_list<I...>) {
+  return tools::tuple::make_tuple(
+      BatchView<Accs>::wrap(tools::tuple::get<I>(t), strides[I])...);
+}
+
+/// function batch_accessors
+/// \brief wraps the accessors extracted from the expression into batch
+/// accessors. This is done on the host.
+/// template parameters:
+/// \tparam Expr: the expression the accessors have been extracted from
+/// \tparam Accs: the type of the accessors
+/// function parameters:
+/// \param expr: the expression
+/// \param t: the tuple of the accessors extracted from the expression
+/// \return the tuple of batch accessors
+template <typename Expr, typename... Accs>
+tools::tuple::Tuple<typename BatchView<Accs>::Type...> batch_accessors(
+    const Expr &expr, tools::tuple::Tuple<Accs...> t) {
+  std::vector<size_t> strides;
+  BatchStride<Expr::ND_Category, Expr>::get(expr, strides);
+  return batch_accessors_impl(t, strides,
+                              tools::tuple::Index_range<0, sizeof...(Accs)>());
+}
+
+/// function image_at
+/// \brief returns the batch accessor pointing to the image of the batch
+template <typename Acc>
+inline BatchAccessor<Acc> image_at(const BatchAccessor<Acc> &acc, size_t b) {
+  return acc.at(b);
+}
+/// \brief the accessors which are not batch accessors (e.g. a constant) are
+/// the same for all the images of the batch
+template <typename Acc>
+inline Acc image_at(const Acc &acc, size_t) {
+  return acc;
+}
+
+/// function batch_at_impl
+/// \brief moves each accessor of the tuple to the image of the batch
+template <typename... Accs, size_t... I>
+tools::tuple::Tuple<Accs...> batch_at_impl(
+    const tools::tuple::Tuple<Accs...> &t, size_t b,
+    tools::tuple::Index_list<I...>) {
+  return tools::tuple::make_tuple(image_at(tools::tuple::get<I>(t), b)...);
+}
+
+/// function batch_at
+/// \brief moves the batch accessors to the image processed by the thread. This
+/// is done on the device by each thread.
+/// \param t: the tuple of the batch accessors
+/// \param b: the index of the image in the batch
+/// \return the tuple of the batch accessors pointing to the image
+template <typename... Accs>
+tools::tuple::Tuple<Accs...> batch_at(const tools::tuple::Tuple<Accs...> &t,
+                                      size_t b) {
+  return batch_at_impl(t, b, tools::tuple::Index_range<0, sizeof...(Accs)>());
+}
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_BATCH_ACCESSOR_HPP_
@@ -18,10 +18,13 @@
 // limitations under the License.
 
 /// \file device/device.hpp
-/// \brief include headers for adding different devices. Currently we only
-/// support sycl backend
+/// \brief include headers for adding different devices. Currently we support
+/// the sycl backend and the native backend which runs on the host cpu by using
+/// std::thread
 
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_DEVICE_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_DEVICE_HPP_
+#include "batch_accessor.hpp"
 #include "sycl/device.hpp"
+#include "native/device.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_DEVICE_HPP_
@@ -0,0 +1,167 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file native/extract_accessors.hpp
+/// \brief This files is used to provide an access mechanism for terminal nodes
+/// on the native backend.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_EXTRACT_ACCESSORS_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_EXTRACT_ACCESSORS_HPP_
+
+namespace visioncpp {
+namespace internal {
+///
+/// \brief The native extract accessor struct is the native backend equivalent
+/// of the ExtractAccessor. It extracts the host accessible memory from the
+/// leafnodes and packs them in a tuple by using the same in-order traverse
+/// algorithm on the expression tree, so the placeholder indices of the
+/// expression tree stay valid.
+///
+template <size_t Category, typename Expr>
+struct NativeExtractAccessor;
+
+/// \brief Specialisation of NativeExtractAccessor class where the expression
+/// node is LeafNode.
+template <typename RHS, size_t LVL>
+struct NativeExtractAccessor<expr_category::Unary, LeafNode<RHS, LVL>> {
+  /// getting read access when the leaf node is accessed by traversing the right-
+  /// hand side of an Assign or ParallelCopy (partial Assign) expression
+  static auto getTuple(LeafNode<RHS, LVL> &expr)
+      -> decltype(tools::tuple::make_tuple(
+          NativeMemoryAccess<RHS::LeafType>::template get<
+              cl::sycl::access::mode::read>(expr.vilibMemory))) {
+    return tools::tuple::make_tuple(
+        NativeMemoryAccess<RHS::LeafType>::template get<
+            cl::sycl::access::mode::read>(expr.vilibMemory));
+  }
+  /// getting write access when the leaf node is accessed by traversing the left-
+  /// hand side of ParallelCopy(partial assign) expression
+  static auto getWriteTuple(LeafNode<RHS, LVL> &expr)
+      -> decltype(tools::tuple::make_tuple(
+          NativeMemoryAccess<RHS::LeafType>::template get<
+              cl::sycl::access::mode::write>(expr.vilibMemory))) {
+    return tools::tuple::make_tuple(
+        NativeMemoryAccess<RHS::LeafType>::template get<
+            cl::sycl::access::mode::write>(expr.vilibMemory));
+  }
+  /// getting discard_write access when the leaf node is accessed by traversing
+  /// the left-hand side of an Assign expression
+  static auto getDiscardWriteTuple(LeafNode<RHS, LVL> &expr)
+      -> decltype(tools::tuple::make_tuple(
+          NativeMemoryAccess<RHS::LeafType>::template get<
+              cl::sycl::access::mode::discard_write>(expr.vilibMemory))) {
+    return tools::tuple::make_tuple(
+        NativeMemoryAccess<RHS::LeafType>::template get<
+            cl::sycl::access::mode::discard_write>(expr.vilibMemory));
+  }
+};
+
+/// \brief Specialisation of NativeExtractAccessor class where the expression
+/// node has one child
+template <typename Expr>
+struct NativeExtractAccessor<expr_category::Unary, Expr> {
+  static auto getTuple(Expr &expr)
+      -> decltype(NativeExtractAccessor<Expr::RHSExpr::ND_Category,
+                                        typename Expr::RHSExpr>::getTuple(
+          expr.rhs)) {
+    return NativeExtractAccessor<Expr::RHSExpr::ND_Category,
+                                 typename Expr::RHSExpr>::getTuple(expr.rhs);
+  }
+};
+
+/// \brief Specialisation of NativeExtractAccessor class where the expression
+/// node has two children
+template <typename Expr>
+struct NativeExtractAccessor<expr_category::Binary, Expr> {
+  static auto getTuple(Expr &expr) -> decltype(tools::tuple::append(
+      NativeExtractAccessor<Expr::LHSExpr::ND_Category,
+                            typename Expr::LHSExpr>::getTuple(expr.lhs),
+      NativeExtractAccessor<Expr::RHSExpr::ND_Category,
+                            typename Expr::RHSExpr>::getTuple(expr.rhs))) {
+    auto LHSTuple =
+        NativeExtractAccessor<Expr::LHSExpr::ND_Category,
+                              typename Expr::LHSExpr>::getTuple(expr.lhs);
+    auto RHSTuple =
+        NativeExtractAccessor<Expr::RHSExpr::ND_Category,
+                              typename Expr::RHSExpr>::getTuple(expr.rhs);
+    return tools::tuple::append(LHSTuple, RHSTuple);
+  }
+};
+
+/// \brief Specialisation of NativeExtractAccessor class where the expression
+/// node is Assign
+template <typename LHSExpr, typename RHSExpr, size_t Cols, size_t Rows,
+          size_t LeafType, size_t LVL>
+struct NativeExtractAccessor<expr_category::Binary,
+                             Assign<LHSExpr, RHSExpr, Cols, Rows, LeafType,
+                                    LVL>> {
+  static auto getTuple(
+      Assign<LHSExpr, RHSExpr, Cols, Rows, LeafType, LVL> &expr)
+      -> decltype(tools::tuple::append(
+          NativeExtractAccessor<LHSExpr::ND_Category,
+                                LHSExpr>::getDiscardWriteTuple(expr.lhs),
+          NativeExtractAccessor<RHSExpr::ND_Category, RHSExpr>::getTuple(
+              expr.rhs))) {
+    auto LHSTuple = NativeExtractAccessor<
+        LHSExpr::ND_Category, LHSExpr>::getDiscardWriteTuple(expr.lhs);
+    auto RHSTuple =
+        NativeExtractAccessor<RHSExpr::ND_Category, RHSExpr>::getTuple(
+            expr.rhs);
+    return tools::tuple::append(LHSTuple, RHSTuple);
+  }
+};
+
+/// \brief Specialisation of NativeExtractAccessor class where the expression
+/// node is a ParallelCopy (partial assign)
+template <typename LHSExpr, typename RHSExpr, size_t Cols, size_t Rows,
+          size_t OffsetColIn, size_t OffsetRowIn, size_t OffsetColOut,
+          size_t OffsetRowOut, size_t LeafType, size_t LVL>
+struct NativeExtractAccessor<
+    expr_category::Binary,
+    ParallelCopy<LHSExpr, RHSExpr, Cols, Rows, OffsetColIn, OffsetRowIn,
+                 OffsetColOut, OffsetRowOut, LeafType, LVL>> {
+  static auto getTuple(
+      ParallelCopy<LHSExpr, RHSExpr, Cols, Rows, OffsetColIn, OffsetRowIn,
+                   OffsetColOut, OffsetRowOut, LeafType, LVL> &expr)
+      -> decltype(tools::tuple::append(
+          NativeExtractAccessor<LHSExpr::ND_Category, LHSExpr>::getWriteTuple(
+              expr.lhs),
+          NativeExtractAccessor<RHSExpr::ND_Category, RHSExpr>::getTuple(
+              expr.rhs))) {
+    auto LHSTuple =
+        NativeExtractAccessor<LHSExpr::ND_Category, LHSExpr>::getWriteTuple(
+            expr.lhs);
+    auto RHSTuple =
+        NativeExtractAccessor<RHSExpr::ND_Category, RHSExpr>::getTuple(
+            expr.rhs);
+    return tools::tuple::append(LHSTuple, RHSTuple);
+  }
+};
+
+/// \brief deduction function for NativeExtractAccessor.
+/// \param e: the expression tree
+/// \return Tuple
+template <typename Expr>
+auto extract_native_accessors(Expr &e) -> decltype(
+    NativeExtractAccessor<Expr::ND_Category, Expr>::getTuple(e)) {
+  return NativeExtractAccessor<Expr::ND_Category, Expr>::getTuple(e);
+}
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_EXTRACT_ACCESSORS_HPP_
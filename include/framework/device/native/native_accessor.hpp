@@ -0,0 +1,191 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file native_accessor.hpp
+/// \brief This file contains the memory access types used by the native
+/// backend. The native backend evaluates the same expression tree as the sycl
+/// backend, therefore the types here mimic the part of the sycl accessor and
+/// nd_item interfaces used by the evaluator.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_NATIVE_ACCESSOR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_NATIVE_ACCESSOR_HPP_
+
+#include <memory>
+
+namespace visioncpp {
+namespace internal {
+/// \struct NativeHandler
+/// \brief NativeHandler is passed to the LocalOutput instead of the sycl
+/// command group handler when the expression is executed by the native
+/// backend. Each worker thread creates its own handler, so the local memory of
+/// a workgroup becomes a private scratch memory of the worker thread.
+struct NativeHandler {};
+
+/// \struct NativeAddressSpace
+/// \brief converts the sycl target of a memory to the sycl address space of
+/// the pointer returned by get_pointer, so the evaluator can use the same
+/// neighbour types on both backends.
+/// \tparam Target: the sycl target of the memory
+template <cl::sycl::access::target Target>
+struct NativeAddressSpace;
+
+/// \brief specialisation of NativeAddressSpace for global_buffer
+template <>
+struct NativeAddressSpace<cl::sycl::access::target::global_buffer> {
+  static constexpr cl::sycl::access::address_space space =
+      cl::sycl::access::address_space::global_space;
+};
+
+/// \brief specialisation of NativeAddressSpace for constant_buffer
+template <>
+struct NativeAddressSpace<cl::sycl::access::target::constant_buffer> {
+  static constexpr cl::sycl::access::address_space space =
+      cl::sycl::access::address_space::constant_space;
+};
+
+/// \brief specialisation of NativeAddressSpace for local
+template <>
+struct NativeAddressSpace<cl::sycl::access::target::local> {
+  static constexpr cl::sycl::access::address_space space =
+      cl::sycl::access::address_space::local_space;
+};
+
+/// \class NativeAccessor
+/// \brief NativeAccessor is the accessor used by the native backend. It wraps
+/// a host pointer and keeps alive the storage the pointer belongs to. The
+/// storage is either a sycl host accessor on a VisionMemory or a scratch memory
+/// emulating the local memory of a workgroup.
+/// template parameters:
+/// \tparam T: the element type of the memory
+/// \tparam Dims: the dimension of the memory
+/// \tparam Target: the sycl target this accessor replaces
+template <typename T, size_t Dims, cl::sycl::access::target Target>
+class NativeAccessor {
+ public:
+  using value_type = T;
+  using PointerType =
+      cl::sycl::multi_ptr<T, NativeAddressSpace<Target>::space>;
+
+  /// \brief wraps an existing host pointer.
+  /// \param storage: the object owning the memory pointed by ptr
+  /// \param ptr: the host pointer
+  NativeAccessor(std::shared_ptr<void> storage, T *ptr)
+      : storage(storage), ptr(ptr) {}
+
+  /// \brief creates a scratch memory of the given range. This mirrors the
+  /// constructor of the sycl local accessor.
+  /// \param rng: the range of the scratch memory
+  NativeAccessor(cl::sycl::range<Dims> rng, NativeHandler &)
+      : NativeAccessor(std::shared_ptr<T>(new T[rng.size()],
+                                          std::default_delete<T[]>())) {}
+
+  /// \brief this function is used to mimic the get_pointer function of the
+  /// sycl accessor used by evaluator expression.
+  /// \return PointerType
+  PointerType get_pointer() const { return PointerType(ptr); }
+
+ private:
+  NativeAccessor(std::shared_ptr<T> scratch)
+      : storage(scratch), ptr(scratch.get()) {}
+
+  std::shared_ptr<void> storage;
+  T *ptr;
+};
+
+/// \brief specialisation of the LocalAccessor when the handler is the native
+/// handler.
+template <typename T, size_t Dim>
+struct LocalAccessor<NativeHandler, T, Dim> {
+  using Type = NativeAccessor<T, Dim, cl::sycl::access::target::local>;
+};
+
+/// specialisation of the Trait class when the accessor is native accessor
+template <typename T, size_t Dims, cl::sycl::access::target Target>
+struct Trait<NativeAccessor<T, Dims, Target>> {
+  using Type = T;
+  static constexpr int Dim = Dims;
+  static constexpr size_t scope = ConvertToVisionScope<Target>::scope;
+};
+
+/// \struct NativeItem
+/// \brief NativeItem replaces the sycl nd_item when the expression is
+/// executed by the native backend. Each workgroup is executed by one thread,
+/// therefore the local range is one and the barriers have nothing to
+/// synchronise. The evaluator then loops over the whole tile, the same way a
+/// sycl workgroup smaller than the tile does.
+struct NativeItem {
+  /// \param group_c: the column index of the tile
+  /// \param group_r: the row index of the tile
+  NativeItem(size_t group_c, size_t group_r)
+      : group_c(group_c), group_r(group_r) {}
+  cl::sycl::range<2> get_local_range() const {
+    return cl::sycl::range<2>(1, 1);
+  }
+  size_t get_local_id(int) const { return 0; }
+  size_t get_group(int dim) const {
+    return (dim == mem_dim::ColDim) ? group_c : group_r;
+  }
+  void barrier(cl::sycl::access::fence_space) const {}
+
+  size_t group_c;
+  size_t group_r;
+};
+
+/// \struct NativeMemoryAccess
+/// \brief NativeMemoryAccess is used to get host access to a VisionMemory. It
+/// has been specialised based on the memory type. The memory of a terminal
+/// node is a sycl buffer on both backends, so the native backend still pays
+/// for the creation of a sycl host accessor on each memory of each kernel.
+/// template parameters:
+/// \tparam LeafType: the type of the memory
+template <size_t LeafType>
+struct NativeMemoryAccess {
+  /// function get
+  /// \brief creates a host accessor on the sycl buffer and wraps its pointer
+  /// into a NativeAccessor. The host accessor waits for any pending sycl
+  /// command on the buffer.
+  /// template parameters:
+  /// \tparam accMode: represents the sycl type of access
+  /// \tparam Mem: the type of the VisionMemory
+  /// \param mem: the VisionMemory
+  /// \return NativeAccessor
+  template <cl::sycl::access::mode accMode, typename Mem>
+  static NativeAccessor<typename Mem::ElementType, Mem::Dim,
+                        SyclScope<LeafType, Mem::scope>::scope>
+  get(Mem &mem) {
+    using HostAcc = typename Mem::template HostAccessor<accMode>;
+    auto acc = std::make_shared<HostAcc>(*mem.syclData);
+    return NativeAccessor<typename Mem::ElementType, Mem::Dim,
+                          SyclScope<LeafType, Mem::scope>::scope>(
+        acc, acc->get_pointer());
+  }
+};
+
+/// \brief specialisation of the NativeMemoryAccess when the memory is a
+/// constant variable.
+template <>
+struct NativeMemoryAccess<memory_type::Const> {
+  template <cl::sycl::access::mode accMode, typename Mem>
+  static ConstMemory<typename Mem::ElementType> get(Mem &mem) {
+    return ConstMemory<typename Mem::ElementType>(*mem.syclData);
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_NATIVE_ACCESSOR_HPP_
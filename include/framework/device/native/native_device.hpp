@@ -0,0 +1,199 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file native_device.hpp
+/// \brief This file contains the native backend. The native backend executes
+/// the expression tree on the host cpu by using a pool of std::thread workers
+/// without launching any sycl kernel.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_NATIVE_DEVICE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_NATIVE_DEVICE_HPP_
+
+#include <atomic>
+#include <string>
+
+namespace visioncpp {
+namespace internal {
+
+/// \brief specialisation Device_ for the native backend. The expression is
+/// split into the same tiles the sycl backend uses for its workgroups. Each
+/// tile is executed by one worker thread which loops over the whole tile and
+/// uses a private scratch memory in place of the local memory of the
+/// workgroup. The tiles are distributed dynamically between the workers.
+/// \tparam device type. Only the cpu and host devices are supported.
+template <device dv>
+class Device_<backend::native, dv> {
+  static_assert(dv == device::cpu || dv == device::host,
+                "The native backend can only execute on the cpu or host "
+                "device");
+
+ private:
+  std::shared_ptr<WorkerPool> pool;
+  /// the intermediate memories are shared between the copies of the device
+  std::shared_ptr<BufferPool> buffer_pool;
+  /// the profiler recording the kernels, null when profiling is disabled
+  profiler *prof;
+  /// the number of consecutive columns evaluated at once in a point
+  /// operation. A worker walks the columns of its tile one after the other,
+  /// so they are evaluated 8 at a time, the float width of an AVX register.
+  static constexpr size_t VecWidth = 8;
+
+ public:
+  Device_()
+      : pool(std::make_shared<WorkerPool>(
+            std::thread::hardware_concurrency() > 0
+                ? std::thread::hardware_concurrency()
+                : 1)),
+        buffer_pool(std::make_shared<BufferPool>()),
+        prof(nullptr) {}
+  /// \brief creates the device recording each kernel in the profiler. The
+  /// timestamps are taken from the host clock before and after the tiles are
+  /// executed.
+  /// \param prof : the profiler recording the kernels
+  explicit Device_(profiler &prof) : Device_() { this->prof = &prof; }
+  /// \brief returns the pool recycling the intermediate memories
+  /// \return BufferPool
+  BufferPool &get_buffer_pool() const { return *buffer_pool; }
+  /// \brief returns the name of the device, which includes the number of
+  /// threads executing the tiles
+  /// \return std::string
+  std::string get_name() const {
+    return "native (" + std::to_string(pool->size()) + " threads)";
+  }
+  /// \brief returns the event of the last kernel executed by the device. The
+  /// kernels are executed before execute returns, so the event is complete.
+  /// \return event
+  visioncpp::event last_event() const { return visioncpp::event(); }
+  /// \brief executes the expression on the device.
+  /// template parameters:
+  /// \tparam LC: the column size of the local memory
+  /// \tparam LR: the row size of the local memory
+  /// \tparam CLT: the column size of the workgroup
+  /// \tparam RLT: the row size of the workgroup
+  /// function parameters:
+  /// \param expr : the expression to execute
+  /// \param cGThreads : the total number of threads in the column dimension
+  /// \param rGThreads : the total number of threads in the row dimension
+  /// \param cols : the runtime column size of the dynamic nodes
+  /// \param rows : the runtime row size of the dynamic nodes
+  template <size_t LC, size_t LR, size_t CLT, size_t RLT, typename Expr>
+  void execute(Expr &expr, size_t cGThreads, size_t rGThreads, size_t cols,
+               size_t rows) const {
+    constexpr size_t TotalLeaves = LeafCount<Expr::ND_Category, Expr>::Count;
+    /// replacing the the leaf node in the expression tree with a placeholder
+    /// number
+    using placeHolderExprType =
+        typename MakePlaceHolderExprHelper<Expr::ND_Category, Expr,
+                                           TotalLeaves - 1>::Type;
+    /// the number of tiles (sycl workgroups) in each dimension
+    const size_t ColTiles = cGThreads / CLT;
+    const size_t RowTiles = rGThreads / RLT;
+
+    /// creating host accessors on all input output buffers. They are shared
+    /// by all the worker threads.
+    auto global_accessor_tuple = extract_native_accessors(expr);
+    /// starting point of local tuples
+    constexpr size_t Output_offset = tools::tuple::size(global_accessor_tuple);
+    std::atomic<size_t> next_tile(0);
+    kernel_record record;
+    if (prof) {
+      record = make_kernel_record<LC, LR, CLT, RLT>(expr, cGThreads, rGThreads);
+      record.submit = record.start = host_timestamp();
+    }
+
+    pool->run([&]() {
+      /// each worker creates its own scratch memory once and reuses it for
+      /// all the tiles it executes
+      NativeHandler handler;
+      auto device_tuple = tools::tuple::append(
+          global_accessor_tuple, create_local_accessors<LC, LR, Expr>(handler));
+      for (size_t tile = next_tile++; tile < ColTiles * RowTiles;
+           tile = next_tile++) {
+        /// creating the index access for the tile
+        auto cOffset = memLocation<LC, LR, VecWidth>(
+            NativeItem(tile % ColTiles, tile / ColTiles), cols, rows);
+        eval<Output_offset, LC, LR, placeHolderExprType>(cOffset,
+                                                         device_tuple);
+      }
+    });
+    if (prof) {
+      record.end = host_timestamp();
+      prof->add(record);
+    }
+  }
+  /// \brief executes the expression on a batch of images. The tiles of all
+  /// the images of the batch are distributed between the workers, and each
+  /// tile moves the accessors to its image.
+  /// template parameters:
+  /// \tparam LC: the column size of the local memory
+  /// \tparam LR: the row size of the local memory
+  /// \tparam CLT: the column size of the workgroup
+  /// \tparam RLT: the row size of the workgroup
+  /// function parameters:
+  /// \param expr : the expression to execute
+  /// \param cGThreads : the total number of threads in the column dimension
+  /// \param rGThreads : the total number of threads in the row dimension
+  /// \param cols : the runtime column size of the dynamic nodes
+  /// \param rows : the runtime row size of the dynamic nodes
+  /// \param batch : the number of images of the batch
+  template <size_t LC, size_t LR, size_t CLT, size_t RLT, typename Expr>
+  void execute_batch(Expr &expr, size_t cGThreads, size_t rGThreads,
+                     size_t cols, size_t rows, size_t batch) const {
+    constexpr size_t TotalLeaves = LeafCount<Expr::ND_Category, Expr>::Count;
+    using placeHolderExprType =
+        typename MakePlaceHolderExprHelper<Expr::ND_Category, Expr,
+                                           TotalLeaves - 1>::Type;
+    const size_t ColTiles = cGThreads / CLT;
+    const size_t RowTiles = rGThreads / RLT;
+    const size_t Tiles = ColTiles * RowTiles;
+
+    auto global_accessor_tuple =
+        batch_accessors(expr, extract_native_accessors(expr));
+    constexpr size_t Output_offset = tools::tuple::size(global_accessor_tuple);
+    std::atomic<size_t> next_tile(0);
+    kernel_record record;
+    if (prof) {
+      record = make_kernel_record<LC, LR, CLT, RLT>(expr, cGThreads, rGThreads);
+      record.submit = record.start = host_timestamp();
+    }
+
+    pool->run([&]() {
+      NativeHandler handler;
+      auto local_accessor_tuple = create_local_accessors<LC, LR, Expr>(handler);
+      for (size_t task = next_tile++; task < Tiles * batch;
+           task = next_tile++) {
+        const size_t tile = task % Tiles;
+        auto device_tuple = tools::tuple::append(
+            batch_at(global_accessor_tuple, task / Tiles),
+            local_accessor_tuple);
+        auto cOffset = memLocation<LC, LR, VecWidth>(
+            NativeItem(tile % ColTiles, tile / ColTiles), cols, rows);
+        eval<Output_offset, LC, LR, placeHolderExprType>(cOffset,
+                                                         device_tuple);
+      }
+    });
+    if (prof) {
+      record.end = host_timestamp();
+      prof->add(record);
+    }
+  }
+};
+}  // namespace internal
+}  // namespace visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_NATIVE_DEVICE_HPP_
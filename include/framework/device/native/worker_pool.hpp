@@ -0,0 +1,148 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file worker_pool.hpp
+/// \brief This file contains the pool of std::thread workers used by the
+/// native backend to execute the tiles of an expression tree.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_WORKER_POOL_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_WORKER_POOL_HPP_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace visioncpp {
+namespace internal {
+/// \class WorkerPool
+/// \brief WorkerPool owns a fixed set of std::thread workers. The threads are
+/// created once when the pool is constructed and are reused for every kernel,
+/// so that no thread is created per execution. The run function executes the
+/// same task on all the workers and on the calling thread and returns once all
+/// of them finished.
+class WorkerPool {
+ public:
+  /// \brief creates a pool with the given number of threads. The calling
+  /// thread of run is counted as one of them.
+  /// \param num_threads: the total number of threads used to run a task
+  explicit WorkerPool(size_t num_threads)
+      : task(nullptr), generation(0), pending(0), stop(false) {
+    for (size_t i = 1; i < num_threads; i++) {
+      workers.emplace_back([this]() { worker_loop(); });
+    }
+  }
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  ~WorkerPool() {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      stop = true;
+    }
+    start_cv.notify_all();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  /// \brief returns the total number of threads used to run a task
+  /// \return size_t
+  size_t size() const { return workers.size() + 1; }
+
+  /// function run
+  /// \brief executes the task on every thread of the pool. The task is
+  /// responsible for splitting the work between the threads. The first
+  /// exception thrown by a thread is rethrown on the calling thread.
+  /// \param tsk: the task executed by each thread
+  /// \return void
+  void run(const std::function<void()> &tsk) {
+    std::unique_lock<std::mutex> run_lock(run_mtx);
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      task = &tsk;
+      error = nullptr;
+      pending = workers.size();
+      generation++;
+    }
+    start_cv.notify_all();
+    execute_task(tsk);
+    std::unique_lock<std::mutex> lock(mtx);
+    done_cv.wait(lock, [this]() { return pending == 0; });
+    task = nullptr;
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  /// \brief runs the task and records the first exception thrown by it
+  void execute_task(const std::function<void()> &tsk) {
+    try {
+      tsk();
+    } catch (...) {
+      std::unique_lock<std::mutex> lock(mtx);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  }
+
+  /// \brief the loop executed by each worker. It waits for a new generation
+  /// of task to be submitted by run.
+  void worker_loop() {
+    size_t seen = 0;
+    for (;;) {
+      const std::function<void()> *tsk;
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        start_cv.wait(lock, [&]() { return stop || generation != seen; });
+        if (stop) {
+          return;
+        }
+        seen = generation;
+        tsk = task;
+      }
+      execute_task(*tsk);
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (--pending == 0) {
+          done_cv.notify_one();
+        }
+      }
+    }
+  }
+
+  std::vector<std::thread> workers;
+  std::mutex run_mtx;
+  std::mutex mtx;
+  std::condition_variable start_cv;
+  std::condition_variable done_cv;
+  const std::function<void()> *task;
+  size_t generation;
+  size_t pending;
+  bool stop;
+  std::exception_ptr error;
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_NATIVE_WORKER_POOL_HPP_
@@ -23,8 +23,39 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_SYCL_DEVICE_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_SYCL_DEVICE_HPP_
 
+#include <map>
+#include <mutex>
+#include <thread>
+
 namespace visioncpp {
 namespace internal {
+/// \class SubmittedEvents
+/// \brief SubmittedEvents keeps the event of the last kernel submitted to a
+/// queue by each host thread. It is shared by the copies of a device, which
+/// share the queue, and it is guarded by a mutex. So threads executing on
+/// copies of the same device do not race, and each thread gets the event of
+/// its own kernels.
+class SubmittedEvents {
+  std::map<std::thread::id, cl::sycl::event> last;
+  mutable std::mutex mutex;
+
+ public:
+  /// \brief records the kernel submitted by the calling thread
+  /// \param submitted : the event of the kernel
+  /// \return void
+  void set(const cl::sycl::event &submitted) {
+    std::lock_guard<std::mutex> lock(mutex);
+    last[std::this_thread::get_id()] = submitted;
+  }
+  /// \brief returns the event of the last kernel submitted by the calling
+  /// thread, or a complete event when it has not submitted any kernel
+  /// \return cl::sycl::event
+  cl::sycl::event get() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = last.find(std::this_thread::get_id());
+    return (found == last.end()) ? cl::sycl::event() : found->second;
+  }
+};
 
 /// \brief specialisation Device_ for sycl
 /// \tparam device type supported by sycl
@@ -35,21 +66,99 @@ class Device_<backend::sycl, dv> {
 
  private:
   mutable QueueType dev;
+  /// the intermediate memories are shared between the copies of the device
+  std::shared_ptr<BufferPool> buffer_pool;
+  /// the events of the last kernels submitted to the queue by each thread
+  std::shared_ptr<SubmittedEvents> last_submitted;
+  /// the profiler recording the kernels, null when profiling is disabled
+  profiler *prof;
+  /// the number of consecutive columns a thread evaluates at once in a point
+  /// operation. The gpu threads of a workgroup already run side by side, so
+  /// only the cpu and host devices evaluate the columns in vectors.
+  static constexpr size_t VecWidth =
+      (dv == device::cpu || dv == device::host) ? 4 : 1;
+
+  /// \brief prints the asynchronous exceptions thrown by the queue
+  static void report(cl::sycl::exception_list l) {
+    for (const auto &e : l) {
+      try {
+        std::rethrow_exception(e);
+      } catch (cl::sycl::exception e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
+  /// \brief records the kernel submitted last. Its timestamps are read from
+  /// the queue profiling information once it is complete.
+  template <size_t LC, size_t LR, size_t CLT, size_t RLT, typename Expr>
+  void record(const Expr &expr, size_t cGThreads, size_t rGThreads,
+              cl::sycl::event submitted) const {
+    prof->add(make_kernel_record<LC, LR, CLT, RLT>(expr, cGThreads, rGThreads),
+              [submitted](kernel_record &kernel) mutable {
+                submitted.wait();
+                kernel.submit = submitted.get_profiling_info<
+                    cl::sycl::info::event_profiling::command_submit>();
+                kernel.start = submitted.get_profiling_info<
+                    cl::sycl::info::event_profiling::command_start>();
+                kernel.end = submitted.get_profiling_info<
+                    cl::sycl::info::event_profiling::command_end>();
+              });
+  }
 
  public:
   Device_()
-      : dev(QueueType(DevType(), [=](cl::sycl::exception_list l) {
-          for (const auto &e : l) {
-            try {
-              std::rethrow_exception(e);
-            } catch (cl::sycl::exception e) {
-              std::cout << e.what() << std::endl;
-            }
-          }
-        })) {}
-  template <size_t LC, size_t LR, size_t CGT, size_t RGT, size_t CLT,
-            size_t RLT, typename Expr>
-  void execute(Expr &expr) const {
+      : dev(QueueType(DevType(), report)),
+        buffer_pool(std::make_shared<BufferPool>()),
+        last_submitted(std::make_shared<SubmittedEvents>()),
+        prof(nullptr) {}
+  /// \brief creates the device recording each kernel in the profiler. The
+  /// queue is created with the profiling enabled.
+  /// \param prof : the profiler recording the kernels
+  explicit Device_(profiler &prof)
+      : dev(QueueType(DevType(), report,
+                      cl::sycl::property_list{
+                          cl::sycl::property::queue::enable_profiling()})),
+        buffer_pool(std::make_shared<BufferPool>()),
+        last_submitted(std::make_shared<SubmittedEvents>()),
+        prof(&prof) {}
+  /// \brief returns the pool recycling the intermediate memories
+  /// \return BufferPool
+  BufferPool &get_buffer_pool() const { return *buffer_pool; }
+  /// \brief returns the name of the device selected by the queue
+  /// \return std::string
+  std::string get_name() const {
+    return dev.get_device().get_info<cl::sycl::info::device::name>();
+  }
+  /// \brief returns the event of the last kernel submitted to the device by
+  /// the calling thread. The kernels of an expression depend on each other
+  /// through their buffers, so the last one completes after all the others.
+  /// \return event
+  visioncpp::event last_event() const {
+    cl::sycl::event last = last_submitted->get();
+    return visioncpp::event(
+        [last]() mutable { last.wait_and_throw(); },
+        [last]() {
+          return last.get_info<
+                     cl::sycl::info::event::command_execution_status>() ==
+                 cl::sycl::info::event_command_status::complete;
+        });
+  }
+  /// \brief executes the expression on the device.
+  /// template parameters:
+  /// \tparam LC: the column size of the local memory
+  /// \tparam LR: the row size of the local memory
+  /// \tparam CLT: the column size of the workgroup
+  /// \tparam RLT: the row size of the workgroup
+  /// function parameters:
+  /// \param expr : the expression to execute
+  /// \param cGThreads : the total number of threads in the column dimension
+  /// \param rGThreads : the total number of threads in the row dimension
+  /// \param cols : the runtime column size of the dynamic nodes
+  /// \param rows : the runtime row size of the dynamic nodes
+  template <size_t LC, size_t LR, size_t CLT, size_t RLT, typename Expr>
+  void execute(Expr &expr, size_t cGThreads, size_t rGThreads, size_t cols,
+               size_t rows) const {
     /// generating the short class name for the AMD gpu
     constexpr size_t TotalLeaves = LeafCount<Expr::ND_Category, Expr>::Count;
     /// replacing the the leaf node in the expression tree with a placeholder
@@ -59,7 +168,7 @@ class Device_<backend::sycl, dv> {
                                            TotalLeaves - 1>::Type;
 
     /// submitting the lambda expression to the sycl queue.
-    dev.submit([&](cl::sycl::handler &cgh) {
+    cl::sycl::event submitted = dev.submit([&](cl::sycl::handler &cgh) {
 
       /// creating global accessors on all input output buffers
       auto global_accessor_tuple = extract_accessors(cgh, expr);
@@ -76,11 +185,13 @@ class Device_<backend::sycl, dv> {
 
       cgh.parallel_for<Expr>(
           cl::sycl::nd_range<Expr::Type::Dim>(
-              visioncpp::internal::get_range<Expr::Type::Dim>(RGT, CGT),
+              visioncpp::internal::get_range<Expr::Type::Dim>(rGThreads,
+                                                              cGThreads),
               visioncpp::internal::get_range<Expr::Type::Dim>(RLT, CLT)),
           [=](cl::sycl::nd_item<Expr::Type::Dim> itemID) {
             /// creating the index access for each thread
-            auto cOffset = visioncpp::internal::memLocation<LC, LR>(itemID);
+            auto cOffset = visioncpp::internal::memLocation<LC, LR, VecWidth>(
+                itemID, cols, rows);
 
             /// creating the eval expression for evaluating the expression
             /// tree. The output now moved to the front so the Output_offset
@@ -89,7 +200,65 @@ class Device_<backend::sycl, dv> {
                                                              device_tuple);
           });
     });
+    last_submitted->set(submitted);
+    dev.throw_asynchronous();
+    if (prof) {
+      record<LC, LR, CLT, RLT>(expr, cGThreads, rGThreads, submitted);
+    }
+  }
+  /// \brief executes the expression on a batch of images. The images are the
+  /// third dimension of the nd_range, so one kernel processes the whole batch.
+  /// Each thread moves the accessors to the image of its workgroup.
+  /// template parameters:
+  /// \tparam LC: the column size of the local memory
+  /// \tparam LR: the row size of the local memory
+  /// \tparam CLT: the column size of the workgroup
+  /// \tparam RLT: the row size of the workgroup
+  /// function parameters:
+  /// \param expr : the expression to execute
+  /// \param cGThreads : the total number of threads in the column dimension
+  /// \param rGThreads : the total number of threads in the row dimension
+  /// \param cols : the runtime column size of the dynamic nodes
+  /// \param rows : the runtime row size of the dynamic nodes
+  /// \param batch : the number of images of the batch
+  template <size_t LC, size_t LR, size_t CLT, size_t RLT, typename Expr>
+  void execute_batch(Expr &expr, size_t cGThreads, size_t rGThreads,
+                     size_t cols, size_t rows, size_t batch) const {
+    constexpr size_t TotalLeaves = LeafCount<Expr::ND_Category, Expr>::Count;
+    using placeHolderExprType =
+        typename MakePlaceHolderExprHelper<Expr::ND_Category, Expr,
+                                           TotalLeaves - 1>::Type;
+
+    cl::sycl::event submitted = dev.submit([&](cl::sycl::handler &cgh) {
+      /// creating global accessors on all input output buffers. They are
+      /// offset by each thread to the image it processes.
+      auto global_accessor_tuple =
+          batch_accessors(expr, extract_accessors(cgh, expr));
+      auto device_only_accessor_tuple =
+          create_local_accessors<LC, LR, Expr>(cgh);
+      constexpr size_t Output_offset =
+          tools::tuple::size(global_accessor_tuple);
+
+      cgh.parallel_for<BatchKernel<Expr>>(
+          cl::sycl::nd_range<3>(
+              visioncpp::internal::get_batch_range(rGThreads, cGThreads, batch),
+              visioncpp::internal::get_batch_range(RLT, CLT, 1)),
+          [=](cl::sycl::nd_item<3> itemID) {
+            auto cOffset = visioncpp::internal::memLocation<LC, LR, VecWidth>(
+                itemID, cols, rows);
+            auto device_tuple = tools::tuple::append(
+                batch_at(global_accessor_tuple,
+                         itemID.get_group(mem_dim::BatchDim)),
+                device_only_accessor_tuple);
+            eval<Output_offset, LC, LR, placeHolderExprType>(cOffset,
+                                                             device_tuple);
+          });
+    });
+    last_submitted->set(submitted);
     dev.throw_asynchronous();
+    if (prof) {
+      record<LC, LR, CLT, RLT>(expr, cGThreads, rGThreads, submitted);
+    }
   }
 };
 }  // namespace internal
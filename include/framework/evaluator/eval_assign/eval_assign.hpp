@@ -57,8 +57,70 @@ struct Evaluator<internal::ops_category::NeighbourOP, OutputIndex, Offset, LC,
   }
 };
 
+/// \struct AssignVector
+/// \brief AssignVector evaluates the columns of a thread W at a time when the
+/// root is a point operation. The LC columns of the tile are cut in LC / W
+/// vectors of W consecutive columns, and the thread l_c takes the vectors
+/// l_c, l_c + cLRng, l_c + 2 * cLRng..., so the workgroup covers the same
+/// columns as in the scalar loop. When there are fewer vectors than threads
+/// in a row of the workgroup, the last threads have no column. The last
+/// columns of the image which do not fill the W lanes are evaluated one by
+/// one.
+/// template parameters:
+/// \tparam W: the number of consecutive columns evaluated at once
+/// \tparam LC: the column size of the workgroup tile
+/// \tparam LR: the row size of the workgroup tile
+/// \tparam LHS: the output leaf node
+/// \tparam RHS: the point operation expression
+/// \tparam ElementType: the pixel type of the output memory
+/// \tparam Loc: Coordinate of accessing a particular location
+/// \tparam Params: the input/output memories
+template <size_t W, size_t LC, size_t LR, typename LHS, typename RHS,
+          typename ElementType, typename Loc, typename... Params>
+struct AssignVector {
+  static inline void eval(Loc &cOffset, const tools::tuple::Tuple<Params...> &t,
+                          size_t cols, size_t rows) {
+    using RHS_Eval_Expr = EvalExpr<RHS, Loc, Params...>;
+    using LHS_Eval_Expr = EvalExpr<LHS, Loc, Params...>;
+    // the first column of the workgroup
+    const size_t first = cOffset.g_c - cOffset.l_c;
+    for (size_t i = cOffset.l_c * W; i < LC; i += cOffset.cLRng * W)
+      if (first + i < cols)
+        for (size_t j = 0; j < LR; j += cOffset.rLRng)
+          if (cOffset.g_r + j < rows) {
+            cOffset.pointOp_gc = first + i;
+            cOffset.pointOp_gr = cOffset.g_r + j;
+            auto out = LHS_Eval_Expr::get_accessor(t).get_pointer() +
+                       calculate_index(first + i, cOffset.g_r + j, cols, rows);
+            if (first + i + W <= cols) {
+              auto pack = EvalVector<RHS, W, Loc, Params...>::eval(cOffset, t);
+              for (size_t l = 0; l < W; l++) {
+                out[l] = tools::convert<ElementType>(pack.lane[l]);
+              }
+            } else {
+              for (size_t l = 0; first + i + l < cols; l++) {
+                cOffset.pointOp_gc = first + i + l;
+                out[l] = tools::convert<ElementType>(
+                    RHS_Eval_Expr::eval_point(cOffset, t));
+              }
+            }
+          }
+  }
+};
+/// \brief specialisation of the AssignVector when the point operations are
+/// not vectorised. It is never called.
+template <size_t LC, size_t LR, typename LHS, typename RHS,
+          typename ElementType, typename Loc, typename... Params>
+struct AssignVector<1, LC, LR, LHS, RHS, ElementType, Loc, Params...> {
+  static inline void eval(Loc &, const tools::tuple::Tuple<Params...> &,
+                          size_t, size_t) {}
+};
+
 /// \brief Partial specialisation of the Evaluator when the expression is an
 /// internal::Assign expression and the internal::ops_category is PointOP.
+/// When the coordinate has a vector width W and the LC columns of the tile are
+/// made of whole vectors, i.e. LC % W == 0, the columns are evaluated W at a
+/// time by AssignVector, whatever the number of threads of the workgroup.
 template <size_t Output_Index, size_t Offset, size_t LC, size_t LR,
           typename LHS, typename RHS, size_t Cols, size_t Rows, size_t LfType,
           size_t LVL, typename Loc, typename... Params>
@@ -74,15 +136,24 @@ struct Evaluator<internal::ops_category::PointOP, Output_Index, Offset, LC, LR,
     using ElementType =
         typename MemoryTrait<Expr::LeafType,
                              decltype(tools::tuple::get<0>(t))>::Type;
+    // the output size, the runtime size is used when it is dynamic
+    const size_t cols = extent<Expr::Type::Cols>(cOffset.cols);
+    const size_t rows = extent<Expr::Type::Rows>(cOffset.rows);
+    constexpr size_t W = Loc::VecWidth;
+    if (W > 1 && LC % W == 0) {
+      AssignVector<W, LC, LR, LHS, RHS, ElementType, Loc, Params...>::eval(
+          cOffset, t, cols, rows);
+      return;
+    }
     for (int i = 0; i < LC; i += cOffset.cLRng)
-      if (cOffset.g_c + i < Expr::Type::Cols)
+      if (cOffset.g_c + i < cols)
         for (int j = 0; j < LR; j += cOffset.rLRng)
-          if (cOffset.g_r + j < Expr::Type::Rows) {
+          if (cOffset.g_r + j < rows) {
             cOffset.pointOp_gc = cOffset.g_c + i;
             cOffset.pointOp_gr = cOffset.g_r + j;
             *(LHS_Eval_Expr::get_accessor(t).get_pointer() +
-              calculate_index(cOffset.g_c + i, cOffset.g_r + j,
-                              Expr::Type::Cols, Expr::Type::Rows)) =
+              calculate_index(cOffset.g_c + i, cOffset.g_r + j, cols,
+                              rows)) =
                 tools::convert<ElementType>(
                     RHS_Eval_Expr::eval_point(cOffset, t));
           }
@@ -102,17 +102,18 @@ struct Evaluator<ops_category::NeighbourOP, OutputIndex, Offset, LC, LR,
     static_assert(RHS_LR_Ratio == LR_Ratio && RHS_LC_Ratio == LC_Ratio,
                   "You made a programing mistake. The kernel must break when "
                   "the two are not equal");
-    if ((cOffset.l_c < (cOffset.cLRng / LC_Ratio)) &&
-        (cOffset.l_r < (cOffset.rLRng / LR_Ratio))) {
+    if ((cOffset.l_c < ratio_step(cOffset.cLRng, LC_Ratio)) &&
+        (cOffset.l_r < ratio_step(cOffset.rLRng, LR_Ratio))) {
       size_t g_c = ((cOffset.g_c - cOffset.l_c) / LC_Ratio) + cOffset.l_c;
       size_t g_r = ((cOffset.g_r - cOffset.l_r) / LR_Ratio) + cOffset.l_r;
 
-      for (int i = 0; i < LC / LC_Ratio; i += (cOffset.cLRng / LC_Ratio)) {
+      for (int i = 0; i < LC / LC_Ratio;
+           i += ratio_step(cOffset.cLRng, LC_Ratio)) {
         if (get_compare<isLocal, LC / RHS_LC_Ratio, RHS::Type::Cols>(
                 cOffset.l_c, i, g_c) &&
             (g_c + i + OffsetColOut < LHS::Type::Cols)) {
           for (size_t j = 0; j < LR / LR_Ratio;
-               j += (cOffset.rLRng / LR_Ratio)) {
+               j += ratio_step(cOffset.rLRng, LR_Ratio)) {
             if (get_compare<isLocal, LR / LR_Ratio, RHS::Type::Rows>(
                     cOffset.l_r, j, g_r) &&
                 (g_r + j + OffsetRowOut < LHS::Type::Rows)) {
@@ -48,7 +48,7 @@ struct EvalExpr<Assign<LHS, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
             size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t LR, typename Border = border::Replicate>
   static auto eval_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -57,26 +57,31 @@ struct EvalExpr<Assign<LHS, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
     constexpr bool isLocal =
         Trait<typename tools::RemoveAll<decltype(
             LHS_Eval_Expr::get_accessor(t))>::Type>::scope == scope::Local;
+    static_assert(Cols != dynamic && Rows != dynamic,
+                  "An assign node nested inside an expression requires "
+                  "compile time Cols and Rows");
     constexpr size_t LC_Ratio = RHS::CThread / Cols;
     constexpr size_t LR_Ratio = RHS::RThread / Rows;
     // lhs expression shared mem
     auto nested_accessor =
         RHS_Eval_Expr::template eval_neighbour<IsRoot, Halo_Top, Halo_Left,
                                                Halo_Butt, Halo_Right, Offset,
-                                               Index, LC, LR>(cOffset, t);
+                                               Index, LC, LR, Border>(cOffset,
+                                                                      t);
     constexpr bool isLocal_nested =
         Trait<typename tools::RemoveAll<decltype(
             nested_accessor)>::Type>::scope == scope::Local;
     auto rhs_acc = nested_accessor.get_pointer();
     auto lhs_acc = LHS_Eval_Expr::get_accessor(t).get_pointer();
-    if ((cOffset.l_c < (cOffset.cLRng / LC_Ratio)) &&
-        (cOffset.l_r < (cOffset.rLRng / LR_Ratio))) {
+    if ((cOffset.l_c < ratio_step(cOffset.cLRng, LC_Ratio)) &&
+        (cOffset.l_r < ratio_step(cOffset.rLRng, LR_Ratio))) {
       size_t g_c = ((cOffset.g_c - cOffset.l_c) / LC_Ratio) + cOffset.l_c;
       size_t g_r = ((cOffset.g_r - cOffset.l_r) / LR_Ratio) + cOffset.l_r;
-      for (int i = 0; i < LC / LC_Ratio; i += (cOffset.cLRng / LC_Ratio)) {
+      for (int i = 0; i < LC / LC_Ratio;
+           i += ratio_step(cOffset.cLRng, LC_Ratio)) {
         if (get_compare<isLocal, LC / LC_Ratio, Cols>(cOffset.l_c, i, g_c)) {
           for (size_t j = 0; j < LR / LR_Ratio;
-               j += (cOffset.rLRng / LR_Ratio)) {
+               j += ratio_step(cOffset.rLRng, LR_Ratio)) {
             if (get_compare<isLocal, LR / LR_Ratio, Rows>(cOffset.l_r, j,
                                                           g_r)) {
               lhs_acc[calculate_index(id_val<isLocal>(cOffset.l_c, g_c) + i,
@@ -0,0 +1,166 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file eval_expr_histogram.hpp
+/// \brief This file contains the specialisations of the EvalExpr for
+/// Histogram (histogram node).
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_HISTOGRAM_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_HISTOGRAM_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief Partial specialisation of the EvalExpr when the expression is the
+/// first kernel of a Histogram. The column dimension of the kernel is the
+/// unit of a tile and the row dimension is the tile. The unit u of a tile
+/// counts the pixels u, u + Units, u + 2 * Units ... of the tile in row major
+/// order. Each workgroup counts whole groups of GroupUnits units, one after
+/// the other: the threads share the units of the group, the LR tiles of the
+/// workgroup have their bins in local memory and the bins are written in the
+/// row of the group.
+template <typename HistOP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, typename Loc, typename... Params>
+struct EvalExpr<
+    Histogram<HistOP, reduce_stage::Partial, RHS, Cols, Rows, LfType, LVL>,
+    Loc, Params...> {
+  /// \brief evaluate function when the internal::ops_category is
+  /// GlobalNeighbourOP.
+  template <bool IsRoot, size_t Offset, size_t Index, size_t LC, size_t LR>
+  static auto eval_global_neighbour(Loc &cOffset,
+                                    const tools::tuple::Tuple<Params...> &t)
+      -> decltype(
+          tools::tuple::get<OutputLocation<IsRoot, Offset + Index - 1>::ID>(
+              t)) {
+    constexpr size_t OutOffset = OutputLocation<IsRoot, Offset + Index - 1>::ID;
+    constexpr size_t Bins = HistOP::Bins;
+    constexpr size_t Units = HistOP::Units;
+    constexpr size_t GroupUnits = HistOP::GroupUnits;
+    constexpr size_t Groups = HistOP::Groups;
+    constexpr size_t TileCols = HistOP::TileCols;
+    constexpr size_t TileRows = HistOP::TileRows;
+    constexpr size_t TilesC = RHS::Type::Cols / TileCols;
+    // the kernel has one workgroup for each LC units
+    constexpr size_t Workgroups = (Units + LC - 1) / LC;
+    auto output = tools::tuple::get<OutOffset>(t).get_pointer();
+    // the local memory of the bins is the only one of the kernel
+    auto bins = tools::tuple::get<Offset>(t).get_pointer();
+    const size_t span = (LC / cOffset.cLRng) * cOffset.cLRng;
+    const size_t workgroup = (cOffset.g_c - cOffset.l_c) / span;
+    for (size_t g = workgroup; g < Groups; g += Workgroups) {
+      for (size_t j = cOffset.l_r; j < LR; j += cOffset.rLRng) {
+        for (size_t b = cOffset.l_c; b < Bins; b += cOffset.cLRng) {
+          bins[j * Bins + b] = 0;
+        }
+      }
+      cOffset.barrier();
+      for (size_t j = 0; j < LR; j += cOffset.rLRng) {
+        const size_t tile = cOffset.g_r + j;
+        if (tile < HistOP::Tiles) {
+          const size_t origin_c = (tile % TilesC) * TileCols;
+          const size_t origin_r = (tile / TilesC) * TileRows;
+          auto tile_bins = bins + (cOffset.l_r + j) * Bins;
+          for (size_t k = cOffset.l_c; k < GroupUnits; k += cOffset.cLRng) {
+            const size_t u = g * GroupUnits + k;
+            if (u < Units) {
+              size_t c = u % TileCols;
+              size_t r = u / TileCols;
+              while (r < TileRows) {
+                cOffset.pointOp_gc = origin_c + c;
+                cOffset.pointOp_gr = origin_r + r;
+                cl::sycl::atomic<unsigned int,
+                                 cl::sycl::access::address_space::local_space>(
+                    tile_bins +
+                    HistOP::bin(tools::convert<typename HistOP::InType>(
+                        EvalExpr<RHS, Loc, Params...>::eval_point(cOffset,
+                                                                  t))))
+                    .fetch_add(1u);
+                // the next pixel of the unit is Units pixels further
+                c += Units % TileCols;
+                r += Units / TileCols;
+                if (c >= TileCols) {
+                  c -= TileCols;
+                  r++;
+                }
+              }
+            }
+          }
+        }
+      }
+      cOffset.barrier();
+      for (size_t j = 0; j < LR; j += cOffset.rLRng) {
+        const size_t tile = cOffset.g_r + j;
+        if (tile < HistOP::Tiles) {
+          auto tile_bins = bins + (cOffset.l_r + j) * Bins;
+          for (size_t b = cOffset.l_c; b < Bins; b += cOffset.cLRng) {
+            output[(tile * Groups + g) * Bins + b] =
+                static_cast<unsigned int>(tile_bins[b]);
+          }
+        }
+      }
+      // the bins are cleared for the next group once they are all written
+      cOffset.barrier();
+    }
+    return tools::tuple::get<OutOffset>(t);
+  }
+};
+
+/// \brief Partial specialisation of the EvalExpr when the expression is the
+/// second kernel of a Histogram. Each thread sums one bin of the partial
+/// histograms of one tile. Neighbour threads read neighbour bins.
+template <typename HistOP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, typename Loc, typename... Params>
+struct EvalExpr<
+    Histogram<HistOP, reduce_stage::Final, RHS, Cols, Rows, LfType, LVL>, Loc,
+    Params...> {
+  /// \brief evaluate function when the internal::ops_category is
+  /// GlobalNeighbourOP.
+  template <bool IsRoot, size_t Offset, size_t Index, size_t LC, size_t LR>
+  static auto eval_global_neighbour(Loc &cOffset,
+                                    const tools::tuple::Tuple<Params...> &t)
+      -> decltype(
+          tools::tuple::get<OutputLocation<IsRoot, Offset + Index - 1>::ID>(
+              t)) {
+    constexpr size_t OutOffset = OutputLocation<IsRoot, Offset + Index - 1>::ID;
+    constexpr size_t Bins = HistOP::Bins;
+    constexpr size_t Groups = HistOP::Groups;
+    auto input = EvalExpr<RHS, Loc, Params...>::template eval_global_neighbour<
+                     false, Offset, Index - 1, LC, LR>(cOffset, t)
+                     .get_pointer();
+    auto output = tools::tuple::get<OutOffset>(t).get_pointer();
+    for (size_t j = 0; j < LR; j += cOffset.rLRng) {
+      const size_t tile = cOffset.g_r + j;
+      if (tile < HistOP::Tiles) {
+        for (size_t i = 0; i < LC; i += cOffset.cLRng) {
+          const size_t b = cOffset.g_c + i;
+          if (b < Bins) {
+            unsigned int count = 0;
+            for (size_t g = 0; g < Groups; g++) {
+              count += input[(tile * Groups + g) * Bins + b];
+            }
+            output[tile * Bins + b] = count;
+          }
+        }
+      }
+    }
+    return tools::tuple::get<OutOffset>(t);
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_HISTOGRAM_HPP_
@@ -44,12 +44,13 @@ struct EvalExpr<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
       tools::tuple::get<N>(t)
           .get_pointer()[cOffset.pointOp_gc + (Cols * cOffset.pointOp_gr)]) {
     return tools::tuple::get<N>(t).get_pointer()[calculate_index(
-        cOffset.pointOp_gc, cOffset.pointOp_gr, Cols, Rows)];
+        cOffset.pointOp_gc, cOffset.pointOp_gr, extent<Cols>(cOffset.cols),
+        extent<Rows>(cOffset.rows))];
   }
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
             size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t LR, typename Border = border::Replicate>
   static inline auto eval_neighbour(Loc &cOffset,
                                     const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -61,7 +62,7 @@ struct EvalExpr<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
         Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
         Index_Finder<N, OutputLocation<IsRoot, Offset + Index - 1>::ID,
                      Memory_Type, Sc>::Index,
-        LC, LR, Expr>(cOffset, t);
+        LC, LR, Expr, Border>(cOffset, t);
     return tools::tuple::get<
         Index_Finder<N, OutputLocation<IsRoot, Offset + Index - 1>::ID,
                      Memory_Type, Sc>::Index>(t);
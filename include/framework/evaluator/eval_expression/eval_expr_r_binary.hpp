@@ -44,7 +44,7 @@ struct EvalExpr<RBiOP<BI_OP, LHS, RHS, Cols, Rows, LfType, LVL>, Loc,
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
             size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t LR, typename Border = border::Replicate>
   static auto eval_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -59,24 +59,29 @@ struct EvalExpr<RBiOP<BI_OP, LHS, RHS, Cols, Rows, LfType, LVL>, Loc,
 
     auto lhs_acc = EvalExpr<LHS, Loc, Params...>::template eval_neighbour<
                        false, Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
-                       Offset, Index - 1 - RHSCount, LC, LR>(cOffset, t)
+                       Offset, Index - 1 - RHSCount, LC, LR, Border>(
+                       cOffset, t)
                        .get_pointer();
     auto rhs_acc = EvalExpr<RHS, Loc, Params...>::template eval_neighbour<
                        false, Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
-                       Offset, Index - 1, LC, LR>(cOffset, t)
+                       Offset, Index - 1, LC, LR, Border>(cOffset, t)
                        .get_pointer();
+    // the output size of the node, the runtime size is used when it is dynamic
+    const size_t cols = extent<Cols>(cOffset.cols);
+    const size_t rows = extent<Rows>(cOffset.rows);
     // eval the RBiOP
     for (int i = 0; i < LC; i += cOffset.cLRng) {
-      if (get_compare<isLocal, LC, Cols>(cOffset.l_c, i, cOffset.g_c)) {
+      if (get_compare<isLocal, LC, Cols>(cOffset.l_c, i, cOffset.g_c, cols)) {
         for (int j = 0; j < LR; j += cOffset.rLRng) {
-          if (get_compare<isLocal, LR, Rows>(cOffset.l_r, j, cOffset.g_r)) {
+          if (get_compare<isLocal, LR, Rows>(cOffset.l_r, j, cOffset.g_r,
+                                             rows)) {
             size_t child_index =
                 calculate_index(cOffset.l_c + i, cOffset.l_r + j, LC, LR);
             *(tools::tuple::get<OutOffset>(t).get_pointer() +
               calculate_index(id_val<isLocal>(cOffset.l_c, cOffset.g_c) + i,
                               id_val<isLocal>(cOffset.l_r, cOffset.g_r) + j,
-                              id_val<isLocal>(LC, Cols),
-                              id_val<isLocal>(LR, Rows))) =
+                              id_val<isLocal>(LC, cols),
+                              id_val<isLocal>(LR, rows))) =
                 tools::convert<typename MemoryTrait<
                     LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type>(
                     typename BI_OP::OP()(*(lhs_acc + child_index),
@@ -0,0 +1,148 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file eval_expr_reduce.hpp
+/// \brief This file contains the specialisations of the EvalExpr for Reduce
+/// (whole image reduction node).
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_REDUCE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_REDUCE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief Partial specialisation of the EvalExpr when the expression is the
+/// first kernel of a Reduce. The partial value u is the reduction of the
+/// pixels u, u + Cols, u + 2 * Cols ... of the input in row major order, so
+/// neighbour threads read neighbour pixels. The input is evaluated as a point
+/// operation at each pixel.
+template <typename ReduceOP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, typename Loc, typename... Params>
+struct EvalExpr<
+    Reduce<ReduceOP, reduce_stage::Partial, RHS, Cols, Rows, LfType, LVL>, Loc,
+    Params...> {
+  using AccType = typename ReduceOP::AccType;
+  /// \brief evaluate function when the internal::ops_category is
+  /// GlobalNeighbourOP.
+  template <bool IsRoot, size_t Offset, size_t Index, size_t LC, size_t LR>
+  static auto eval_global_neighbour(Loc &cOffset,
+                                    const tools::tuple::Tuple<Params...> &t)
+      -> decltype(
+          tools::tuple::get<OutputLocation<IsRoot, Offset + Index - 1>::ID>(
+              t)) {
+    constexpr size_t OutOffset = OutputLocation<IsRoot, Offset + Index - 1>::ID;
+    constexpr size_t InCols = RHS::Type::Cols;
+    constexpr size_t InRows = RHS::Type::Rows;
+    using ElementType = typename MemoryTrait<
+        LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type;
+    auto output = tools::tuple::get<OutOffset>(t).get_pointer();
+    typename ReduceOP::OP op;
+    for (size_t i = 0; i < LC; i += cOffset.cLRng) {
+      const size_t u = cOffset.g_c + i;
+      if (u < Cols) {
+        cOffset.pointOp_gc = u % InCols;
+        cOffset.pointOp_gr = u / InCols;
+        AccType acc = op.map(
+            tools::convert<typename ReduceOP::InType>(
+                EvalExpr<RHS, Loc, Params...>::eval_point(cOffset, t)),
+            cOffset.pointOp_gc, cOffset.pointOp_gr);
+        // the next pixel of the unit is Cols pixels further
+        for (;;) {
+          cOffset.pointOp_gc += Cols % InCols;
+          cOffset.pointOp_gr += Cols / InCols;
+          if (cOffset.pointOp_gc >= InCols) {
+            cOffset.pointOp_gc -= InCols;
+            cOffset.pointOp_gr++;
+          }
+          if (cOffset.pointOp_gr >= InRows) {
+            break;
+          }
+          op.reduce(acc,
+                    op.map(tools::convert<typename ReduceOP::InType>(
+                               EvalExpr<RHS, Loc, Params...>::eval_point(
+                                   cOffset, t)),
+                           cOffset.pointOp_gc, cOffset.pointOp_gr));
+        }
+        output[u] = tools::convert<ElementType>(acc);
+      }
+    }
+    return tools::tuple::get<OutOffset>(t);
+  }
+};
+
+/// \brief Partial specialisation of the EvalExpr when the expression is the
+/// second kernel of a Reduce. Only the first workgroup of the kernel works:
+/// each of its threads combines the partial values one workgroup apart, then
+/// the values of the threads are combined by a tree reduction in local memory
+/// and the first thread writes the result.
+template <typename ReduceOP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, typename Loc, typename... Params>
+struct EvalExpr<
+    Reduce<ReduceOP, reduce_stage::Final, RHS, Cols, Rows, LfType, LVL>, Loc,
+    Params...> {
+  using AccType = typename ReduceOP::AccType;
+  /// \brief evaluate function when the internal::ops_category is
+  /// GlobalNeighbourOP.
+  template <bool IsRoot, size_t Offset, size_t Index, size_t LC, size_t LR>
+  static auto eval_global_neighbour(Loc &cOffset,
+                                    const tools::tuple::Tuple<Params...> &t)
+      -> decltype(
+          tools::tuple::get<OutputLocation<IsRoot, Offset + Index - 1>::ID>(
+              t)) {
+    constexpr size_t OutOffset = OutputLocation<IsRoot, Offset + Index - 1>::ID;
+    constexpr size_t Units = RHS::Type::Cols;
+    using ElementType = typename MemoryTrait<
+        LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type;
+    auto input = EvalExpr<RHS, Loc, Params...>::template eval_global_neighbour<
+                     false, Offset, Index - 1, LC, LR>(cOffset, t)
+                     .get_pointer();
+    auto output = tools::tuple::get<OutOffset>(t).get_pointer();
+    // the local memory of the tree is the only one of the kernel
+    auto tree = tools::tuple::get<Offset>(t).get_pointer();
+    typename ReduceOP::OP op;
+    const bool first_group = (cOffset.g_c == cOffset.l_c);
+    const size_t id = cOffset.l_c;
+    const size_t threads = cOffset.cLRng;
+    if (first_group) {
+      AccType acc = input[id];
+      for (size_t k = id + threads; k < Units; k += threads) {
+        op.reduce(acc, AccType(input[k]));
+      }
+      tree[id] = acc;
+    }
+    cOffset.barrier();
+    size_t step = 1;
+    while (step < threads) {
+      step <<= 1;
+    }
+    for (step >>= 1; step > 0; step >>= 1) {
+      if (first_group && id < step && id + step < threads) {
+        op.reduce(tree[id], tree[id + step]);
+      }
+      cOffset.barrier();
+    }
+    if (first_group && id == 0) {
+      output[0] = tools::convert<ElementType>(
+          op.result(tree[0], ReduceOP::Pixels));
+    }
+    return tools::tuple::get<OutOffset>(t);
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_REDUCE_HPP_
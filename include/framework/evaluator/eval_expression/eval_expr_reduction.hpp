@@ -36,7 +36,7 @@ struct EvalExpr<RDCN<C_OP, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
             size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t LR, typename Border = border::Replicate>
   static auto eval_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -51,10 +51,11 @@ struct EvalExpr<RDCN<C_OP, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
     // lhs expression shared mem
     auto nested_acc = EvalExpr<RHS, Loc, Params...>::template eval_neighbour<
                           false, Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
-                          Offset, Index - 1, LC, LR>(cOffset, t).get_pointer();
+                          Offset, Index - 1, LC, LR, Border>(cOffset, t)
+                          .get_pointer();
 
-    if ((cOffset.l_c < (cOffset.cLRng / LC_Ratio)) &&
-        (cOffset.l_r < (cOffset.rLRng / LR_Ratio))) {
+    if ((cOffset.l_c < ratio_step(cOffset.cLRng, LC_Ratio)) &&
+        (cOffset.l_r < ratio_step(cOffset.rLRng, LR_Ratio))) {
       static constexpr size_t Neighbour_LC_Ratio =
           LC_Ratio / (RHS::Type::Cols / Cols);
       static constexpr size_t Neighbour_LR_Ratio =
@@ -64,10 +65,11 @@ struct EvalExpr<RDCN<C_OP, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
       size_t g_c = ((cOffset.g_c - cOffset.l_c) / LC_Ratio) + cOffset.l_c;
       size_t g_r = ((cOffset.g_r - cOffset.l_r) / LR_Ratio) + cOffset.l_r;
 
-      for (int i = 0; i < LC / LC_Ratio; i += (cOffset.cLRng / LC_Ratio)) {
+      for (int i = 0; i < LC / LC_Ratio;
+           i += ratio_step(cOffset.cLRng, LC_Ratio)) {
         if (get_compare<isLocal, LC / LC_Ratio, Cols>(cOffset.l_c, i, g_c)) {
           for (size_t j = 0; j < LR / LR_Ratio;
-               j += (cOffset.rLRng / LR_Ratio)) {
+               j += ratio_step(cOffset.rLRng, LR_Ratio)) {
             if (get_compare<isLocal, LR / LR_Ratio, Rows>(cOffset.l_r, j,
                                                           g_r)) {
               neighbour.set_offset((cOffset.l_c + i), (cOffset.l_r + j));
@@ -0,0 +1,101 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file eval_expr_resize.hpp
+/// \brief This file contains the specialisation of the EvalExpr for
+/// Resize (resize operation).
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_RESIZE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_RESIZE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief Partial specialisation of the EvalExpr when the expression is
+/// a Resize expression. The input is always a leaf node, so it is read
+/// directly from its accessor.
+template <typename RSZ_OP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, typename Loc, typename... Params>
+struct EvalExpr<Resize<RSZ_OP, RHS, Cols, Rows, LfType, LVL>, Loc,
+                Params...> {
+  /// \brief evaluate function when the internal::ops_category is PointOP.
+  static typename RSZ_OP::OutType
+  eval_point(Loc &cOffset, const tools::tuple::Tuple<Params...> &t) {
+    constexpr float ScaleC = static_cast<float>(RHS::Type::Cols) / Cols;
+    constexpr float ScaleR = static_cast<float>(RHS::Type::Rows) / Rows;
+    auto in_ptr = EvalExpr<RHS, Loc, Params...>::get_accessor(t).get_pointer();
+    auto in = GlobalNeighbour<typename RSZ_OP::InType>(in_ptr, RHS::Type::Cols,
+                                                       RHS::Type::Rows);
+    in.set_offset(cOffset.pointOp_gc, cOffset.pointOp_gr);
+    return typename RSZ_OP::OP()(in, ScaleC, ScaleR);
+  }
+  /// \brief evaluate function when the internal::ops_category is NeighbourOP.
+  template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
+            size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
+            size_t LR, typename Border = border::Replicate>
+  static auto eval_neighbour(Loc &cOffset,
+                             const tools::tuple::Tuple<Params...> &t)
+      -> decltype(
+          tools::tuple::get<OutputLocation<IsRoot, Offset + Index - 1>::ID>(
+              t)) {
+    constexpr size_t OutOffset = OutputLocation<IsRoot, Offset + Index - 1>::ID;
+    constexpr bool isLocal =
+        Trait<typename tools::RemoveAll<decltype(
+            tools::tuple::get<OutOffset>(t))>::Type>::scope == scope::Local;
+    constexpr float ScaleC = static_cast<float>(RHS::Type::Cols) / Cols;
+    constexpr float ScaleR = static_cast<float>(RHS::Type::Rows) / Rows;
+    auto in_ptr = EvalExpr<RHS, Loc, Params...>::get_accessor(t).get_pointer();
+    auto in = GlobalNeighbour<typename RSZ_OP::InType>(in_ptr, RHS::Type::Cols,
+                                                       RHS::Type::Rows);
+    for (int i = 0; i < LC; i += cOffset.cLRng) {
+      if (get_compare<isLocal, LC, Cols>(cOffset.l_c, i, cOffset.g_c)) {
+        for (int j = 0; j < LR; j += cOffset.rLRng) {
+          if (get_compare<isLocal, LR, Rows>(cOffset.l_r, j, cOffset.g_r)) {
+            // the output pixel of the local element, the halo of the local
+            // memory is clamped to the output
+            in.set_offset(
+                border_index<border::Replicate>(
+                    static_cast<int>(cOffset.g_c + i) -
+                        static_cast<int>(Halo_Left),
+                    Cols),
+                border_index<border::Replicate>(
+                    static_cast<int>(cOffset.g_r + j) -
+                        static_cast<int>(Halo_Top),
+                    Rows));
+            *(tools::tuple::get<OutOffset>(t).get_pointer() +
+              calculate_index(id_val<isLocal>(cOffset.l_c, cOffset.g_c) + i,
+                              id_val<isLocal>(cOffset.l_r, cOffset.g_r) + j,
+                              id_val<isLocal>(LC, Cols),
+                              id_val<isLocal>(LR, Rows))) =
+                tools::convert<typename MemoryTrait<
+                    LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type>(
+                    typename RSZ_OP::OP()(in, ScaleC, ScaleR));
+          }
+        }
+      }
+    }
+
+    // here you need to put a local barrier
+    cOffset.barrier();
+    // return the valid neighbour area for your parent
+    return tools::tuple::get<OutOffset>(t);
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_RESIZE_HPP_
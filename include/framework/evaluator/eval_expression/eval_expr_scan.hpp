@@ -0,0 +1,145 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file eval_expr_scan.hpp
+/// \brief This file contains the specialisations of the EvalExpr for Scan
+/// (prefix sum node).
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_SCAN_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_SCAN_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief Partial specialisation of the EvalExpr when the expression is a Scan
+/// of the rows. Each workgroup scans LR rows from their first to their last
+/// column. The rows are loaded chunk by chunk in local memory, where the
+/// threads read and write consecutive columns, and each row of the chunk is
+/// then summed sequentially starting from the sum carried over from the
+/// previous chunk. Every pixel is read and written once.
+template <typename InTp, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, typename Loc, typename... Params>
+struct EvalExpr<
+    Scan<ScanOp<mem_dim::ColDim, InTp>, RHS, Cols, Rows, LfType, LVL>, Loc,
+    Params...> {
+  using C_OP = ScanOp<mem_dim::ColDim, InTp>;
+  using OutType = typename C_OP::OutType;
+  /// \brief evaluate function when the internal::ops_category is
+  /// GlobalNeighbourOP.
+  template <bool IsRoot, size_t Offset, size_t Index, size_t LC, size_t LR>
+  static auto eval_global_neighbour(Loc &cOffset,
+                                    const tools::tuple::Tuple<Params...> &t)
+      -> decltype(
+          tools::tuple::get<OutputLocation<IsRoot, Offset + Index - 1>::ID>(
+              t)) {
+    constexpr size_t OutOffset = OutputLocation<IsRoot, Offset + Index - 1>::ID;
+    constexpr size_t Chunk = C_OP::Chunk;
+    // a row of the local memory ends with the sum carried to the next chunk
+    constexpr size_t Width = Chunk + 1;
+    using ElementType = typename MemoryTrait<
+        LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type;
+    auto input = EvalExpr<RHS, Loc, Params...>::template eval_global_neighbour<
+                     false, Offset, Index - 1, LC, LR>(cOffset, t)
+                     .get_pointer();
+    auto output = tools::tuple::get<OutOffset>(t).get_pointer();
+    // the local memory of the chunk is the only one of the kernel
+    auto chunk = tools::tuple::get<Offset>(t).get_pointer();
+    const size_t r0 = cOffset.g_r - cOffset.l_r;
+    const size_t id = cOffset.l_c + cOffset.cLRng * cOffset.l_r;
+    const size_t threads = cOffset.cLRng * cOffset.rLRng;
+    for (size_t c0 = 0; c0 < Cols; c0 += Chunk) {
+      for (size_t k = id; k < Chunk * LR; k += threads) {
+        const size_t c = c0 + (k % Chunk);
+        const size_t r = r0 + (k / Chunk);
+        if (c < Cols && r < Rows) {
+          chunk[(k % Chunk) + Width * (k / Chunk)] =
+              input[calculate_index(c, r, Cols, Rows)];
+        }
+      }
+      cOffset.barrier();
+      for (size_t j = id; j < LR; j += threads) {
+        if (r0 + j < Rows) {
+          OutType sum = (c0 == 0) ? OutType() : chunk[Chunk + Width * j];
+          for (size_t i = 0; i < Chunk && c0 + i < Cols; i++) {
+            sum += chunk[i + Width * j];
+            chunk[i + Width * j] = sum;
+          }
+          chunk[Chunk + Width * j] = sum;
+        }
+      }
+      cOffset.barrier();
+      for (size_t k = id; k < Chunk * LR; k += threads) {
+        const size_t c = c0 + (k % Chunk);
+        const size_t r = r0 + (k / Chunk);
+        if (c < Cols && r < Rows) {
+          output[calculate_index(c, r, Cols, Rows)] =
+              tools::convert<ElementType>(
+                  chunk[(k % Chunk) + Width * (k / Chunk)]);
+        }
+      }
+      // the chunk is overwritten by the next load
+      cOffset.barrier();
+    }
+    return tools::tuple::get<OutOffset>(t);
+  }
+};
+
+/// \brief Partial specialisation of the EvalExpr when the expression is a Scan
+/// of the columns. Each thread sums its columns from the first to the last
+/// row. The threads of a workgroup read and write consecutive columns of the
+/// same row, so the accesses to the global memory are coalesced without the
+/// local memory.
+template <typename InTp, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, typename Loc, typename... Params>
+struct EvalExpr<
+    Scan<ScanOp<mem_dim::RowDim, InTp>, RHS, Cols, Rows, LfType, LVL>, Loc,
+    Params...> {
+  using C_OP = ScanOp<mem_dim::RowDim, InTp>;
+  using OutType = typename C_OP::OutType;
+  /// \brief evaluate function when the internal::ops_category is
+  /// GlobalNeighbourOP.
+  template <bool IsRoot, size_t Offset, size_t Index, size_t LC, size_t LR>
+  static auto eval_global_neighbour(Loc &cOffset,
+                                    const tools::tuple::Tuple<Params...> &t)
+      -> decltype(
+          tools::tuple::get<OutputLocation<IsRoot, Offset + Index - 1>::ID>(
+              t)) {
+    constexpr size_t OutOffset = OutputLocation<IsRoot, Offset + Index - 1>::ID;
+    using ElementType = typename MemoryTrait<
+        LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type;
+    auto input = EvalExpr<RHS, Loc, Params...>::template eval_global_neighbour<
+                     false, Offset, Index - 1, LC, LR>(cOffset, t)
+                     .get_pointer();
+    auto output = tools::tuple::get<OutOffset>(t).get_pointer();
+    for (size_t i = 0; i < LC; i += cOffset.cLRng) {
+      const size_t c = cOffset.g_c + i;
+      if (c < Cols) {
+        OutType sum = OutType();
+        for (size_t r = 0; r < Rows; r++) {
+          sum += input[calculate_index(c, r, Cols, Rows)];
+          output[calculate_index(c, r, Cols, Rows)] =
+              tools::convert<ElementType>(sum);
+        }
+      }
+    }
+    return tools::tuple::get<OutOffset>(t);
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_SCAN_HPP_
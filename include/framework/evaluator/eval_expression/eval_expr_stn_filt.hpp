@@ -37,7 +37,7 @@ struct EvalExpr<StnFilt<C_OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
             size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t LR, typename Border = border::Replicate>
   static auto eval_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -54,12 +54,13 @@ struct EvalExpr<StnFilt<C_OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
         EvalExpr<LHS, Loc, Params...>::template eval_neighbour<
             false, Halo_Top + Halo_T, Halo_Left + Halo_L, Halo_Butt + Halo_B,
             Halo_Right + Halo_R, Offset, Index - 1 - RHSCount,
-            LC + Halo_L + Halo_R, LR + Halo_T + Halo_B>(cOffset, t)
+            LC + Halo_L + Halo_R, LR + Halo_T + Halo_B,
+            typename C_OP::Border>(cOffset, t)
             .get_pointer();
     // rhs expression shared mem
     auto rhs_acc = EvalExpr<RHS, Loc, Params...>::template eval_neighbour<
                        false, Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
-                       Offset, Index - 1, LC, LR>(cOffset, t)
+                       Offset, Index - 1, LC, LR, Border>(cOffset, t)
                        .get_pointer();
 
     auto neighbour = LocalNeighbour<typename C_OP::InType1>(
@@ -67,17 +68,28 @@ struct EvalExpr<StnFilt<C_OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
     // filter for StnFilt
     auto filter = ConstNeighbour<typename C_OP::InType2>(
         rhs_acc, RHS::Type::Cols, RHS::Type::Rows);
+    // the output size of the node, the runtime size is used when it is dynamic
+    const size_t cols = extent<Cols>(cOffset.cols);
+    const size_t rows = extent<Rows>(cOffset.rows);
+    // the image pixel of the first element of the local memory, the tile of
+    // the workgroup being extended by the halos of this node and its parents
+    neighbour.set_image(static_cast<int>(cOffset.g_c - cOffset.l_c) -
+                            static_cast<int>(Halo_Left + Halo_L),
+                        static_cast<int>(cOffset.g_r - cOffset.l_r) -
+                            static_cast<int>(Halo_Top + Halo_T),
+                        cols, rows);
     for (int i = 0; i < LC; i += cOffset.cLRng) {
-      if (get_compare<isLocal, LC, Cols>(cOffset.l_c, i, cOffset.g_c)) {
+      if (get_compare<isLocal, LC, Cols>(cOffset.l_c, i, cOffset.g_c, cols)) {
         for (int j = 0; j < LR; j += cOffset.rLRng) {
-          if (get_compare<isLocal, LR, Rows>(cOffset.l_r, j, cOffset.g_r)) {
+          if (get_compare<isLocal, LR, Rows>(cOffset.l_r, j, cOffset.g_r,
+                                             rows)) {
             neighbour.set_offset(cOffset.l_c + Halo_L + i,
                                  cOffset.l_r + Halo_T + j);
             *(tools::tuple::get<OutOffset>(t).get_pointer() +
               calculate_index(id_val<isLocal>(cOffset.l_c, cOffset.g_c) + i,
                               id_val<isLocal>(cOffset.l_r, cOffset.g_r) + j,
-                              id_val<isLocal>(LC, Cols),
-                              id_val<isLocal>(LR, Rows))) =
+                              id_val<isLocal>(LC, cols),
+                              id_val<isLocal>(LR, rows))) =
                 tools::convert<typename MemoryTrait<
                     LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type>(
                     typename C_OP::OP()(neighbour, filter));
@@ -0,0 +1,89 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file eval_expr_vector.hpp
+/// \brief This file contains the EvalVector used to evaluate a point operation
+/// on the pixels of W consecutive columns at once, and its specialisations for
+/// RUnOP and RBiOP (pointwise unary and binary operation nodes).
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_VECTOR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_VECTOR_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief The EvalVector of any node other than RUnOP and RBiOP, e.g. a leaf
+/// node or a Lookup. The node is evaluated with eval_point for each of the W
+/// columns, starting at cOffset.pointOp_gc which is restored afterwards.
+template <typename Expr, size_t W, typename Loc, typename... Params>
+struct EvalVector {
+  using PixelType = typename tools::RemoveAll<decltype(
+      EvalExpr<Expr, Loc, Params...>::eval_point(
+          std::declval<Loc &>(),
+          std::declval<const tools::tuple::Tuple<Params...> &>()))>::Type;
+  static inline tools::PixelPack<PixelType, W> eval(
+      Loc &cOffset, const tools::tuple::Tuple<Params...> &t) {
+    const size_t first = cOffset.pointOp_gc;
+    tools::PixelPack<PixelType, W> pack;
+    for (size_t l = 0; l < W; l++) {
+      cOffset.pointOp_gc = first + l;
+      pack.lane[l] = EvalExpr<Expr, Loc, Params...>::eval_point(cOffset, t);
+    }
+    cOffset.pointOp_gc = first;
+    return pack;
+  }
+};
+
+/// \brief Partial specialisation of the EvalVector when the expression is
+/// an RUnOP(unary operation) expression.
+template <typename UN_OP, typename Nested, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, size_t W, typename Loc,
+          typename... Params>
+struct EvalVector<RUnOP<UN_OP, Nested, Cols, Rows, LfType, LVL>, W, Loc,
+                  Params...> {
+  using OP = typename UN_OP::OP;
+  static inline tools::PixelPack<typename UN_OP::OutType, W> eval(
+      Loc &cOffset, const tools::tuple::Tuple<Params...> &t) {
+    auto nested_acc = EvalVector<Nested, W, Loc, Params...>::eval(cOffset, t);
+    return tools::VectorApply<OP, typename UN_OP::OutType, W,
+                              tools::IsVectorised<OP>::value>::
+        apply(tools::convert_pack<typename UN_OP::InType>(nested_acc));
+  }
+};
+
+/// \brief Partial specialisation of the EvalVector when the expression is
+/// an RBiOP(binary operation) expression.
+template <typename BI_OP, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL, size_t W, typename Loc,
+          typename... Params>
+struct EvalVector<RBiOP<BI_OP, LHS, RHS, Cols, Rows, LfType, LVL>, W, Loc,
+                  Params...> {
+  using OP = typename BI_OP::OP;
+  static inline tools::PixelPack<typename BI_OP::OutType, W> eval(
+      Loc &cOffset, const tools::tuple::Tuple<Params...> &t) {
+    auto lhs_acc = EvalVector<LHS, W, Loc, Params...>::eval(cOffset, t);
+    auto rhs_acc = EvalVector<RHS, W, Loc, Params...>::eval(cOffset, t);
+    return tools::VectorApply<OP, typename BI_OP::OutType, W,
+                              tools::IsVectorised<OP>::value>::
+        apply(tools::convert_pack<typename BI_OP::InType1>(lhs_acc),
+              tools::convert_pack<typename BI_OP::InType2>(rhs_acc));
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPR_VECTOR_HPP_
@@ -25,10 +25,17 @@
 #define VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPRESSION_HPP_
 
 #include "eval_expr_assign.hpp"
+#include "eval_expr_histogram.hpp"
 #include "eval_expr_leaf_node.hpp"
+#include "eval_expr_lookup.hpp"
 #include "eval_expr_r_binary.hpp"
 #include "eval_expr_r_unary.hpp"
+#include "eval_expr_reduce.hpp"
 #include "eval_expr_reduction.hpp"
+#include "eval_expr_resize.hpp"
+#include "eval_expr_scan.hpp"
 #include "eval_expr_stn_filt.hpp"
 #include "eval_expr_stn_no_filt.hpp"
+#include "eval_expr_vector.hpp"
+#include "eval_expr_warp.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVAL_EXPRESSION_EVAL_EXPRESSION_HPP_
\ No newline at end of file
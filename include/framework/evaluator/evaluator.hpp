@@ -26,52 +26,6 @@
 
 namespace visioncpp {
 namespace internal {
-/// \struct GetGlobalRange
-/// \brief GetGlobalRange is used to check the range when the halo is applied
-///  template parameters
-/// \tparam Halo is the halo used around the image
-/// \tparam DimSize is the size of the dimension we want to check
-template <size_t Halo, size_t DimSize>
-struct GetGlobalRange {
-  /// function get_global_range checks the range and pass the correct value as
-  /// an index
-  /// parameters:
-  /// \param index is the passed index to be checked and corrected if needed
-  /// \return size_t
-  static size_t inline get_global_range(size_t index) {
-    size_t val = index;
-    if (val < Halo)
-      val = 0;
-    else if (val >= DimSize)
-      val = DimSize - 1;
-    else
-      val -= Halo;
-    return val;
-  }
-};
-/// \brief specialisation of GetGlobalRange when the Halo is 0
-template <size_t DimSize>
-struct GetGlobalRange<0, DimSize> {
-  /// function get_global_range checks the range and pass the correct value as
-  /// an index
-  /// parameters:
-  /// \param index is the passed index to be checked and corrected if needed
-  /// \return size_t
-  static size_t inline get_global_range(size_t index) {
-    return ((index < DimSize) ? index : DimSize - 1);
-  }
-};
-/// \brief template deduction function for get_global_range
-///  template parameters:
-/// \tparam Halo is the halo used around the image
-/// \tparam DimSize is the size of the dimension we want to check
-/// function parameters:
-/// \param index is the passed index to be checked and corrected if needed
-/// \return size_t
-template <size_t Halo, size_t DimSize>
-static size_t inline get_global_range(size_t index) {
-  return GetGlobalRange<Halo, DimSize>::get_global_range(index);
-}
 /// \struct Fill
 /// \brief The Fill is used to load a rectangle neighbour area from
 /// global memory to local memory. However, when the memory is constant or
@@ -251,6 +205,22 @@ struct Evaluator;
 template <typename Expr, typename Loc, typename... Params>
 struct EvalExpr;
 
+/// \struct EvalVector
+/// \brief is used to evaluate a point operation expression on the pixels of W
+/// consecutive columns at once. The first column and the row are given by
+/// cOffset.pointOp_gc and cOffset.pointOp_gr. The pointwise unary and binary
+/// nodes evaluate their children in packs of W pixels and call their functor
+/// through tools::VectorApply. Any other node is evaluated lane by lane with
+/// eval_point. The specialisations of EvalVector are located in
+/// eval_expression/eval_expr_vector.hpp.
+/// Template parameters
+///         \param Expr: the expression node required to be executed.
+///         \param W: the number of consecutive columns
+///         \param Loc: Coordinate of accessing a particular location
+///         \param params: the input/output memories
+template <typename Expr, size_t W, typename Loc, typename... Params>
+struct EvalVector;
+
 /// \struct OutputLocation
 /// \brief This is used to find whether a node should use a global memory
 /// output or a local memory output is created for that node. When the node is
@@ -35,7 +35,8 @@ template <size_t N, size_t Rows, size_t Cols, size_t Sc, size_t LVL,
 struct Fill<LeafNode<PlaceHolder<memory_type::Const, N, Cols, Rows, Sc>, LVL>,
             Loc, Params...> {
   template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t LC, size_t LR>
+            size_t Halo_Right, size_t Offset, size_t LC, size_t LR,
+            typename Border>
   static void fill_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t) {
     // no need to do anything the memory is read only
@@ -52,38 +53,69 @@ struct Fill<
     LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, scope::Constant>, LVL>,
     Loc, Params...> {
   template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t LC, size_t LR>
+            size_t Halo_Right, size_t Offset, size_t LC, size_t LR,
+            typename Border>
   static void fill_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t) {}
 };
 /// \brief Partial specialisation of the Fill when the LeafNode contains the
 /// sycl buffer on the global memory. In this case each work group loads a
-/// rectangle block of (LR,LC) in to their dedicated local memory.
+/// rectangle block of (LR,LC) in to their dedicated local memory. The block of
+/// a workgroup which is inside of the image is copied directly; only the
+/// blocks crossing the border of the image map their coordinates with the
+/// border policy. A 1x1 image, e.g. the result of a reduce, is read at every
+/// pixel of the block whatever the border policy, as it is by the point
+/// operations.
 template <size_t Memory_Type, size_t N, size_t Rows, size_t Cols, size_t LVL,
           size_t Sc, typename Loc, typename... Params>
 struct Fill<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
             Params...> {
   template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Index, size_t LC, size_t LR>
+            size_t Halo_Right, size_t Index, size_t LC, size_t LR,
+            typename Border>
   static void fill_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t) {
-    static_assert(Cols > 0 && LC > 0, "Cols must be greater than 0");
-    static_assert(Rows > 0 && LR > 0, "Rows must be greater than 0");
-    // calculation begins from here for unary op
-    for (int i = 0; i < LC; i += cOffset.cLRng) {
-      if ((cOffset.l_c + i < LC)) {
-        size_t val_c = get_global_range<Halo_Left, Cols>(cOffset.g_c + i);
-        for (size_t j = 0; j < LR; j += cOffset.rLRng) {
-          size_t val_r = get_global_range<Halo_Top, Rows>(cOffset.g_r + j);
-          if ((cOffset.l_r + j < LR)) {
-            tools::tuple::get<Index>(t)
-                .get_pointer()[(cOffset.l_c + i) + (LC * (cOffset.l_r + j))] =
-                tools::convert<typename MemoryTrait<
-                    Memory_Type, decltype(tools::tuple::get<Index>(t))>::Type>(
-                    *(tools::tuple::get<N>(t).get_pointer() +
-                      calculate_index(val_c, val_r, Cols, Rows)));
-            /// FIXME: image cannot be accessed by pointer
-          }
+    static_assert(LC > 0, "LC must be greater than 0");
+    static_assert(LR > 0, "LR must be greater than 0");
+    using Type = typename MemoryTrait<
+        Memory_Type, decltype(tools::tuple::get<Index>(t))>::Type;
+    // the size of the input, the runtime size is used when it is dynamic
+    const size_t cols = extent<Cols>(cOffset.cols);
+    const size_t rows = extent<Rows>(cOffset.rows);
+    // the first column and row of the input read by the workgroup
+    const int tile_c = static_cast<int>(cOffset.g_c - cOffset.l_c) -
+                       static_cast<int>(Halo_Left);
+    const int tile_r = static_cast<int>(cOffset.g_r - cOffset.l_r) -
+                       static_cast<int>(Halo_Top);
+    auto out = tools::tuple::get<Index>(t).get_pointer();
+    auto in = tools::tuple::get<N>(t).get_pointer();
+    if (Cols == 1 && Rows == 1) {
+      for (size_t i = cOffset.l_c; i < LC; i += cOffset.cLRng) {
+        for (size_t j = cOffset.l_r; j < LR; j += cOffset.rLRng) {
+          out[i + (LC * j)] = tools::convert<Type>(*in);
+        }
+      }
+    } else if (tile_c >= 0 && tile_r >= 0 && tile_c + LC <= cols &&
+               tile_r + LR <= rows) {
+      // the block is inside of the image
+      for (size_t i = cOffset.l_c; i < LC; i += cOffset.cLRng) {
+        for (size_t j = cOffset.l_r; j < LR; j += cOffset.rLRng) {
+          out[i + (LC * j)] =
+              tools::convert<Type>(*(in + (tile_c + i) + cols * (tile_r + j)));
+        }
+      }
+    } else {
+      for (size_t i = cOffset.l_c; i < LC; i += cOffset.cLRng) {
+        const int val_c =
+            border_index<Border>(tile_c + static_cast<int>(i), cols);
+        for (size_t j = cOffset.l_r; j < LR; j += cOffset.rLRng) {
+          const int val_r =
+              border_index<Border>(tile_r + static_cast<int>(j), rows);
+          out[i + (LC * j)] =
+              (val_c < 0 || val_r < 0)
+                  ? Type()
+                  : tools::convert<Type>(*(in + val_c + cols * val_r));
+          /// FIXME: image cannot be accessed by pointer
         }
       }
     }
@@ -95,11 +127,12 @@ struct Fill<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
 // template deduction for Fill struct.
 template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
           size_t Halo_Right, size_t Offset, size_t LC, size_t LR, typename Expr,
-          typename Loc, typename... Params>
+          typename Border, typename Loc, typename... Params>
 static void fill_local_neighbour(Loc &cOffset,
                                  const tools::tuple::Tuple<Params...> &t) {
   Fill<Expr, Loc, Params...>::template fill_neighbour<
-      Halo_Top, Halo_Left, Halo_Butt, Halo_Right, Offset, LC, LR>(cOffset, t);
+      Halo_Top, Halo_Left, Halo_Butt, Halo_Right, Offset, LC, LR, Border>(
+      cOffset, t);
 }
 } // namespace internal
 } // namespace visioncpp
@@ -0,0 +1,258 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file autotune.hpp
+/// \brief This file contains the auto-tuner choosing the local memory and
+/// workgroup sizes of an expression. The candidate sizes are benchmarked on
+/// the first execution and the fastest one is cached on disk.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_AUTOTUNE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_AUTOTUNE_HPP_
+
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+namespace visioncpp {
+/// \struct tile
+/// \brief tile is a candidate of the auto-tuner.
+/// template parameters:
+/// \tparam LCV: the column size for local memory
+/// \tparam LRV: the row size for local memory
+/// \tparam LCTV: the size of the workgroup column
+/// \tparam LRTV: the size of the workgroup row
+template <size_t LCV, size_t LRV, size_t LCTV, size_t LRTV>
+struct tile {
+  static constexpr size_t LC = LCV;
+  static constexpr size_t LR = LRV;
+  static constexpr size_t LCT = LCTV;
+  static constexpr size_t LRT = LRTV;
+};
+
+/// \struct tiles
+/// \brief tiles is the list of the candidates benchmarked by the auto-tuner
+/// \tparam Tiles: the candidate tiles
+template <typename... Tiles>
+struct tiles {};
+
+/// \brief the candidates used by default. The workgroup is never larger than
+/// the tile, and the large tiles leave room for the halo of the large masks.
+using default_tiles =
+    tiles<tile<8, 8, 8, 8>, tile<16, 16, 8, 8>, tile<16, 16, 16, 16>,
+          tile<32, 32, 8, 8>, tile<32, 32, 16, 16>, tile<64, 16, 16, 16>>;
+
+/// \class autotuner
+/// \brief autotuner holds the fastest tile found for each expression type,
+/// runtime size and device. The winners are stored in a text file, one per
+/// line, so they are reused by later runs of the application.
+class autotuner {
+  std::string path;
+  size_t runs;
+  std::map<std::string, std::string> winners;
+  mutable std::mutex mutex;
+
+ public:
+  /// \param path: the file caching the winners. It is created on the first
+  /// tuning when it does not exist.
+  /// \param runs: the number of timed executions of each candidate
+  explicit autotuner(const std::string &path, size_t runs = 5)
+      : path(path), runs(runs) {
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+      const size_t tab = line.find('\t');
+      if (tab != std::string::npos) {
+        winners[line.substr(tab + 1)] = line.substr(0, tab);
+      }
+    }
+  }
+  autotuner(const autotuner &) = delete;
+  autotuner &operator=(const autotuner &) = delete;
+
+  /// \brief finds the winner of the key
+  /// \param key: the key of the expression
+  /// \param shape: receives the winner when it exists
+  /// \return bool
+  bool find(const std::string &key, std::string &shape) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto winner = winners.find(key);
+    if (winner == winners.end()) {
+      return false;
+    }
+    shape = winner->second;
+    return true;
+  }
+
+  /// \brief stores the winner of the key and rewrites the cache file
+  /// \param key: the key of the expression
+  /// \param shape: the winner
+  /// \return void
+  void store(const std::string &key, const std::string &shape) {
+    std::lock_guard<std::mutex> lock(mutex);
+    winners[key] = shape;
+    std::ofstream file(path, std::ios::trunc);
+    for (const auto &winner : winners) {
+      file << winner.second << '\t' << winner.first << '\n';
+    }
+  }
+
+  /// \brief returns the number of timed executions of each candidate
+  /// \return size_t
+  size_t get_runs() const { return runs; }
+
+  /// \brief returns the number of cached winners
+  /// \return size_t
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return winners.size();
+  }
+};
+
+namespace internal {
+/// \struct TileTuning
+/// \brief TileTuning is used to execute the expression with one of the
+/// candidates, each candidate being a different instantiation of execute.
+/// template parameters:
+/// \tparam ExecPolicy: the policy used for executing the expression
+/// \tparam Tiles: the candidates left
+template <bool ExecPolicy, typename Tiles>
+struct TileTuning;
+
+/// \brief specialisation of the TileTuning when there is no candidate left
+template <bool ExecPolicy>
+struct TileTuning<ExecPolicy, tiles<>> {
+  template <typename Expr, typename DeviceT>
+  static inline bool execute(const std::string &, Expr &, const DeviceT &) {
+    return false;
+  }
+  template <typename Expr, typename DeviceT>
+  static inline void benchmark(Expr &, const DeviceT &, size_t, std::string &,
+                               double &) {}
+};
+
+/// \brief specialisation of the TileTuning for the first candidate left
+template <bool ExecPolicy, typename T, typename... Ts>
+struct TileTuning<ExecPolicy, tiles<T, Ts...>> {
+  using Next = TileTuning<ExecPolicy, tiles<Ts...>>;
+  /// \brief returns the name of the candidate stored in the cache
+  static inline std::string name() {
+    return std::to_string(T::LC) + " " + std::to_string(T::LR) + " " +
+           std::to_string(T::LCT) + " " + std::to_string(T::LRT);
+  }
+  /// \brief executes the expression with the candidate named shape. It
+  /// returns false when the shape is not one of the candidates.
+  template <typename Expr, typename DeviceT>
+  static inline bool execute(const std::string &shape, Expr &expr,
+                             const DeviceT &dev) {
+    if (shape != name()) {
+      return Next::execute(shape, expr, dev);
+    }
+    visioncpp::execute<ExecPolicy, T::LC, T::LR, T::LCT, T::LRT>(expr, dev);
+    return true;
+  }
+  /// \brief times the candidate and the ones left. The first execution of a
+  /// candidate is not timed as it includes the kernel compilation. A
+  /// candidate which cannot be launched on the device, e.g. a workgroup
+  /// above the maximum workgroup size, is skipped.
+  template <typename Expr, typename DeviceT>
+  static inline void benchmark(Expr &expr, const DeviceT &dev, size_t runs,
+                               std::string &best, double &best_time) {
+    try {
+      visioncpp::execute<ExecPolicy, T::LC, T::LR, T::LCT, T::LRT>(expr, dev);
+      dev.last_event().wait();
+      auto begin = tools::get_current_time();
+      for (size_t i = 0; i < runs; i++) {
+        visioncpp::execute<ExecPolicy, T::LC, T::LR, T::LCT, T::LRT>(expr,
+                                                                     dev);
+        dev.last_event().wait();
+      }
+      const double time =
+          tools::get_elapse_time(begin, tools::get_current_time());
+      if (time < best_time) {
+        best_time = time;
+        best = name();
+      }
+    } catch (const std::exception &) {
+    }
+    Next::benchmark(expr, dev, runs, best, best_time);
+  }
+};
+
+/// function tuning_key
+/// \brief returns the key of the expression in the cache. The best tile
+/// depends on the expression, its runtime size and the device.
+/// \param expr: the expression
+/// \param dev: the device executing the expression
+/// \return std::string
+template <typename Expr, typename DeviceT>
+inline std::string tuning_key(const Expr &expr, const DeviceT &dev) {
+  return dev.get_name() + "|" + typeid(Expr).name() + "|" +
+         std::to_string(runtime_cols(expr)) + "x" +
+         std::to_string(runtime_rows(expr));
+}
+}  // internal
+
+/// \brief execute_autotuned function is called by user in order to execute an
+/// expression with the fastest local memory and workgroup sizes among the
+/// candidates. On the first execution of the expression on the device, all
+/// the candidates are benchmarked, so the expression is executed several
+/// times and must not read its own output. The winner is cached by the
+/// autotuner and used by the later executions. The candidates which cannot
+/// be launched on the device are skipped; std::runtime_error is thrown when
+/// none of them can be.
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse or NoFuse
+/// \tparam Tiles: the candidates benchmarked by the auto-tuner
+/// \tparam Expr: the expression type to be executed.
+/// function parameters:
+/// \param expr: the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \param tuner : the auto-tuner caching the winners
+/// \return void
+template <bool ExecPolicy, typename Tiles = default_tiles, typename Expr,
+          typename DeviceT>
+void inline execute_autotuned(Expr &expr, const DeviceT &dev,
+                              autotuner &tuner) {
+  const std::string key = internal::tuning_key(expr, dev);
+  std::string shape;
+  if (tuner.find(key, shape) &&
+      internal::TileTuning<ExecPolicy, Tiles>::execute(shape, expr, dev)) {
+    return;
+  }
+  double best_time = std::numeric_limits<double>::max();
+  shape.clear();
+  internal::TileTuning<ExecPolicy, Tiles>::benchmark(
+      expr, dev, tuner.get_runs(), shape, best_time);
+  if (shape.empty()) {
+    throw std::runtime_error(
+        "visioncpp: none of the candidate tiles can be launched on the "
+        "device");
+  }
+  /// the last benchmarked candidate may have failed, so the winner is
+  /// executed once more to leave the result of the expression
+  internal::TileTuning<ExecPolicy, Tiles>::execute(shape, expr, dev);
+  tuner.store(key, shape);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_AUTOTUNE_HPP_
@@ -0,0 +1,69 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file batch_device.hpp
+/// \brief This file contains the BatchDevice used to execute an expression on
+/// a batch of images with a single kernel per node.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_BATCH_DEVICE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_BATCH_DEVICE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \class BatchDevice
+/// \brief BatchDevice wraps the device selected by execute_batch. Every
+/// kernel of the expression is launched on the wrapped device for the whole
+/// batch, and the intermediate memories created for the expression hold the
+/// same number of images.
+/// template parameters:
+/// \tparam DeviceT : the wrapped device type
+template <typename DeviceT>
+class BatchDevice {
+  const DeviceT &device;
+  size_t batch;
+
+ public:
+  /// \param dev : the wrapped device
+  /// \param batch : the number of images of the batch
+  BatchDevice(const DeviceT &dev, size_t batch) : device(dev), batch(batch) {}
+  /// \brief executes the expression for all the images of the batch on the
+  /// wrapped device
+  template <size_t LC, size_t LR, size_t CLT, size_t RLT, typename Expr>
+  void execute(Expr &expr, size_t cGThreads, size_t rGThreads, size_t cols,
+               size_t rows) const {
+    device.template execute_batch<LC, LR, CLT, RLT>(expr, cGThreads, rGThreads,
+                                                    cols, rows, batch);
+  }
+  /// \brief returns the pool of the wrapped device
+  /// \return BufferPool
+  BufferPool &get_buffer_pool() const { return device.get_buffer_pool(); }
+  /// \brief returns the name of the wrapped device
+  /// \return std::string
+  std::string get_name() const { return device.get_name(); }
+  /// \brief returns the event of the last kernel executed by the wrapped
+  /// device
+  /// \return event
+  visioncpp::event last_event() const { return device.last_event(); }
+  /// \brief returns the number of images of the batch
+  /// \return size_t
+  size_t get_batch() const { return batch; }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_BATCH_DEVICE_HPP_
@@ -0,0 +1,115 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file event.hpp
+/// \brief This file contains the event returned by execute_async. It is used
+/// to wait for, poll or chain the completion of an expression executed on a
+/// device.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_EVENT_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_EVENT_HPP_
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace visioncpp {
+/// \class event
+/// \brief event represents the completion of the kernels launched by an
+/// execute_async call. The kernels run on the device while the host keeps
+/// working, and the host only synchronises when wait is called. Host side work
+/// depending on the results (e.g. copying the output to a host pointer) is
+/// chained to the event with then, and is run by wait once the kernels are
+/// complete. Copies of an event share the same state. A default constructed
+/// event is complete.
+class event {
+  /// \brief the state shared by the copies of an event
+  struct State {
+    /// blocks until the kernels are complete
+    std::function<void()> wait;
+    /// returns true when the kernels are complete
+    std::function<bool()> is_complete;
+    /// the host side work run once the kernels are complete
+    std::vector<std::function<void()>> continuations;
+    std::mutex mutex;
+  };
+  std::shared_ptr<State> state;
+
+ public:
+  event() : event([]() {}, []() { return true; }) {}
+  /// \brief creates the event from the functions waiting for and polling the
+  /// kernels of the backend.
+  /// \param wait : the function blocking until the kernels are complete
+  /// \param is_complete : the function returning true when the kernels are
+  /// complete
+  event(std::function<void()> wait, std::function<bool()> is_complete)
+      : state(std::make_shared<State>()) {
+    state->wait = wait;
+    state->is_complete = is_complete;
+  }
+
+  /// \brief blocks until the kernels are complete, then runs the chained host
+  /// side work in the order it has been added. The chained work is only run
+  /// once, even if wait is called again. The lock is not held while blocking,
+  /// so then and is_complete can be called meanwhile.
+  /// \return void
+  void wait() {
+    state->wait();
+    std::vector<std::function<void()>> continuations;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      continuations.swap(state->continuations);
+    }
+    for (auto &continuation : continuations) {
+      continuation();
+    }
+  }
+
+  /// \brief returns true when the kernels are complete without blocking. The
+  /// chained host side work is run by wait.
+  /// \return bool
+  bool is_complete() const { return state->is_complete(); }
+
+  /// \brief chains the host side work to the event. It is run by wait once the
+  /// kernels are complete.
+  /// \param continuation : the host side work
+  /// \return event : the event itself
+  event &then(std::function<void()> continuation) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->continuations.push_back(continuation);
+    return *this;
+  }
+
+  /// \brief joins another event to this one. Waiting for the returned event
+  /// waits for both events and runs their chained work.
+  /// \param other : the event to join
+  /// \return event : an event complete when both events are complete
+  event join(event other) const {
+    event self = *this;
+    return event([self, other]() mutable {
+                   self.wait();
+                   other.wait();
+                 },
+                 [self, other]() {
+                   return self.is_complete() && other.is_complete();
+                 });
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_EVENT_HPP_
@@ -135,6 +135,74 @@ struct SubExprExecute<false, ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT> {
   }
 };
 
+/// \struct PartitionExecute
+/// \brief it is used to statically determine whether or not the fused
+/// expression is split into several kernels by the FusionPartition. When it
+/// is, the inputs of the neighbour operations chosen by the cost model are
+/// scheduled before the execution. The NoFuse policy already executes each
+/// node in a separate kernel, and the partition is skipped when
+/// VISIONCPP_NO_FUSION_PARTITION is defined.
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT,
+          bool Changed = ExecPolicy == policy::Fuse && FusionCost::Enabled &&
+                         FusionPartition<ExecPolicy, LC, LR, LCT, LRT, LC, LR,
+                                         Expr>::Changed>
+struct PartitionExecute {
+  static void inline execute(Expr &expr, const DeviceT &dev) {
+    SubExprExecute<Expr::SubExpressionEvaluationNeeded, ExecPolicy, LC, LR,
+                   LCT, LRT, Expr, DeviceT>::execute(expr, dev);
+  }
+};
+/// \brief specialisation of the PartitionExecute when the expression is
+/// split into several kernels
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT>
+struct PartitionExecute<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT, true> {
+  using Partition =
+      FusionPartition<ExecPolicy, LC, LR, LCT, LRT, LC, LR, Expr>;
+  static void inline execute(Expr &expr, const DeviceT &dev) {
+    auto split = Partition::convert(expr);
+    SubExprExecute<Partition::Type::SubExpressionEvaluationNeeded, ExecPolicy,
+                   LC, LR, LCT, LRT, typename Partition::Type,
+                   DeviceT>::execute(split, dev);
+  }
+};
+
+/// \struct CommonSubexprExecute
+/// \brief it is used to statically determine whether or not the expression
+/// has candidate common subexpressions. When it has, and the candidates read
+/// the same leaves at runtime, the expression is rebuilt by CommonSubexpr so
+/// each common subexpression is executed once. Otherwise the expression is
+/// executed as it is.
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT,
+          bool Changed = CommonSubexpr<ExecPolicy, LC, LR, LCT, LRT, Expr,
+                                       Expr>::Changed>
+struct CommonSubexprExecute {
+  static void inline execute(Expr &expr, const DeviceT &dev) {
+    PartitionExecute<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT>::execute(
+        expr, dev);
+  }
+};
+/// \brief specialisation of the CommonSubexprExecute when the expression has
+/// common subexpressions
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT>
+struct CommonSubexprExecute<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT,
+                            true> {
+  using CSE = CommonSubexpr<ExecPolicy, LC, LR, LCT, LRT, Expr, Expr>;
+  static void inline execute(Expr &expr, const DeviceT &dev) {
+    if (!shares_common_subexpr<ExecPolicy>(expr)) {
+      PartitionExecute<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT>::execute(
+          expr, dev);
+      return;
+    }
+    auto shared = CSE::convert(expr);
+    PartitionExecute<ExecPolicy, LC, LR, LCT, LRT, typename CSE::Type,
+                     DeviceT>::execute(shared, dev);
+  }
+};
+
 }  // internal
 
 /// \brief execute function is called by user in order to execute an expression
@@ -153,8 +221,10 @@ struct SubExprExecute<false, ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT> {
 template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
           typename Expr, typename DeviceT>
 void inline execute(Expr &expr, const DeviceT &dev) {
-  internal::SubExprExecute<Expr::SubExpressionEvaluationNeeded, ExecPolicy, LC,
-                           LR, LCT, LRT, Expr, DeviceT>::execute(expr, dev);
+  /// the intermediate memories are released once the expression is executed
+  internal::IntermediateScope<DeviceT> scope(dev);
+  internal::CommonSubexprExecute<ExecPolicy, LC, LR, LCT, LRT, Expr,
+                                 DeviceT>::execute(expr, dev);
 }
 
 /// \brief special case of the execute function with default value for local
@@ -169,11 +239,101 @@ void inline execute(Expr &expr, const DeviceT &dev) {
 /// \return void
 template <bool ExecPolicy, typename Expr, typename DeviceT>
 void inline execute(Expr &expr, const DeviceT &dev) {
-  internal::SubExprExecute<Expr::SubExpressionEvaluationNeeded, ExecPolicy, 8,
-                           8, 8, 8, Expr, DeviceT>::execute(expr, dev);
+  /// the intermediate memories are released once the expression is executed
+  internal::IntermediateScope<DeviceT> scope(dev);
+  internal::CommonSubexprExecute<ExecPolicy, 8, 8, 8, 8, Expr,
+                                 DeviceT>::execute(expr, dev);
+}
+
+/// \brief execute_async function is called by user in order to execute an
+/// expression without waiting for its completion. The kernels are submitted to
+/// the device and the returned event is used to wait for, poll or chain their
+/// completion. The memories of the expression must stay alive until the event
+/// is complete.
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse or NoFuse
+/// \tparam LC the column size for local memory when needed
+/// \tparam LR the row size for column memory when needed
+/// \tparam LCT the size of the workgroup column.
+/// \tparam LRT the size of the workgroup row.
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \return event
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT>
+event inline execute_async(Expr &expr, const DeviceT &dev) {
+  execute<ExecPolicy, LC, LR, LCT, LRT>(expr, dev);
+  return dev.last_event();
+}
+
+/// \brief special case of the execute_async function with default value for
+/// local memory and workgroup size
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse or NoFuse
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \return event
+template <bool ExecPolicy, typename Expr, typename DeviceT>
+event inline execute_async(Expr &expr, const DeviceT &dev) {
+  return execute_async<ExecPolicy, 8, 8, 8, 8>(expr, dev);
+}
+
+/// \brief execute_batch function is called by user in order to execute an
+/// expression on a batch of images. The number of images is the largest batch
+/// of the terminal nodes of the expression (see terminal_batch). Each kernel of
+/// the expression processes the whole batch, while a terminal node holding a
+/// single image is shared by all the images of the batch. It throws
+/// std::invalid_argument when a terminal node, the output included, holds
+/// neither one image nor as many images as the batch. Pyramids are not
+/// supported.
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse or NoFuse
+/// \tparam LC the column size for local memory when needed
+/// \tparam LR the row size for column memory when needed
+/// \tparam LCT the size of the workgroup column.
+/// \tparam LRT the size of the workgroup row.
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \return void
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT>
+void inline execute_batch(Expr &expr, const DeviceT &dev) {
+  const size_t batch = internal::runtime_batch(expr);
+  internal::check_runtime_batch(expr, batch);
+  const internal::BatchDevice<DeviceT> batch_dev(dev, batch);
+  execute<ExecPolicy, LC, LR, LCT, LRT>(expr, batch_dev);
+}
+
+/// \brief special case of the execute_batch function with default value for
+/// local memory and workgroup size
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse or NoFuse
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \return void
+template <bool ExecPolicy, typename Expr, typename DeviceT>
+void inline execute_batch(Expr &expr, const DeviceT &dev) {
+  execute_batch<ExecPolicy, 8, 8, 8, 8>(expr, dev);
 }
 }  // visioncpp
 #include "executor_subexpr_if_needed.hpp"
+#include "intermediate_memory.hpp"
 #include "policy/fuse.hpp"
 #include "policy/nofuse.hpp"
+#include "pipeline.hpp"
+#include "batch_device.hpp"
+#include "autotune.hpp"
+#include "profiler.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_EXECUTOR_HPP_
@@ -44,7 +44,14 @@ struct SubExprRes {
   /// subexpression execution.
   static Type get(Expr &eval_sub, const DeviceT &dev) {
     using Intermediate_Output = internal::LeafNode<typename Expr::Type, LVL>;
-    auto intermediate_output = Intermediate_Output();
+    /// an identical subexpression has already been executed
+    auto key = make_subtree_key(eval_sub);
+    auto common = find_common<Intermediate_Output>(dev, key);
+    if (common) {
+      return Intermediate_Output(*common);
+    }
+    auto intermediate_output = make_intermediate<Intermediate_Output>(
+        dev, runtime_cols(eval_sub), runtime_rows(eval_sub));
     internal::fuse<LC, LR, LCT, LRT>(
         internal::Assign<Intermediate_Output, Expr,
                          Intermediate_Output::Type::Cols,
@@ -55,6 +62,7 @@ struct SubExprRes {
                                  Intermediate_Output, Expr>::Type::Level>(
             intermediate_output, eval_sub),
         dev);
+    keep_common(dev, key, intermediate_output);
     return intermediate_output;
   }
 };
@@ -125,7 +133,14 @@ struct ParentForcedExecute<true, Expr, DeviceT> {
   /// \return LeafNode
   template <size_t LC, size_t LR, size_t LCT, size_t LRT>
   static inline Type forced_exec(Expr &expr, const DeviceT &dev) {
-    auto lhs = Type();
+    /// an identical subexpression has already been executed
+    auto key = make_subtree_key(expr);
+    auto common = find_common<Type>(dev, key);
+    if (common) {
+      return Type(*common);
+    }
+    auto lhs =
+        make_intermediate<Type>(dev, runtime_cols(expr), runtime_rows(expr));
     internal::fuse<LC, LR, LCT, LRT>(
         internal::Assign<
             Type, Expr, Type::Type::Cols, Type::Type::Rows,
@@ -133,6 +148,7 @@ struct ParentForcedExecute<true, Expr, DeviceT> {
             1 + internal::tools::StaticIf<(Type::Level > Expr::Level), Type,
                                           Expr>::Type::Level>(lhs, expr),
         dev);
+    keep_common(dev, key, lhs);
     return lhs;
   }
 };
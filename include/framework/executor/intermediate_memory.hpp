@@ -0,0 +1,175 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file intermediate_memory.hpp
+/// \brief This file contains the functions used to create and release the
+/// intermediate memories needed when an expression is broken into several
+/// kernels. The memories are taken from the BufferPool of the device, which
+/// also keeps the results of the common subexpressions.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_INTERMEDIATE_MEMORY_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_INTERMEDIATE_MEMORY_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// function device_batch
+/// \brief returns the number of images processed by each kernel launched on
+/// the device. It is one unless the expression is executed by execute_batch.
+/// \param dev : the device executing the expression
+/// \return size_t
+template <typename DeviceT>
+inline size_t device_batch(const DeviceT &dev) {
+  return 1;
+}
+/// \brief specialisation of the device_batch when the device is a BatchDevice
+template <typename DeviceT>
+inline size_t device_batch(const BatchDevice<DeviceT> &dev) {
+  return dev.get_batch();
+}
+
+/// \struct IntermediateMemory
+/// \brief IntermediateMemory is used to create and release the intermediate
+/// memories of an expression by using the BufferPool of the device. The
+/// memories hold as many images as the kernels launched on the device.
+/// template parameters:
+/// \tparam DeviceT : the type of the device executing the expression
+template <typename DeviceT>
+struct IntermediateMemory {
+  /// \brief returns a LeafNode representing a free buffer of the pool
+  template <typename LeafT>
+  static inline LeafT get(const DeviceT &dev, size_t cols, size_t rows) {
+    return dev.get_buffer_pool().template acquire<LeafT>(cols, rows,
+                                                         device_batch(dev));
+  }
+  /// \brief gives the buffer of the LeafNode back to the pool
+  template <typename LeafT>
+  static inline void release(const DeviceT &dev, const LeafT &leaf) {
+    dev.get_buffer_pool().release(leaf);
+  }
+  /// \brief returns the memory holding the result of an identical
+  /// subexpression already executed, or nullptr
+  template <typename LeafT>
+  static inline std::shared_ptr<typename LeafT::RHSExpr> find(
+      const DeviceT &dev, const SubtreeKey &key) {
+    return dev.get_buffer_pool().template find_common<typename LeafT::RHSExpr>(
+        key);
+  }
+  /// \brief keeps the LeafNode holding the result of the subexpression, so
+  /// the identical subexpressions executed later can read it
+  template <typename LeafT>
+  static inline void keep(const DeviceT &dev, const SubtreeKey &key,
+                          const LeafT &leaf) {
+    dev.get_buffer_pool().keep_common(key, leaf.vilibMemory);
+  }
+};
+
+/// function make_intermediate
+/// \brief template deduction for IntermediateMemory::get.
+/// template parameters:
+/// \tparam LeafT : the type of the LeafNode representing the memory
+/// \tparam DeviceT : the type of the device executing the expression
+/// function parameters:
+/// \param dev : the device executing the expression
+/// \param cols : the runtime column size of the memory
+/// \param rows : the runtime row size of the memory
+/// \return LeafT
+template <typename LeafT, typename DeviceT>
+LeafT make_intermediate(const DeviceT &dev, size_t cols, size_t rows) {
+  return IntermediateMemory<DeviceT>::template get<LeafT>(dev, cols, rows);
+}
+
+/// function release_intermediate
+/// \brief template deduction for IntermediateMemory::release. It is called
+/// once the last consumer of the memory has been executed. Nothing happens
+/// when the memory has not been created by make_intermediate.
+/// template parameters:
+/// \tparam DeviceT : the type of the device executing the expression
+/// \tparam LeafT : the type of the LeafNode representing the memory
+/// function parameters:
+/// \param dev : the device executing the expression
+/// \param leaf : the LeafNode whose memory is released
+/// \return void
+template <typename DeviceT, typename LeafT>
+void release_intermediate(const DeviceT &dev, const LeafT &leaf) {
+  IntermediateMemory<DeviceT>::release(dev, leaf);
+}
+
+/// function find_common
+/// \brief template deduction for IntermediateMemory::find. It is called before
+/// executing a subexpression in order to reuse the result of an identical one.
+/// template parameters:
+/// \tparam LeafT : the type of the LeafNode representing the memory
+/// \tparam DeviceT : the type of the device executing the expression
+/// function parameters:
+/// \param dev : the device executing the expression
+/// \param key : the key of the subexpression
+/// \return std::shared_ptr<LeafT::RHSExpr>
+template <typename LeafT, typename DeviceT>
+std::shared_ptr<typename LeafT::RHSExpr> find_common(const DeviceT &dev,
+                                                     const SubtreeKey &key) {
+  return IntermediateMemory<DeviceT>::template find<LeafT>(dev, key);
+}
+
+/// function keep_common
+/// \brief template deduction for IntermediateMemory::keep. It is called once
+/// a subexpression has been executed.
+/// template parameters:
+/// \tparam DeviceT : the type of the device executing the expression
+/// \tparam LeafT : the type of the LeafNode representing the memory
+/// function parameters:
+/// \param dev : the device executing the expression
+/// \param key : the key of the subexpression
+/// \param leaf : the LeafNode holding the result of the subexpression
+/// \return void
+template <typename DeviceT, typename LeafT>
+void keep_common(const DeviceT &dev, const SubtreeKey &key,
+                 const LeafT &leaf) {
+  IntermediateMemory<DeviceT>::keep(dev, key, leaf);
+}
+
+/// \class IntermediateScope
+/// \brief IntermediateScope releases all the intermediate memories created
+/// during the execution of an expression when the execution is finished. The
+/// scope owns the memories acquired by its thread while it is the innermost
+/// scope of the thread, so the executions sharing a device from other threads
+/// keep their own memories. The memories created for a schedule node before
+/// its execution belong to the scope of its parent, so they stay alive until
+/// the parent is executed.
+/// The liveness of the memories is tracked at runtime rather than computed
+/// from the tree: NoFuse gives the memories of the children back to the pool
+/// once their parent is executed, while the memories of the schedule nodes
+/// live until the end of the execution, as they also hold the results read
+/// by the common subexpressions.
+/// template parameters:
+/// \tparam DeviceT : the type of the device executing the expression
+template <typename DeviceT>
+class IntermediateScope {
+  const DeviceT &dev;
+  size_t id;
+
+ public:
+  IntermediateScope(const DeviceT &dev)
+      : dev(dev), id(dev.get_buffer_pool().open_scope()) {}
+  IntermediateScope(const IntermediateScope &) = delete;
+  IntermediateScope &operator=(const IntermediateScope &) = delete;
+  ~IntermediateScope() { dev.get_buffer_pool().close_scope(id); }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_INTERMEDIATE_MEMORY_HPP_
@@ -0,0 +1,341 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file pipeline.hpp
+/// \brief This file contains the pipeline which is used to execute the same
+/// expression many times (e.g. for each frame of a video stream) without
+/// recreating the expression tree and the memories needed by it.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PIPELINE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PIPELINE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \class PipelineDevice
+/// \brief PipelineDevice wraps the device selected for a pipeline. It
+/// forwards the execution to the wrapped device and serves the intermediate
+/// memories from a BufferPool owned by the pipeline, so the memories are kept
+/// alive between the executions.
+/// template parameters:
+/// \tparam DeviceT : the wrapped device type
+template <typename DeviceT>
+class PipelineDevice {
+  DeviceT device;
+  std::shared_ptr<BufferPool> buffer_pool;
+
+ public:
+  PipelineDevice(const DeviceT &dev)
+      : device(dev), buffer_pool(std::make_shared<BufferPool>()) {}
+  /// \brief forwards the execution of the expression to the wrapped device
+  template <size_t LC, size_t LR, size_t CLT, size_t RLT, typename Expr>
+  void execute(Expr &expr, size_t cGThreads, size_t rGThreads, size_t cols,
+               size_t rows) const {
+    device.template execute<LC, LR, CLT, RLT>(expr, cGThreads, rGThreads, cols,
+                                              rows);
+  }
+  /// \brief returns the pool of the intermediate memories of the pipeline
+  /// \return BufferPool
+  BufferPool &get_buffer_pool() const { return *buffer_pool; }
+  /// \brief returns the name of the wrapped device
+  /// \return std::string
+  std::string get_name() const { return device.get_name(); }
+  /// \brief returns the event of the last kernel executed by the wrapped
+  /// device
+  /// \return event
+  visioncpp::event last_event() const { return device.last_event(); }
+};
+
+/// \struct PipelineTransfer
+/// \brief PipelineTransfer is used to move the data of the host pointers
+/// passed to the pipeline to the input memories before the execution and from
+/// the output memories after the execution.
+/// template parameters:
+/// \tparam IsInput : true when the pointer belongs to an input memory
+template <bool IsInput>
+struct PipelineTransfer {
+  /// \brief uploads the content of the pointer to the I-th input memory
+  template <size_t I, typename Inputs, typename Ptr>
+  static inline void upload(Inputs &ins, Ptr ptr) {
+    tools::tuple::get<I>(ins).reset_input(ptr);
+  }
+  /// \brief there is nothing to download for an input memory
+  template <size_t I, typename Outputs, typename Ptr>
+  static inline void download(Outputs &, Ptr) {}
+};
+/// \brief specialisation of the PipelineTransfer when the pointer belongs to
+/// an output memory.
+template <>
+struct PipelineTransfer<false> {
+  /// \brief there is nothing to upload for an output memory
+  template <size_t I, typename Inputs, typename Ptr>
+  static inline void upload(Inputs &, Ptr) {}
+  /// \brief downloads the content of the I-th output memory to the pointer
+  template <size_t I, typename Outputs, typename Ptr>
+  static inline void download(Outputs &outs, Ptr ptr) {
+    tools::tuple::get<I>(outs).read_output(ptr);
+  }
+};
+
+/// \struct PipelineSlotMemory
+/// \brief PipelineSlotMemory gives each run in flight of a pipeline its own
+/// input and output memories. The terminal nodes of the expression share the
+/// sycl buffer object of their memory, so assigning another buffer to it
+/// binds all of them to the memories of a slot at once. The kernels already
+/// submitted keep the buffers they have been submitted with.
+/// template parameters:
+/// \tparam I : the index of the memory in the tuple
+/// \tparam N : the number of memories in the tuple
+template <size_t I, size_t N>
+struct PipelineSlotMemory {
+  /// \brief gives the memories of the tuple their own buffer object. The
+  /// buffer object refers to a new device only buffer when fresh is true, and
+  /// to the buffer of the terminal node otherwise.
+  template <typename Leaves>
+  static inline void detach(Leaves &leaves, bool fresh) {
+    auto &memory = tools::tuple::get<I>(leaves).vilibMemory;
+    using Memory = typename std::remove_reference<decltype(memory)>::type;
+    if (fresh) {
+      memory = Memory(memory.get_cols(), memory.get_rows(),
+                      memory.get_batch());
+    } else {
+      memory.syclData =
+          std::make_shared<typename Memory::syclBuffer>(*memory.syclData);
+    }
+    PipelineSlotMemory<I + 1, N>::detach(leaves, fresh);
+  }
+  /// \brief binds the terminal nodes of the expression to the memories of
+  /// the slot
+  template <typename Leaves>
+  static inline void bind(Leaves &terminals, const Leaves &slot) {
+    *tools::tuple::get<I>(terminals).vilibMemory.syclData =
+        *tools::tuple::get<I>(slot).vilibMemory.syclData;
+    PipelineSlotMemory<I + 1, N>::bind(terminals, slot);
+  }
+};
+/// \brief specialisation of the PipelineSlotMemory after the last memory
+template <size_t N>
+struct PipelineSlotMemory<N, N> {
+  template <typename Leaves>
+  static inline void detach(Leaves &, bool) {}
+  template <typename Leaves>
+  static inline void bind(Leaves &, const Leaves &) {}
+};
+}  // internal
+
+/// \class pipeline
+/// \brief pipeline is used to build an expression once and execute it many
+/// times. The pipeline owns every intermediate memory needed by the
+/// expression, so executing it again does not create any new memory. The
+/// inputs and outputs of the pipeline are the terminal nodes of the
+/// expression whose content is exchanged with the host on every run.
+/// Several runs of run_async can be in flight: each one uses the input and
+/// output memories of its own slot, and a run only waits for the run which
+/// used its slot before. The first slot holds the memories of the terminal
+/// nodes given to the pipeline. After a run, the terminal nodes are bound to
+/// the memories of the slot it used.
+/// template parameters:
+/// \tparam ExecPolicy: the policy used for executing the expression
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// \tparam Expr: the expression type
+/// \tparam DeviceT: the selected device type
+/// \tparam Inputs: the tuple of the input terminal nodes
+/// \tparam Outputs: the tuple of the output terminal nodes
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT, typename Inputs, typename Outputs>
+class pipeline;
+
+/// \brief specialisation of the pipeline for the tuple of inputs and outputs
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT, typename... Ins, typename... Outs>
+class pipeline<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT,
+               internal::tools::tuple::Tuple<Ins...>,
+               internal::tools::tuple::Tuple<Outs...>> {
+  static constexpr size_t NumInputs = sizeof...(Ins);
+  static constexpr size_t NumOutputs = sizeof...(Outs);
+  Expr expr;
+  internal::PipelineDevice<DeviceT> dev;
+  internal::tools::tuple::Tuple<Ins...> ins;
+  internal::tools::tuple::Tuple<Outs...> outs;
+  /// \brief the memories of the inputs and outputs of one run in flight
+  struct Slot {
+    internal::tools::tuple::Tuple<Ins...> ins;
+    internal::tools::tuple::Tuple<Outs...> outs;
+    /// the event of the last run using the slot, its outputs are downloaded
+    /// before the memories of the slot are used again
+    visioncpp::event pending;
+  };
+  std::vector<Slot> slots;
+  /// the slot used by the next run_async
+  size_t next_slot;
+
+  /// \brief binds the terminal nodes of the expression to the slot
+  void bind(Slot &slot) {
+    internal::PipelineSlotMemory<0, NumInputs>::bind(ins, slot.ins);
+    internal::PipelineSlotMemory<0, NumOutputs>::bind(outs, slot.outs);
+  }
+
+  template <size_t I>
+  void upload() {}
+  template <size_t I, typename Ptr, typename... Ptrs>
+  void upload(Ptr ptr, Ptrs... ptrs) {
+    internal::PipelineTransfer<(I < NumInputs)>::template upload<I>(ins, ptr);
+    upload<I + 1>(ptrs...);
+  }
+  template <size_t I>
+  static void download(internal::tools::tuple::Tuple<Outs...> &) {}
+  template <size_t I, typename Ptr, typename... Ptrs>
+  static void download(internal::tools::tuple::Tuple<Outs...> &slot_outs,
+                       Ptr ptr, Ptrs... ptrs) {
+    internal::PipelineTransfer<(I < NumInputs)>::template download<
+        I - NumInputs>(slot_outs, ptr);
+    download<I + 1>(slot_outs, ptrs...);
+  }
+
+ public:
+  /// \brief creates the pipeline with in_flight slots, which is the number
+  /// of runs of run_async that can be in flight at the same time
+  pipeline(Expr expr, const DeviceT &dev,
+           internal::tools::tuple::Tuple<Ins...> ins,
+           internal::tools::tuple::Tuple<Outs...> outs, size_t in_flight = 2)
+      : expr(expr), dev(dev), ins(ins), outs(outs), next_slot(0) {
+    for (size_t i = 0; i < std::max<size_t>(in_flight, 1); i++) {
+      slots.push_back(Slot{ins, outs, visioncpp::event()});
+      internal::PipelineSlotMemory<0, NumInputs>::detach(slots.back().ins,
+                                                         i > 0);
+      internal::PipelineSlotMemory<0, NumOutputs>::detach(slots.back().outs,
+                                                          i > 0);
+    }
+  }
+
+  /// \brief executes the expression on the current content of the input
+  /// memories. The runs in flight are waited for first. The intermediate
+  /// memories created by the first run are reused.
+  /// \return void
+  void run() {
+    for (auto &slot : slots) {
+      slot.pending.wait();
+    }
+    execute<ExecPolicy, LC, LR, LCT, LRT>(expr, dev);
+  }
+
+  /// \brief uploads the given host pointers to the inputs, executes the
+  /// expression and downloads the outputs to the given host pointers. The
+  /// pointers are passed in the order of the inputs followed by the outputs.
+  /// \param ptrs : the host pointers of the inputs and outputs
+  /// \return void
+  template <typename... Ptrs>
+  void run(Ptrs... ptrs) {
+    static_assert(sizeof...(Ptrs) == NumInputs + NumOutputs,
+                  "A host pointer must be passed for every input and output "
+                  "of the pipeline");
+    run();
+    upload<0>(ptrs...);
+    execute<ExecPolicy, LC, LR, LCT, LRT>(expr, dev);
+    download<0>(outs, ptrs...);
+  }
+
+  /// \brief uploads the given host pointers to the inputs and launches the
+  /// expression without waiting for it. The outputs are downloaded to the
+  /// given host pointers when the returned event is waited for, so the host
+  /// can prepare the next frame meanwhile. The pipeline and the pointers must
+  /// stay alive until then. The runs use the slots of the pipeline in turn,
+  /// so up to in_flight runs are in flight. A run reusing a slot first waits
+  /// for the previous run of the slot, whose outputs are downloaded to their
+  /// own pointers before being overwritten. The intermediate memories are
+  /// shared by the runs, and the sycl runtime orders their kernels.
+  /// \param ptrs : the host pointers of the inputs and outputs
+  /// \return event
+  template <typename... Ptrs>
+  visioncpp::event run_async(Ptrs... ptrs) {
+    static_assert(sizeof...(Ptrs) == NumInputs + NumOutputs,
+                  "A host pointer must be passed for every input and output "
+                  "of the pipeline");
+    Slot &slot = slots[next_slot];
+    next_slot = (next_slot + 1) % slots.size();
+    slot.pending.wait();
+    bind(slot);
+    upload<0>(ptrs...);
+    auto completion = execute_async<ExecPolicy, LC, LR, LCT, LRT>(expr, dev);
+    auto slot_outs = slot.outs;
+    completion.then([=]() mutable { download<0>(slot_outs, ptrs...); });
+    slot.pending = completion;
+    return completion;
+  }
+
+  /// \brief returns the number of runs of run_async which can be in flight
+  /// \return size_t
+  size_t in_flight() const { return slots.size(); }
+
+  /// \brief returns the number of intermediate memories owned by the pipeline
+  /// \return size_t
+  size_t intermediate_count() const { return dev.get_buffer_pool().size(); }
+};
+
+/// \brief template deduction function used to group the input terminal nodes
+/// of a pipeline.
+template <typename... Ins>
+internal::tools::tuple::Tuple<Ins...> inputs(Ins... ins) {
+  return internal::tools::tuple::make_tuple(ins...);
+}
+
+/// \brief template deduction function used to group the output terminal nodes
+/// of a pipeline.
+template <typename... Outs>
+internal::tools::tuple::Tuple<Outs...> outputs(Outs... outs) {
+  return internal::tools::tuple::make_tuple(outs...);
+}
+
+/// \brief template deduction function for the pipeline
+/// template parameters:
+/// \tparam ExecPolicy: the policy used for executing the expression
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// function parameters:
+/// \param expr: the expression to be executed by the pipeline
+/// \param dev: the selected device for executing the expression
+/// \param ins: the input terminal nodes created by inputs
+/// \param outs: the output terminal nodes created by outputs
+/// \param in_flight: the number of runs of run_async which can be in flight
+/// \return pipeline
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr, typename DeviceT, typename Inputs, typename Outputs>
+pipeline<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT, Inputs, Outputs>
+make_pipeline(Expr expr, const DeviceT &dev, Inputs ins, Outputs outs,
+              size_t in_flight = 2) {
+  return pipeline<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT, Inputs,
+                  Outputs>(expr, dev, ins, outs, in_flight);
+}
+
+/// \brief special case of the make_pipeline with default value for local
+/// memory and workgroup size
+template <bool ExecPolicy, typename Expr, typename DeviceT, typename Inputs,
+          typename Outputs>
+pipeline<ExecPolicy, 8, 8, 8, 8, Expr, DeviceT, Inputs, Outputs> make_pipeline(
+    Expr expr, const DeviceT &dev, Inputs ins, Outputs outs,
+    size_t in_flight = 2) {
+  return pipeline<ExecPolicy, 8, 8, 8, 8, Expr, DeviceT, Inputs, Outputs>(
+      expr, dev, ins, outs, in_flight);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PIPELINE_HPP_
@@ -35,32 +35,39 @@ struct FuseExpr {
   /// \param dev : the selected device for executing the expression
   /// return void
   static void fuse(Expr &expr, const DeviceT &dev) {
+    /// the operands of a node must have the same size when it is only known
+    /// at runtime
+    check_runtime_extent(expr);
     /// LRT is the  workgroup size row and is checked with LR. LR is based
     /// on LRIn. LCT is the workgroup size column checked with LC. LC is based
     /// on LCIn. The local memory size  and the work group size is calculated at
-    /// compile time.
+    /// compile time. When the expression extent is dynamic the suggested sizes
+    /// are used.
     constexpr size_t LR =
-        tools::IfConst<(Expr::RThread > LRIn), LRIn, Expr::RThread>::Value;
+        tools::IfConst<(Expr::RThread == dynamic || Expr::RThread > LRIn), LRIn,
+                       Expr::RThread>::Value;
     constexpr size_t LC =
-        tools::IfConst<(Expr::CThread > LCIn), LCIn, Expr::CThread>::Value;
+        tools::IfConst<(Expr::CThread == dynamic || Expr::CThread > LCIn), LCIn,
+                       Expr::CThread>::Value;
 
     constexpr int rLThread =
-        tools::IfConst<(Expr::RThread > LRT), LRT, Expr::RThread>::Value;
+        tools::IfConst<(Expr::RThread == dynamic || Expr::RThread > LRT), LRT,
+                       Expr::RThread>::Value;
 
     constexpr int cLThread =
-        tools::IfConst<(Expr::CThread > LCT), LCT, Expr::CThread>::Value;
+        tools::IfConst<(Expr::CThread == dynamic || Expr::CThread > LCT), LCT,
+                       Expr::CThread>::Value;
 
-    constexpr size_t rGThreads =
-        (tools::IfConst<(Expr::RThread % LR == 0), (Expr::RThread / LR),
-                        ((Expr::RThread / LR) + 1)>::Value) *
-        rLThread;
+    /// the number of threads needed for each dimension of the expression. It
+    /// is only calculated at runtime when the extent is dynamic.
+    const size_t rows = extent<Expr::RThread>(runtime_rows(expr));
+    const size_t cols = extent<Expr::CThread>(runtime_cols(expr));
 
-    constexpr size_t cGThreads =
-        (tools::IfConst<(Expr::CThread % LC == 0), (Expr::CThread / LC),
-                        ((Expr::CThread / LC) + 1)>::Value) *
-        cLThread;
-    dev.template execute<LC, LR, cGThreads, rGThreads, cLThread, rLThread>(
-        expr);
+    const size_t rGThreads = ((rows + LR - 1) / LR) * rLThread;
+
+    const size_t cGThreads = ((cols + LC - 1) / LC) * cLThread;
+    dev.template execute<LC, LR, cLThread, rLThread>(expr, cGThreads,
+                                                      rGThreads, cols, rows);
   }
 };
 /// \brief specialisation of Fuse struct when the Expr is a terminal node
@@ -59,7 +59,8 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Unary, Expr, Device
     auto iOutput = NoFuseExpr<LC, LR, LCT, LRT, decltype(expr.rhs)::ND_Category,
                           decltype(expr.rhs), DeviceT>::no_fuse(expr.rhs, dev);
     using IOutput = decltype(iOutput);
-    auto lhs = ALHS();
+    auto lhs =
+        make_intermediate<ALHS>(dev, runtime_cols(expr), runtime_rows(expr));
     using ARHS = typename Expr::template ExprExchange<IOutput>;
     fuse<LC, LR, LCT, LRT>(
         Assign<ALHS, ARHS, ALHS::Type::Cols, ALHS::Type::Rows,
@@ -67,6 +68,8 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Unary, Expr, Device
                1 + tools::StaticIf<(ALHS::Level > ARHS::Level), ALHS,
                                    ARHS>::Type::Level>(lhs, ARHS(iOutput)),
         dev);
+    /// the child output is not needed anymore
+    release_intermediate(dev, iOutput);
     return lhs;
   }
 };
@@ -95,7 +98,8 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Binary, Expr, Devic
 
     using ARHS = typename Expr::template ExprExchange<decltype(i_lhs_output),
                                                       decltype(i_rhs_output)>;
-    auto lhs = ALHS();
+    auto lhs =
+        make_intermediate<ALHS>(dev, runtime_cols(expr), runtime_rows(expr));
     fuse<LC, LR, LCT, LRT>(
         Assign<ALHS, ARHS, ALHS::Type::Cols, ALHS::Type::Rows,
                ALHS::Type::LeafType,
@@ -103,6 +107,9 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Binary, Expr, Devic
                                    ARHS>::Type::Level>(
             lhs, ARHS(i_lhs_output, i_rhs_output)),
         dev);
+    /// the children outputs are not needed anymore
+    release_intermediate(dev, i_lhs_output);
+    release_intermediate(dev, i_rhs_output);
     return lhs;
   }
 };
@@ -132,6 +139,7 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Binary,
     using ARHS =
         typename Expr::template ExprExchange<LHS, decltype(i_rhs_output)>;
     fuse<LC, LR, LCT, LRT>(ARHS(expr.lhs, i_rhs_output), dev);
+    release_intermediate(dev, i_rhs_output);
     return expr.lhs;
   }
 };
@@ -0,0 +1,386 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file profiler.hpp
+/// \brief This file contains the profiler recording the kernels executed by a
+/// device. Each kernel is recorded with its expression, its tile and the bytes
+/// of its global memories. The records are exported as a Chrome trace (opened
+/// with chrome://tracing) or summarised in a table.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PROFILER_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PROFILER_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace visioncpp {
+/// \struct kernel_record
+/// \brief kernel_record describes one kernel executed by a device. The
+/// timestamps are in nanoseconds. They are taken from the queue profiling
+/// information on the sycl backend and from the host clock on the native
+/// backend.
+struct kernel_record {
+  /// the operations of the kernel, e.g. OP_Filter2D_One(OP_RGBToGREY(image))
+  std::string name;
+  /// the operation category of the kernel root: point, neighbour or
+  /// global_neighbour
+  std::string category;
+  /// the column size of the local memory
+  size_t LC;
+  /// the row size of the local memory
+  size_t LR;
+  /// the total number of threads in the column dimension
+  size_t CGT;
+  /// the total number of threads in the row dimension
+  size_t RGT;
+  /// the column size of the workgroup
+  size_t CLT;
+  /// the row size of the workgroup
+  size_t RLT;
+  /// the size of the global memories accessed by the kernel
+  size_t bytes;
+  /// the time the kernel has been submitted
+  uint64_t submit;
+  /// the time the kernel has started
+  uint64_t start;
+  /// the time the kernel has ended
+  uint64_t end;
+  /// \brief returns the execution time of the kernel in milliseconds
+  double duration_ms() const { return (end - start) * 1e-6; }
+};
+
+/// \class profiler
+/// \brief profiler collects the kernel_record of each kernel executed by the
+/// devices created with it (see make_device). The sycl kernels are recorded
+/// when they are submitted, and their timestamps are read once they are
+/// complete, when the records are requested. The profiler must outlive the
+/// devices using it.
+class profiler {
+  /// completes the timestamps of a record once its kernel is complete
+  using Resolver = std::function<void(kernel_record &)>;
+  std::vector<kernel_record> kernels;
+  std::vector<Resolver> resolvers;
+  mutable std::mutex mutex;
+
+  /// \brief completes the records whose kernels are pending
+  void resolve() {
+    for (size_t i = 0; i < resolvers.size(); i++) {
+      if (resolvers[i]) {
+        resolvers[i](kernels[i]);
+        resolvers[i] = nullptr;
+      }
+    }
+  }
+
+  /// \brief escapes a string for JSON
+  static std::string escape(const std::string &str) {
+    std::string out;
+    for (const char c : str) {
+      if (c == '"' || c == '\\') {
+        out += '\\';
+      }
+      out += c;
+    }
+    return out;
+  }
+
+ public:
+  profiler() = default;
+  profiler(const profiler &) = delete;
+  profiler &operator=(const profiler &) = delete;
+
+  /// \brief adds the record of a kernel
+  /// \param record: the record of the kernel
+  /// \param resolver: the function completing the timestamps once the kernel
+  /// is complete. It is empty when the timestamps are already known.
+  /// \return void
+  void add(const kernel_record &record, Resolver resolver = nullptr) {
+    std::lock_guard<std::mutex> lock(mutex);
+    kernels.push_back(record);
+    resolvers.push_back(resolver);
+  }
+
+  /// \brief returns the records of the kernels in their order of submission.
+  /// It waits for the kernels which are not complete.
+  /// \return std::vector<kernel_record>
+  std::vector<kernel_record> records() {
+    std::lock_guard<std::mutex> lock(mutex);
+    resolve();
+    return kernels;
+  }
+
+  /// \brief removes all the records
+  /// \return void
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    kernels.clear();
+    resolvers.clear();
+  }
+
+  /// \brief writes the records as a Chrome trace. Each kernel is a complete
+  /// event whose arguments are its tile, its bytes and its queuing time. The
+  /// time starts at the first submission.
+  /// \param os: the output stream
+  /// \return void
+  void write_chrome_trace(std::ostream &os) {
+    const std::vector<kernel_record> all = records();
+    uint64_t origin = all.empty() ? 0 : all.front().submit;
+    for (const auto &k : all) {
+      origin = std::min(origin, k.submit);
+    }
+    const std::ios::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << "{\"traceEvents\":[";
+    for (size_t i = 0; i < all.size(); i++) {
+      const kernel_record &k = all[i];
+      os << (i == 0 ? "\n" : ",\n") << "{\"name\":\"" << escape(k.name)
+         << "\",\"cat\":\"" << k.category
+         << "\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":" << std::fixed
+         << std::setprecision(3) << (k.start - origin) * 1e-3
+         << ",\"dur\":" << (k.end - k.start) * 1e-3 << ",\"args\":{\"LC\":"
+         << k.LC << ",\"LR\":" << k.LR << ",\"CGT\":" << k.CGT
+         << ",\"RGT\":" << k.RGT << ",\"CLT\":" << k.CLT
+         << ",\"RLT\":" << k.RLT << ",\"bytes\":" << k.bytes
+         << ",\"queued_us\":" << (k.start - k.submit) * 1e-3 << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+  /// \brief writes the records as a Chrome trace in a file
+  /// \param path: the file path
+  /// \return bool: false when the file cannot be written
+  bool save_chrome_trace(const std::string &path) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+      return false;
+    }
+    write_chrome_trace(file);
+    return static_cast<bool>(file);
+  }
+
+  /// \brief writes a table aggregating the kernels by name, sorted by their
+  /// total time. It gives the number of executions, the total and mean time,
+  /// the share of the total time and the achieved bandwidth of each kernel.
+  /// \param os: the output stream
+  /// \return void
+  void write_summary(std::ostream &os) {
+    struct Aggregate {
+      std::string name;
+      size_t count;
+      double total_ms;
+      double bytes;
+    };
+    std::map<std::string, Aggregate> by_name;
+    double total_ms = 0;
+    for (const auto &k : records()) {
+      auto &entry = by_name[k.name];
+      entry.name = k.name;
+      entry.count++;
+      entry.total_ms += k.duration_ms();
+      entry.bytes += k.bytes;
+      total_ms += k.duration_ms();
+    }
+    std::vector<Aggregate> rows;
+    for (const auto &entry : by_name) {
+      rows.push_back(entry.second);
+    }
+    std::sort(rows.begin(), rows.end(),
+              [](const Aggregate &a, const Aggregate &b) {
+                return a.total_ms > b.total_ms;
+              });
+    const std::ios::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << std::left << std::setw(8) << "count" << std::setw(12) << "total ms"
+       << std::setw(12) << "mean ms" << std::setw(8) << "%" << std::setw(10)
+       << "GB/s"
+       << "kernel\n";
+    for (const auto &row : rows) {
+      os << std::left << std::fixed << std::setprecision(3) << std::setw(8)
+         << row.count << std::setw(12) << row.total_ms << std::setw(12)
+         << row.total_ms / row.count << std::setprecision(1) << std::setw(8)
+         << (total_ms > 0 ? 100 * row.total_ms / total_ms : 0)
+         << std::setw(10)
+         << (row.total_ms > 0 ? row.bytes / (row.total_ms * 1e6) : 0)
+         << row.name << '\n';
+    }
+    os.flags(flags);
+    os.precision(precision);
+  }
+};
+
+namespace internal {
+/// function demangle
+/// \brief returns the readable name of a type when the compiler provides the
+/// demangler. The namespaces and template arguments are removed.
+/// \tparam T: the type
+/// \return std::string
+template <typename T>
+inline std::string demangle() {
+  std::string name = typeid(T).name();
+#if defined(__GNUG__)
+  int status = 0;
+  char *readable =
+      abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+  if (status == 0 && readable) {
+    name = readable;
+  }
+  std::free(readable);
+#endif
+  name = name.substr(0, name.find('<'));
+  const size_t scope = name.rfind("::");
+  return scope == std::string::npos ? name : name.substr(scope + 2);
+}
+
+/// \struct KernelName
+/// \brief KernelName gives the operations of an expression as nested calls of
+/// the user operators. The leaves are named image.
+/// template parameters:
+/// \tparam Expr : the node type
+/// \tparam Category : the ND_Category of the node
+template <typename Expr, size_t Category = Expr::ND_Category>
+struct KernelName {
+  static inline std::string get() { return demangle<Expr>(); }
+};
+/// \brief specialisation of the KernelName for the LeafNode
+template <typename RHS, size_t LVL>
+struct KernelName<LeafNode<RHS, LVL>, expr_category::Unary> {
+  static inline std::string get() { return "image"; }
+};
+/// \brief specialisation of the KernelName when the node has one child
+template <typename Expr>
+struct KernelName<Expr, expr_category::Unary> {
+  static inline std::string get() {
+    return demangle<typename Expr::OPType::OP>() + "(" +
+           KernelName<typename Expr::RHSExpr>::get() + ")";
+  }
+};
+/// \brief specialisation of the KernelName when the node has two children
+template <typename Expr>
+struct KernelName<Expr, expr_category::Binary> {
+  static inline std::string get() {
+    return demangle<typename Expr::OPType::OP>() + "(" +
+           KernelName<typename Expr::LHSExpr>::get() + ", " +
+           KernelName<typename Expr::RHSExpr>::get() + ")";
+  }
+};
+/// \brief specialisation of the KernelName for Assign. The kernel is named
+/// after the expression assigned to the output.
+template <typename LHS, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct KernelName<Assign<LHS, RHS, Cols, Rows, LfType, LVL>,
+                  expr_category::Binary> {
+  static inline std::string get() { return KernelName<RHS>::get(); }
+};
+
+/// \struct AccessedBytes
+/// \brief AccessedBytes computes the size in bytes of the global memories
+/// accessed by an expression, one per leaf node.
+/// template parameters:
+/// \tparam Expr : the node type
+/// \tparam Category : the ND_Category of the node
+template <typename Expr, size_t Category = Expr::ND_Category>
+struct AccessedBytes {
+  static inline size_t get(const Expr &) { return 0; }
+};
+/// \brief specialisation of the AccessedBytes for the LeafNode
+template <typename RHS, size_t LVL>
+struct AccessedBytes<LeafNode<RHS, LVL>, expr_category::Unary> {
+  static inline size_t get(const LeafNode<RHS, LVL> &expr) {
+    return expr.vilibMemory.get_cols() * expr.vilibMemory.get_rows() *
+           expr.vilibMemory.get_batch() * sizeof(typename RHS::ElementType);
+  }
+};
+/// \brief specialisation of the AccessedBytes when the node has one child
+template <typename Expr>
+struct AccessedBytes<Expr, expr_category::Unary> {
+  static inline size_t get(const Expr &expr) {
+    return AccessedBytes<typename Expr::RHSExpr>::get(expr.rhs);
+  }
+};
+/// \brief specialisation of the AccessedBytes when the node has two children
+template <typename Expr>
+struct AccessedBytes<Expr, expr_category::Binary> {
+  static inline size_t get(const Expr &expr) {
+    return AccessedBytes<typename Expr::LHSExpr>::get(expr.lhs) +
+           AccessedBytes<typename Expr::RHSExpr>::get(expr.rhs);
+  }
+};
+
+/// function host_timestamp
+/// \brief returns the time of the host clock in nanoseconds
+/// \return uint64_t
+inline uint64_t host_timestamp() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             tools::get_current_time().time_since_epoch())
+      .count();
+}
+
+/// function make_kernel_record
+/// \brief creates the record of a kernel before it is executed. The
+/// timestamps are set by the device.
+/// template parameters:
+/// \tparam LC: the column size of the local memory
+/// \tparam LR: the row size of the local memory
+/// \tparam CLT: the column size of the workgroup
+/// \tparam RLT: the row size of the workgroup
+/// function parameters:
+/// \param expr : the expression executed by the kernel
+/// \param cGThreads : the total number of threads in the column dimension
+/// \param rGThreads : the total number of threads in the row dimension
+/// \return kernel_record
+template <size_t LC, size_t LR, size_t CLT, size_t RLT, typename Expr>
+inline kernel_record make_kernel_record(const Expr &expr, size_t cGThreads,
+                                        size_t rGThreads) {
+  kernel_record record;
+  record.name = KernelName<Expr>::get();
+  record.category =
+      Expr::Operation_type == ops_category::PointOP
+          ? "point"
+          : Expr::Operation_type == ops_category::NeighbourOP
+                ? "neighbour"
+                : "global_neighbour";
+  record.LC = LC;
+  record.LR = LR;
+  record.CGT = cGThreads;
+  record.RGT = rGThreads;
+  record.CLT = CLT;
+  record.RLT = RLT;
+  record.bytes = AccessedBytes<Expr>::get(expr);
+  record.submit = record.start = record.end = 0;
+  return record;
+}
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PROFILER_HPP_
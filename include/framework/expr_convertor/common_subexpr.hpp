@@ -0,0 +1,360 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file common_subexpr.hpp
+/// \brief This file contains the common subexpression elimination. The
+/// expression tree is built from values, so a subexpression used by several
+/// nodes is copied into each of them. CommonSubexpr finds the subexpressions
+/// appearing more than once in the tree and replaces them with a scheduled
+/// node, so they are executed once and read by all their consumers. The
+/// SubtreeKey of a subexpression is used at runtime to recognise the copies
+/// reading the same leaf buffers.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_COMMON_SUBEXPR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_COMMON_SUBEXPR_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct SubtreeCategory
+/// \brief SubtreeCategory gives the category of the nodes whose children are
+/// visited by the common subexpression elimination. Any other node (leaf
+/// nodes, pyramids, partial assigns) is seen as Nullary and is kept as it is.
+/// IsNeighbour is true when the node itself is a neighbour operation.
+/// template parameters:
+/// \tparam Expr : the node type
+template <typename Expr>
+struct SubtreeCategory {
+  static constexpr size_t Value = expr_category::Nullary;
+  static constexpr bool IsNeighbour = false;
+};
+/// \brief specialisation of the SubtreeCategory for RUnOP
+template <typename OP, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct SubtreeCategory<RUnOP<OP, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = expr_category::Unary;
+  static constexpr bool IsNeighbour = false;
+};
+/// \brief specialisation of the SubtreeCategory for RBiOP
+template <typename OP, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct SubtreeCategory<RBiOP<OP, LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = expr_category::Binary;
+  static constexpr bool IsNeighbour = false;
+};
+/// \brief specialisation of the SubtreeCategory for Lookup
+template <typename OP, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct SubtreeCategory<Lookup<OP, LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = expr_category::Binary;
+  static constexpr bool IsNeighbour = false;
+};
+/// \brief specialisation of the SubtreeCategory for StnFilt
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct SubtreeCategory<StnFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS,
+                               Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = expr_category::Binary;
+  static constexpr bool IsNeighbour = true;
+};
+/// \brief specialisation of the SubtreeCategory for StnNoFilt
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct SubtreeCategory<StnNoFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols,
+                                 Rows, LfType, LVL>> {
+  static constexpr size_t Value = expr_category::Unary;
+  static constexpr bool IsNeighbour = true;
+};
+/// \brief specialisation of the SubtreeCategory for RDCN
+template <typename OP, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct SubtreeCategory<RDCN<OP, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = expr_category::Unary;
+  static constexpr bool IsNeighbour = true;
+};
+/// \brief specialisation of the SubtreeCategory for Assign
+template <typename LHS, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct SubtreeCategory<Assign<LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = expr_category::Binary;
+  static constexpr bool IsNeighbour = false;
+};
+
+/// \struct SubtreeCount
+/// \brief SubtreeCount counts the occurrences of the type T in the expression
+/// tree.
+/// template parameters:
+/// \tparam T : the subexpression type to count
+/// \tparam Expr : the expression tree
+/// \tparam Category : the SubtreeCategory of the Expr
+template <typename T, typename Expr,
+          size_t Category = SubtreeCategory<Expr>::Value>
+struct SubtreeCount {
+  static constexpr size_t Count = std::is_same<T, Expr>::value;
+};
+/// \brief specialisation of the SubtreeCount when the node has one child
+template <typename T, typename Expr>
+struct SubtreeCount<T, Expr, expr_category::Unary> {
+  static constexpr size_t Count =
+      std::is_same<T, Expr>::value +
+      SubtreeCount<T, typename Expr::RHSExpr>::Count;
+};
+/// \brief specialisation of the SubtreeCount when the node has two children
+template <typename T, typename Expr>
+struct SubtreeCount<T, Expr, expr_category::Binary> {
+  static constexpr size_t Count =
+      std::is_same<T, Expr>::value +
+      SubtreeCount<T, typename Expr::LHSExpr>::Count +
+      SubtreeCount<T, typename Expr::RHSExpr>::Count;
+};
+
+/// \struct ScheduleCommon
+/// \brief ScheduleCommon replaces a common subexpression with a LeafNode of
+/// VirtualMemory, exactly as schedule does.
+/// template parameters:
+/// \tparam IsCommon : true when the expression is a common subexpression
+/// \tparam ExecPolicy : the policy used for executing the expression
+/// \tparam LC: the column size of local memory
+/// \tparam LR: the row size of local memory
+/// \tparam LCT: the column size of workgroup
+/// \tparam LRT: the row size of workgroup
+/// \tparam Expr : the expression type
+template <bool IsCommon, bool ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr>
+struct ScheduleCommon {
+  using Type = Expr;
+  static inline Type get(const Expr &expr) { return expr; }
+};
+/// \brief specialisation of the ScheduleCommon for a common subexpression
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Expr>
+struct ScheduleCommon<true, ExecPolicy, LC, LR, LCT, LRT, Expr> {
+  using Memory = VirtualMemory<ExecPolicy, Expr, LC, LR, LCT, LRT>;
+  using Type = LeafNode<Memory, Expr::Level>;
+  static inline Type get(const Expr &expr) { return Type(Memory(expr)); }
+};
+
+/// \struct IsCommonSubexpr
+/// \brief IsCommonSubexpr decides whether or not the Expr is a candidate for
+/// CommonSubexpr. A subexpression is a candidate when its type appears more
+/// than once in the Root. With the Fuse policy only the neighbour operations
+/// are candidates, as executing the point operations above them again is
+/// cheaper than writing and reading their result. Identical types do not
+/// always mean identical subexpressions (e.g. the same filter applied to two
+/// frames), so the candidates are only scheduled when shares_common_subexpr
+/// finds that they read the same leaves at runtime.
+/// template parameters:
+/// \tparam ExecPolicy : the policy used for executing the expression
+/// \tparam Root : the type of the whole expression tree
+/// \tparam Expr : the node type
+template <bool ExecPolicy, typename Root, typename Expr>
+struct IsCommonSubexpr {
+  static constexpr bool Value =
+      !Expr::has_out &&
+      (ExecPolicy == policy::NoFuse || SubtreeCategory<Expr>::IsNeighbour) &&
+      (SubtreeCount<Expr, Root>::Count > 1);
+};
+
+/// \struct CommonSubexpr
+/// \brief CommonSubexpr rebuilds the expression tree where each common
+/// subexpression has been scheduled. Changed is false when the tree has no
+/// common subexpression, so it can be executed as it is.
+/// template parameters:
+/// \tparam ExecPolicy : the policy used for executing the expression
+/// \tparam LC: the column size of local memory
+/// \tparam LR: the row size of local memory
+/// \tparam LCT: the column size of workgroup
+/// \tparam LRT: the row size of workgroup
+/// \tparam Root : the type of the whole expression tree
+/// \tparam Expr : the node type
+/// \tparam Category : the SubtreeCategory of the Expr
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Root, typename Expr,
+          size_t Category = SubtreeCategory<Expr>::Value>
+struct CommonSubexpr {
+  static constexpr bool Changed = false;
+  using Type = Expr;
+  static inline Type convert(const Expr &expr) { return expr; }
+};
+
+/// \brief specialisation of the CommonSubexpr when the node has one child
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Root, typename Expr>
+struct CommonSubexpr<ExecPolicy, LC, LR, LCT, LRT, Root, Expr,
+                     expr_category::Unary> {
+  static constexpr bool IsCommon =
+      IsCommonSubexpr<ExecPolicy, Root, Expr>::Value;
+  using RHS = CommonSubexpr<ExecPolicy, LC, LR, LCT, LRT, Root,
+                            typename Expr::RHSExpr>;
+  using Node = typename Expr::template ExprExchange<typename RHS::Type>;
+  using Schedule = ScheduleCommon<IsCommon, ExecPolicy, LC, LR, LCT, LRT, Node>;
+  static constexpr bool Changed = IsCommon || RHS::Changed;
+  using Type = typename Schedule::Type;
+  static inline Type convert(const Expr &expr) {
+    return Schedule::get(Node(RHS::convert(expr.rhs)));
+  }
+};
+
+/// \brief specialisation of the CommonSubexpr when the node has two children
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename Root, typename Expr>
+struct CommonSubexpr<ExecPolicy, LC, LR, LCT, LRT, Root, Expr,
+                     expr_category::Binary> {
+  static constexpr bool IsCommon =
+      IsCommonSubexpr<ExecPolicy, Root, Expr>::Value;
+  using LHS = CommonSubexpr<ExecPolicy, LC, LR, LCT, LRT, Root,
+                            typename Expr::LHSExpr>;
+  using RHS = CommonSubexpr<ExecPolicy, LC, LR, LCT, LRT, Root,
+                            typename Expr::RHSExpr>;
+  using Node = typename Expr::template ExprExchange<typename LHS::Type,
+                                                    typename RHS::Type>;
+  using Schedule = ScheduleCommon<IsCommon, ExecPolicy, LC, LR, LCT, LRT, Node>;
+  static constexpr bool Changed = IsCommon || LHS::Changed || RHS::Changed;
+  using Type = typename Schedule::Type;
+  static inline Type convert(const Expr &expr) {
+    return Schedule::get(
+        Node(LHS::convert(expr.lhs), RHS::convert(expr.rhs)));
+  }
+};
+
+/// \struct LeafIdentity
+/// \brief LeafIdentity collects the sycl buffers read by the leaves of an
+/// expression into a SubtreeKey.
+/// template parameters:
+/// \tparam Expr : the node type
+/// \tparam Category : the SubtreeCategory of the Expr
+template <typename Expr, size_t Category = SubtreeCategory<Expr>::Value>
+struct LeafIdentity {
+  /// \brief the node cannot be identified, so the key is not valid
+  static inline void collect(const Expr &, SubtreeKey &key) {
+    key.valid = false;
+  }
+};
+/// \brief specialisation of the LeafIdentity for the LeafNode of a
+/// VisionMemory. It is identified by its sycl buffer.
+template <bool MapAllocator, size_t ScalarType, size_t MemoryType,
+          typename Sclr, size_t Col, size_t Row, typename ElementTp,
+          size_t Elements, size_t Sc, size_t LVL, size_t LeafLVL>
+struct LeafIdentity<LeafNode<VisionMemory<MapAllocator, ScalarType, MemoryType,
+                                          Sclr, Col, Row, ElementTp, Elements,
+                                          Sc, LVL>,
+                             LeafLVL>,
+                    expr_category::Nullary> {
+  template <typename Expr>
+  static inline void collect(const Expr &expr, SubtreeKey &key) {
+    key.leaves.push_back(expr.vilibMemory.syclData.get());
+  }
+};
+/// \brief specialisation of the LeafIdentity when the node has one child
+template <typename Expr>
+struct LeafIdentity<Expr, expr_category::Unary> {
+  static inline void collect(const Expr &expr, SubtreeKey &key) {
+    LeafIdentity<typename Expr::RHSExpr>::collect(expr.rhs, key);
+  }
+};
+/// \brief specialisation of the LeafIdentity when the node has two children
+template <typename Expr>
+struct LeafIdentity<Expr, expr_category::Binary> {
+  static inline void collect(const Expr &expr, SubtreeKey &key) {
+    LeafIdentity<typename Expr::LHSExpr>::collect(expr.lhs, key);
+    LeafIdentity<typename Expr::RHSExpr>::collect(expr.rhs, key);
+  }
+};
+
+/// function make_subtree_key
+/// \brief returns the SubtreeKey identifying the result of the expression
+/// \param expr : the expression
+/// \return SubtreeKey
+template <typename Expr>
+inline SubtreeKey make_subtree_key(const Expr &expr) {
+  SubtreeKey key(std::type_index(typeid(Expr)));
+  LeafIdentity<Expr>::collect(expr, key);
+  return key;
+}
+
+/// \struct CommonCandidates
+/// \brief CommonCandidates collects the SubtreeKey of each occurrence of the
+/// candidates of IsCommonSubexpr in the expression tree.
+/// template parameters:
+/// \tparam ExecPolicy : the policy used for executing the expression
+/// \tparam Root : the type of the whole expression tree
+/// \tparam Expr : the node type
+/// \tparam Category : the SubtreeCategory of the Expr
+template <bool ExecPolicy, typename Root, typename Expr,
+          size_t Category = SubtreeCategory<Expr>::Value>
+struct CommonCandidates {
+  static inline void collect(const Expr &, std::vector<SubtreeKey> &) {}
+};
+/// \brief specialisation of the CommonCandidates when the node has one child
+template <bool ExecPolicy, typename Root, typename Expr>
+struct CommonCandidates<ExecPolicy, Root, Expr, expr_category::Unary> {
+  static inline void collect(const Expr &expr, std::vector<SubtreeKey> &keys) {
+    if (IsCommonSubexpr<ExecPolicy, Root, Expr>::Value) {
+      keys.push_back(make_subtree_key(expr));
+    }
+    CommonCandidates<ExecPolicy, Root, typename Expr::RHSExpr>::collect(
+        expr.rhs, keys);
+  }
+};
+/// \brief specialisation of the CommonCandidates when the node has two
+/// children
+template <bool ExecPolicy, typename Root, typename Expr>
+struct CommonCandidates<ExecPolicy, Root, Expr, expr_category::Binary> {
+  static inline void collect(const Expr &expr, std::vector<SubtreeKey> &keys) {
+    if (IsCommonSubexpr<ExecPolicy, Root, Expr>::Value) {
+      keys.push_back(make_subtree_key(expr));
+    }
+    CommonCandidates<ExecPolicy, Root, typename Expr::LHSExpr>::collect(
+        expr.lhs, keys);
+    CommonCandidates<ExecPolicy, Root, typename Expr::RHSExpr>::collect(
+        expr.rhs, keys);
+  }
+};
+
+/// function shares_common_subexpr
+/// \brief returns true when each candidate of IsCommonSubexpr reads the same
+/// leaves as another occurrence of its type, so scheduling the candidates
+/// only executes shared results. A single candidate which is not shared
+/// would be split into its own kernel for nothing, in which case the
+/// expression is executed as it is.
+/// template parameters:
+/// \tparam ExecPolicy : the policy used for executing the expression
+/// \tparam Expr : the expression type
+/// function parameters:
+/// \param expr : the expression
+/// \return bool
+template <bool ExecPolicy, typename Expr>
+inline bool shares_common_subexpr(const Expr &expr) {
+  std::vector<SubtreeKey> keys;
+  CommonCandidates<ExecPolicy, Expr, Expr>::collect(expr, keys);
+  for (size_t i = 0; i < keys.size(); i++) {
+    bool shared = false;
+    for (size_t j = 0; j < keys.size() && !shared; j++) {
+      shared = (i != j) && (keys[i] == keys[j]);
+    }
+    if (!shared) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_COMMON_SUBEXPR_HPP_
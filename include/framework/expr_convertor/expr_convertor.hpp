@@ -70,9 +70,12 @@ struct MakePlaceHolderExprHelper;
 }  // internal
 }  // visioncpp
 // Static Operation Over Type
+#include "common_subexpr.hpp"
+#include "fusion_partition.hpp"
 #include "leaf_count.hpp"
 #include "local_mem_count.hpp"
 #include "local_output.hpp"
 #include "make_place_holder_expr.hpp"
 #include "place_holder_leaf_node.hpp"
+#include "runtime_extent.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_EXPR_CONVERTOR_HPP_
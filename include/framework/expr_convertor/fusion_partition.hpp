@@ -0,0 +1,397 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file fusion_partition.hpp
+/// \brief This file contains the cost model used to partition a fused
+/// expression tree into kernels. When a neighbour operation is fused with its
+/// input, the input is recomputed for the halo of every workgroup and is kept
+/// in local memory. FusionPartition walks the tree from the root, estimates
+/// for the input of each neighbour operation the cost of fusing it against the
+/// cost of writing it to global memory, and schedules the input in a separate
+/// kernel when it is cheaper or when its local memory exceeds the budget.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_FUSION_PARTITION_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_FUSION_PARTITION_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct FusionCost
+/// \brief FusionCost contains the constants of the cost model. The costs are
+/// counted in operations per pixel.
+struct FusionCost {
+  /// the cost of one byte written to or read from global memory
+  static constexpr size_t GlobalByte = 4;
+  /// the cost of launching one more kernel, for each workgroup
+  static constexpr size_t Launch = 64;
+  /// the local memory budget of a kernel in bytes. This is the minimum local
+  /// memory size of an OpenCL device.
+  static constexpr size_t LocalMemory = 32768;
+  /// false when VISIONCPP_NO_FUSION_PARTITION is defined, in which case each
+  /// fused expression is executed in one kernel, whatever its cost
+#ifdef VISIONCPP_NO_FUSION_PARTITION
+  static constexpr bool Enabled = false;
+#else
+  static constexpr bool Enabled = true;
+#endif
+};
+
+/// \struct FusionCategory
+/// \brief FusionCategory gives the category of the nodes visited by the
+/// partitioner. It is the SubtreeCategory, except for the reduction which is
+/// never fused with its input.
+/// template parameters:
+/// \tparam Expr : the node type
+template <typename Expr>
+struct FusionCategory {
+  static constexpr size_t Value = SubtreeCategory<Expr>::Value;
+};
+/// \brief specialisation of the FusionCategory for RDCN
+template <typename OP, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct FusionCategory<RDCN<OP, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = expr_category::Nullary;
+};
+
+/// \struct FusionHalo
+/// \brief FusionHalo gives the number of columns and rows a node adds to the
+/// local memory of its input. It is zero for the point operations.
+/// IsNeighbour is true when the node is a stencil operation.
+/// template parameters:
+/// \tparam Expr : the node type
+template <typename Expr>
+struct FusionHalo {
+  static constexpr size_t Halo_COL = 0;
+  static constexpr size_t Halo_ROW = 0;
+  static constexpr bool IsNeighbour = false;
+};
+/// \brief specialisation of the FusionHalo for StnFilt
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct FusionHalo<StnFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
+                          Rows, LfType, LVL>> {
+  static constexpr size_t Halo_COL = Halo_L + Halo_R;
+  static constexpr size_t Halo_ROW = Halo_T + Halo_B;
+  static constexpr bool IsNeighbour = true;
+};
+/// \brief specialisation of the FusionHalo for StnNoFilt
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct FusionHalo<StnNoFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols, Rows,
+                            LfType, LVL>> {
+  static constexpr size_t Halo_COL = Halo_L + Halo_R;
+  static constexpr size_t Halo_ROW = Halo_T + Halo_B;
+  static constexpr bool IsNeighbour = true;
+};
+
+/// \struct FusedWith
+/// \brief FusedWith is true when the child is executed in the kernel of its
+/// parent. A child of a different size is already executed in a separate
+/// kernel by the sub expression evaluation.
+/// template parameters:
+/// \tparam Parent : the parent node type
+/// \tparam Expr : the child node type
+template <typename Parent, typename Expr>
+struct FusedWith {
+  static constexpr bool Value =
+      FusionCategory<Expr>::Value != expr_category::Nullary &&
+      Expr::CThread == Parent::CThread && Expr::RThread == Parent::RThread;
+};
+
+/// \struct FusionWork
+/// \brief FusionWork estimates the number of operations needed to compute
+/// one pixel of a node and of the children executed in its kernel. A
+/// neighbour operation costs one operation per element of its neighbourhood.
+/// template parameters:
+/// \tparam Expr : the node type
+/// \tparam Category : the FusionCategory of the Expr
+template <typename Expr, size_t Category = FusionCategory<Expr>::Value>
+struct FusionWork {
+  static constexpr size_t Value = 0;
+};
+/// \brief specialisation of the FusionWork when the node has one child
+template <typename Expr>
+struct FusionWork<Expr, expr_category::Unary> {
+  using RHS = typename Expr::RHSExpr;
+  static constexpr size_t Value =
+      (FusionHalo<Expr>::Halo_COL + 1) * (FusionHalo<Expr>::Halo_ROW + 1) +
+      (FusedWith<Expr, RHS>::Value ? FusionWork<RHS>::Value : 0);
+};
+/// \brief specialisation of the FusionWork when the node has two children
+template <typename Expr>
+struct FusionWork<Expr, expr_category::Binary> {
+  using LHS = typename Expr::LHSExpr;
+  using RHS = typename Expr::RHSExpr;
+  static constexpr size_t Value =
+      (FusionHalo<Expr>::Halo_COL + 1) * (FusionHalo<Expr>::Halo_ROW + 1) +
+      (FusedWith<Expr, LHS>::Value ? FusionWork<LHS>::Value : 0) +
+      (FusedWith<Expr, RHS>::Value ? FusionWork<RHS>::Value : 0);
+};
+
+/// \struct FusionLeafBytes
+/// \brief FusionLeafBytes gives the size of one element of the local memory
+/// created for a node which is not fused with its children. There is no local
+/// memory for the const variables and the buffers on constant memory.
+/// template parameters:
+/// \tparam Expr : the node type
+template <typename Expr>
+struct FusionLeafBytes {
+  static constexpr size_t Value = sizeof(typename Expr::OutType);
+};
+/// \brief specialisation of the FusionLeafBytes for a const variable
+template <bool MapAllocator, size_t ScalarType, typename Sclr, size_t Col,
+          size_t Row, size_t LVL, size_t LeafLVL>
+struct FusionLeafBytes<
+    LeafNode<VisionMemory<MapAllocator, ScalarType, memory_type::Const, Sclr,
+                          Col, Row, Sclr, 1, scope::Global, LVL>,
+             LeafLVL>> {
+  static constexpr size_t Value = 0;
+};
+/// \brief specialisation of the FusionLeafBytes for a buffer on constant
+/// memory
+template <bool MapAllocator, size_t ScalarType, size_t MemoryType,
+          typename Sclr, size_t Col, size_t Row, typename ElementTp,
+          size_t Elements, size_t LVL, size_t LeafLVL>
+struct FusionLeafBytes<
+    LeafNode<VisionMemory<MapAllocator, ScalarType, MemoryType, Sclr, Col, Row,
+                          ElementTp, Elements, scope::Constant, LVL>,
+             LeafLVL>> {
+  static constexpr size_t Value = 0;
+};
+
+/// \struct FusionOutput
+/// \brief FusionOutput gives the local memory in bytes created for the output
+/// of a node computing a TC x TR tile. The tile is the one of the LocalOutput
+/// of the node, so the estimate follows the memory created by the kernel.
+/// template parameters:
+/// \tparam TC : the column size of the tile of the node
+/// \tparam TR : the row size of the tile of the node
+/// \tparam Expr : the node type
+template <size_t TC, size_t TR, typename Expr>
+struct FusionOutput {
+  using Local = LocalOutput<false, false, TC, TR, Expr>;
+  static constexpr size_t Value =
+      sizeof(typename Expr::OutType) * Local::Out_LC * Local::Out_LR;
+};
+
+/// \struct FusionLocal
+/// \brief FusionLocal computes the local memory in bytes used by a node and
+/// the children executed in its kernel when the node computes a TC x TR tile.
+/// The input of a neighbour operation is computed on a tile enlarged by the
+/// halo, as done by the LocalOutput.
+/// template parameters:
+/// \tparam TC : the column size of the tile of the node
+/// \tparam TR : the row size of the tile of the node
+/// \tparam Expr : the node type
+/// \tparam Category : the FusionCategory of the Expr
+template <size_t TC, size_t TR, typename Expr,
+          size_t Category = FusionCategory<Expr>::Value>
+struct FusionLocal {
+  static constexpr size_t Value = FusionLeafBytes<Expr>::Value * TC * TR;
+};
+/// \brief specialisation of the FusionLocal when the node has one child
+template <size_t TC, size_t TR, typename Expr>
+struct FusionLocal<TC, TR, Expr, expr_category::Unary> {
+  using RHS = typename Expr::RHSExpr;
+  static constexpr size_t CC = TC + FusionHalo<Expr>::Halo_COL;
+  static constexpr size_t CR = TR + FusionHalo<Expr>::Halo_ROW;
+  static constexpr size_t Value =
+      FusionOutput<TC, TR, Expr>::Value +
+      (FusedWith<Expr, RHS>::Value ? FusionLocal<CC, CR, RHS>::Value
+                                   : FusionLeafBytes<RHS>::Value * CC * CR);
+};
+/// \brief specialisation of the FusionLocal when the node has two children.
+/// Only the left-hand side is the input of a StnFilt.
+template <size_t TC, size_t TR, typename Expr>
+struct FusionLocal<TC, TR, Expr, expr_category::Binary> {
+  using LHS = typename Expr::LHSExpr;
+  using RHS = typename Expr::RHSExpr;
+  static constexpr size_t CC = TC + FusionHalo<Expr>::Halo_COL;
+  static constexpr size_t CR = TR + FusionHalo<Expr>::Halo_ROW;
+  static constexpr size_t Value =
+      FusionOutput<TC, TR, Expr>::Value +
+      (FusedWith<Expr, LHS>::Value ? FusionLocal<CC, CR, LHS>::Value
+                                   : FusionLeafBytes<LHS>::Value * CC * CR) +
+      (FusedWith<Expr, RHS>::Value ? FusionLocal<TC, TR, RHS>::Value
+                                   : FusionLeafBytes<RHS>::Value * TC * TR);
+};
+
+/// \struct FusionCut
+/// \brief FusionCut decides whether or not the input of a neighbour operation
+/// is executed in a separate kernel. For each LC x LR tile of the kernel, the
+/// fused input is computed on its CC x CR tile, while a separate kernel
+/// computes it once for each pixel, writes it to global memory and the
+/// neighbour operation reads it back with its halo.
+/// template parameters:
+/// \tparam LC: the column size of the tile of the kernel
+/// \tparam LR: the row size of the tile of the kernel
+/// \tparam CC: the column size of the tile of the input
+/// \tparam CR: the row size of the tile of the input
+/// \tparam Expr : the input, partitioned as if it was fused
+template <size_t LC, size_t LR, size_t CC, size_t CR, typename Expr>
+struct FusionCut {
+  static constexpr size_t Work = FusionWork<Expr>::Value;
+  static constexpr size_t Fused = Work * CC * CR;
+  static constexpr size_t Separate =
+      Work * LC * LR +
+      FusionCost::GlobalByte * sizeof(typename Expr::OutType) *
+          (CC * CR + LC * LR) +
+      FusionCost::Launch;
+  static constexpr bool Value =
+      Fused > Separate ||
+      FusionLocal<CC, CR, Expr>::Value > FusionCost::LocalMemory;
+};
+
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          size_t TC, size_t TR, typename Expr, size_t Category>
+struct FusionPartition;
+
+/// \struct FusionChoice
+/// \brief FusionChoice selects the scheduled child when IsCut is true and the
+/// partitioned child otherwise.
+/// template parameters:
+/// \tparam IsCut : true when the child is executed in a separate kernel
+/// \tparam Schedule : the ScheduleCommon of the child
+/// \tparam Partition : the FusionPartition of the child
+template <bool IsCut, typename Schedule, typename Partition>
+struct FusionChoice {
+  using Type = typename Partition::Type;
+  template <typename Expr>
+  static inline Type get(const Expr &expr) {
+    return Partition::convert(expr);
+  }
+};
+/// \brief specialisation of the FusionChoice when the child is scheduled
+template <typename Schedule, typename Partition>
+struct FusionChoice<true, Schedule, Partition> {
+  using Type = typename Schedule::Type;
+  template <typename Expr>
+  static inline Type get(const Expr &expr) {
+    return Schedule::get(expr);
+  }
+};
+
+/// \struct FusionInput
+/// \brief FusionInput partitions the child of a node. The child is kept as it
+/// is when it is not executed in the kernel of its parent, it is scheduled
+/// when FusionCut decides so, otherwise it is partitioned recursively.
+/// template parameters:
+/// \tparam ExecPolicy : the policy used for executing the expression
+/// \tparam LC: the column size of local memory
+/// \tparam LR: the row size of local memory
+/// \tparam LCT: the column size of workgroup
+/// \tparam LRT: the row size of workgroup
+/// \tparam CC: the column size of the tile of the child
+/// \tparam CR: the row size of the tile of the child
+/// \tparam NeighbourInput : true when the child is the input of a neighbour
+/// operation
+/// \tparam Parent : the parent node type
+/// \tparam Expr : the child node type
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          size_t CC, size_t CR, bool NeighbourInput, typename Parent,
+          typename Expr,
+          bool Fused = FusedWith<Parent, Expr>::Value>
+struct FusionInput {
+  static constexpr bool Changed = false;
+  using Type = Expr;
+  static inline Type convert(const Expr &expr) { return expr; }
+};
+/// \brief specialisation of the FusionInput when the child is executed in the
+/// kernel of its parent
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          size_t CC, size_t CR, bool NeighbourInput, typename Parent,
+          typename Expr>
+struct FusionInput<ExecPolicy, LC, LR, LCT, LRT, CC, CR, NeighbourInput,
+                   Parent, Expr, true> {
+  using Partition =
+      FusionPartition<ExecPolicy, LC, LR, LCT, LRT, CC, CR, Expr,
+                      FusionCategory<Expr>::Value>;
+  static constexpr bool IsCut =
+      NeighbourInput && !Expr::has_out &&
+      FusionCut<LC, LR, CC, CR, typename Partition::Type>::Value;
+  using Choice = FusionChoice<
+      IsCut, ScheduleCommon<true, ExecPolicy, LC, LR, LCT, LRT, Expr>,
+      Partition>;
+  static constexpr bool Changed = IsCut || Partition::Changed;
+  using Type = typename Choice::Type;
+  static inline Type convert(const Expr &expr) { return Choice::get(expr); }
+};
+
+/// \struct FusionPartition
+/// \brief FusionPartition rebuilds the expression tree where the inputs of the
+/// neighbour operations chosen by FusionCut have been scheduled. Changed is
+/// false when the whole tree is kept in one kernel.
+/// template parameters:
+/// \tparam ExecPolicy : the policy used for executing the expression
+/// \tparam LC: the column size of local memory
+/// \tparam LR: the row size of local memory
+/// \tparam LCT: the column size of workgroup
+/// \tparam LRT: the row size of workgroup
+/// \tparam TC: the column size of the tile of the node
+/// \tparam TR: the row size of the tile of the node
+/// \tparam Expr : the node type
+/// \tparam Category : the FusionCategory of the Expr
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          size_t TC, size_t TR, typename Expr,
+          size_t Category = FusionCategory<Expr>::Value>
+struct FusionPartition {
+  static constexpr bool Changed = false;
+  using Type = Expr;
+  static inline Type convert(const Expr &expr) { return expr; }
+};
+
+/// \brief specialisation of the FusionPartition when the node has one child
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          size_t TC, size_t TR, typename Expr>
+struct FusionPartition<ExecPolicy, LC, LR, LCT, LRT, TC, TR, Expr,
+                       expr_category::Unary> {
+  using Halo = FusionHalo<Expr>;
+  using RHS = FusionInput<ExecPolicy, LC, LR, LCT, LRT, TC + Halo::Halo_COL,
+                          TR + Halo::Halo_ROW, Halo::IsNeighbour, Expr,
+                          typename Expr::RHSExpr>;
+  static constexpr bool Changed = RHS::Changed;
+  using Type = typename Expr::template ExprExchange<typename RHS::Type>;
+  static inline Type convert(const Expr &expr) {
+    return Type(RHS::convert(expr.rhs));
+  }
+};
+
+/// \brief specialisation of the FusionPartition when the node has two
+/// children. Only the left-hand side is the input of a StnFilt.
+template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          size_t TC, size_t TR, typename Expr>
+struct FusionPartition<ExecPolicy, LC, LR, LCT, LRT, TC, TR, Expr,
+                       expr_category::Binary> {
+  using Halo = FusionHalo<Expr>;
+  using LHS = FusionInput<ExecPolicy, LC, LR, LCT, LRT, TC + Halo::Halo_COL,
+                          TR + Halo::Halo_ROW, Halo::IsNeighbour, Expr,
+                          typename Expr::LHSExpr>;
+  using RHS = FusionInput<ExecPolicy, LC, LR, LCT, LRT, TC, TR, false, Expr,
+                          typename Expr::RHSExpr>;
+  static constexpr bool Changed = LHS::Changed || RHS::Changed;
+  using Type = typename Expr::template ExprExchange<typename LHS::Type,
+                                                    typename RHS::Type>;
+  static inline Type convert(const Expr &expr) {
+    return Type(LHS::convert(expr.lhs), RHS::convert(expr.rhs));
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_FUSION_PARTITION_HPP_
@@ -104,6 +104,39 @@ struct LocalMemCount<
       0 + LocalMemCount<RHSExpr::ND_Category, RHSExpr>::Count;
 };
 
+/// \brief Specialisation of ExtractAccessor class where the expression node is
+/// Lookup. The table is read from global memory, so only the input and the
+/// output of the node have a local memory.
+template <typename LUT_OP, typename LHSExpr, typename RHSExpr, size_t Cols,
+          size_t Rows, size_t LeafType, size_t LVL>
+struct LocalMemCount<expr_category::Binary,
+                     Lookup<LUT_OP, LHSExpr, RHSExpr, Cols, Rows, LeafType,
+                            LVL>> {
+  static constexpr size_t Count =
+      1 + LocalMemCount<LHSExpr::ND_Category, LHSExpr>::Count;
+};
+
+/// \brief Specialisation of ExtractAccessor class where the expression node is
+/// Resize. The input is read from global memory, so only the output of the
+/// node has a local memory.
+template <typename RSZ_OP, typename RHSExpr, size_t Cols, size_t Rows,
+          size_t LeafType, size_t LVL>
+struct LocalMemCount<expr_category::Unary,
+                     Resize<RSZ_OP, RHSExpr, Cols, Rows, LeafType, LVL>> {
+  static constexpr size_t Count = 1;
+};
+
+/// \brief Specialisation of ExtractAccessor class where the expression node is
+/// Warp. The input is read from global memory and the transform from constant
+/// memory, so only the output of the node has a local memory.
+template <typename WARP_OP, typename LHSExpr, typename RHSExpr, size_t Cols,
+          size_t Rows, size_t LeafType, size_t LVL>
+struct LocalMemCount<expr_category::Binary,
+                     Warp<WARP_OP, LHSExpr, RHSExpr, Cols, Rows, LeafType,
+                          LVL>> {
+  static constexpr size_t Count = 1;
+};
+
 }  // internal
 }  // visioncpp
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_LOCAL_MEM_COUNT_HPP_
@@ -25,13 +25,30 @@
 
 namespace visioncpp {
 namespace internal {
+/// \struct LocalAccessor
+/// \brief LocalAccessor is used to select the type of the local memory created
+/// for a node based on the handler used for executing the expression tree. By
+/// default it is a sycl local accessor created through the sycl command group
+/// handler. Other backends specialise it for their own handler.
+/// template parameters:
+/// \tparam HandlerT: the type of the handler used to create the local memory
+/// \tparam T: the element type of the local memory
+/// \tparam Dim: the dimension of the local memory
+template <typename HandlerT, typename T, size_t Dim>
+struct LocalAccessor {
+  using Type =
+      cl::sycl::accessor<T, Dim, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+};
+
 /// \brief OutputAccessor struct is used to generate an accessor when the node
 /// is not root. When the node is root no local accessor will be created.
 /// Therefore we eliminate the extra local memory for root node.
 template <size_t IsRoot, size_t LeafType, size_t LC, size_t LR,
           typename OutType>
 struct OutputAccessor {
-  static auto getTuple(cl::sycl::handler &cgh)
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh)
       -> decltype(tools::tuple::make_tuple()) {
     return tools::tuple::make_tuple();
   }
@@ -40,13 +57,15 @@ struct OutputAccessor {
 /// Here we create on output memory for the node.
 template <size_t LeafType, size_t LC, size_t LR, typename OutType>
 struct OutputAccessor<false, LeafType, LC, LR, OutType> {
-  using Accessor = cl::sycl::accessor<OutType, MemDimension<LeafType>::Dim,
-                                      cl::sycl::access::mode::read_write,
-                                      cl::sycl::access::target::local>;
-  static tools::tuple::Tuple<Accessor> getTuple(cl::sycl::handler &cgh) {
+  template <typename HandlerT>
+  using Accessor = typename LocalAccessor<HandlerT, OutType,
+                                          MemDimension<LeafType>::Dim>::Type;
+  template <typename HandlerT>
+  static tools::tuple::Tuple<Accessor<HandlerT>> getTuple(HandlerT &cgh) {
     /// In get range the column is changed with row in order to set x as
     /// column and y as row
-    return Accessor(get_range<MemDimension<LeafType>::Dim>(LR, LC), cgh);
+    return Accessor<HandlerT>(get_range<MemDimension<LeafType>::Dim>(LR, LC),
+                              cgh);
   }
 };
 
@@ -68,9 +87,10 @@ struct LocalOutput {
   static constexpr size_t Out_LR = LR;
   /// \brief getTuple function is used to create and wrap local memory into a
   /// tuple
-  /// \param cgh : sycl command group handler. 
+  /// \param cgh : the handler used to create the local memory.
+  template <typename HandlerT>
   static inline decltype(tools::tuple::make_tuple()) getTuple(
-      cl::sycl::handler &cgh) {
+      HandlerT &cgh) {
     return tools::tuple::make_tuple();
   }
 };
@@ -88,7 +108,8 @@ struct LocalOutput<
              LVL>> {
   static constexpr size_t Out_LC = LC;
   static constexpr size_t Out_LR = LR;
-  static decltype(tools::tuple::make_tuple()) getTuple(cl::sycl::handler &cgh) {
+  template <typename HandlerT>
+  static decltype(tools::tuple::make_tuple()) getTuple(HandlerT &cgh) {
     return tools::tuple::make_tuple();
   }
 };
@@ -107,7 +128,8 @@ struct LocalOutput<
              LVL>> {
   static constexpr size_t Out_LC = LC;
   static constexpr size_t Out_LR = LR;
-  static decltype(tools::tuple::make_tuple()) getTuple(cl::sycl::handler &cgh) {
+  template <typename HandlerT>
+  static decltype(tools::tuple::make_tuple()) getTuple(HandlerT &cgh) {
     return tools::tuple::make_tuple();
   }
 };
@@ -119,11 +141,12 @@ template <size_t IsRoot, size_t LC, size_t LR, size_t LVL, typename RHS>
 struct LocalOutput<false, IsRoot, LC, LR, LeafNode<RHS, LVL>> {
   static constexpr size_t Out_LC = LC;
   static constexpr size_t Out_LR = LR;
-  using Accessor = cl::sycl::accessor<typename RHS::ElementType, RHS::Dim,
-                                      cl::sycl::access::mode::read_write,
-                                      cl::sycl::access::target::local>;
-  static tools::tuple::Tuple<Accessor> getTuple(cl::sycl::handler &cgh) {
-    return Accessor(get_range<RHS::Dim>(LR, LC), cgh);
+  template <typename HandlerT>
+  using Accessor = typename LocalAccessor<HandlerT, typename RHS::ElementType,
+                                          RHS::Dim>::Type;
+  template <typename HandlerT>
+  static tools::tuple::Tuple<Accessor<HandlerT>> getTuple(HandlerT &cgh) {
+    return Accessor<HandlerT>(get_range<RHS::Dim>(LR, LC), cgh);
   }
 };
 
@@ -138,7 +161,8 @@ struct LocalOutput<false, IsRoot, LC, LR,
       LocalOutput<false, false, LC, LR, RHSExpr>::Out_LC;
   static constexpr size_t Out_LR =
       LocalOutput<false, false, LC, LR, RHSExpr>::Out_LR;
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh) -> decltype(tools::tuple::append(
       LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh),
       OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
                      typename OP::OutType>::getTuple(cgh))) {
@@ -171,7 +195,8 @@ struct LocalOutput<false, IsRoot, LC, LR,
   static constexpr size_t Out_LR =
       LocalOutput<false, false, LC, LR, Type>::Out_LR;
 
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh) -> decltype(tools::tuple::append(
       tools::tuple::append(
           LocalOutput<false, false, LC, LR, LHSExpr>::getTuple(cgh),
           LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh)),
@@ -185,6 +210,67 @@ struct LocalOutput<false, IsRoot, LC, LR,
                                 OutTuple);
   }
 };
+/// \brief LocalOutput specialisation for the look up table operation(Lookup).
+/// It creates the local accessor to store the output of the operation which is
+/// going to be used as an output for its parent. The table is read from global
+/// memory.
+template <size_t IsRoot, size_t LC, size_t LR, typename OP, typename LHSExpr,
+          typename RHSExpr, size_t Cols, size_t Rows, size_t LeafType,
+          size_t LVL>
+struct LocalOutput<false, IsRoot, LC, LR,
+                   Lookup<OP, LHSExpr, RHSExpr, Cols, Rows, LeafType, LVL>> {
+  static constexpr size_t Out_LC =
+      LocalOutput<false, false, LC, LR, LHSExpr>::Out_LC;
+  static constexpr size_t Out_LR =
+      LocalOutput<false, false, LC, LR, LHSExpr>::Out_LR;
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh) -> decltype(tools::tuple::append(
+      LocalOutput<false, false, LC, LR, LHSExpr>::getTuple(cgh),
+      OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                     typename OP::OutType>::getTuple(cgh))) {
+    auto OutTuple = OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                                   typename OP::OutType>::getTuple(cgh);
+    auto LHSTuple = LocalOutput<false, false, LC, LR, LHSExpr>::getTuple(cgh);
+    return tools::tuple::append(LHSTuple, OutTuple);
+  }
+};
+/// \brief LocalOutput specialisation for the resize operation(Resize). It
+/// creates the local accessor to store the output of the operation which is
+/// going to be used as an output for its parent. The input is read from global
+/// memory.
+template <size_t IsRoot, size_t LC, size_t LR, typename OP, typename RHSExpr,
+          size_t Cols, size_t Rows, size_t LeafType, size_t LVL>
+struct LocalOutput<false, IsRoot, LC, LR,
+                   Resize<OP, RHSExpr, Cols, Rows, LeafType, LVL>> {
+  static constexpr size_t Out_LC = LC;
+  static constexpr size_t Out_LR = LR;
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh)
+      -> decltype(OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                                 typename OP::OutType>::getTuple(cgh)) {
+    return OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                          typename OP::OutType>::getTuple(cgh);
+  }
+};
+/// \brief LocalOutput specialisation for the warp operation(Warp). It creates
+/// the local accessor to store the output of the operation which is going to
+/// be used as an output for its parent. The input is read from global memory
+/// and the transform from constant memory.
+template <size_t IsRoot, size_t LC, size_t LR, typename OP, typename LHSExpr,
+          typename RHSExpr, size_t Cols, size_t Rows, size_t LeafType,
+          size_t LVL>
+struct LocalOutput<false, IsRoot, LC, LR,
+                   Warp<OP, LHSExpr, RHSExpr, Cols, Rows, LeafType, LVL>> {
+  static constexpr size_t Out_LC = LC;
+  static constexpr size_t Out_LR = LR;
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh)
+      -> decltype(OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                                 typename OP::OutType>::getTuple(cgh)) {
+    return OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                          typename OP::OutType>::getTuple(cgh);
+  }
+};
 /// \brief LocalOutput specialisation for binary neighbour operation(StnFilt).
 /// It creates the local accessor to store the output of neighbour operation
 /// which is going to be used as an output for its parent.
@@ -204,7 +290,8 @@ struct LocalOutput<false, IsRoot, LC, LR,
       LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW, LHSExpr>::Out_LR -
       Halo_ROW;
 
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh) -> decltype(tools::tuple::append(
       tools::tuple::append(
           LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW,
                       LHSExpr>::getTuple(cgh),
@@ -241,7 +328,8 @@ struct LocalOutput<false, IsRoot, LC, LR,
       LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW, RHSExpr>::Out_LR -
       Halo_ROW;
 
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh) -> decltype(tools::tuple::append(
       LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW,
                   RHSExpr>::getTuple(cgh),
       OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
@@ -271,7 +359,8 @@ struct LocalOutput<false, IsRoot, LC, LR,
       LocalOutput<false, false, LC, LR, RHSExpr>::Out_LC / LC_Ratio;
   static constexpr size_t Out_LR =
       LocalOutput<false, false, LC, LR, RHSExpr>::Out_LR / LR_Ratio;
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh) -> decltype(tools::tuple::append(
       LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh),
       OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
                      typename OP::OutType>::getTuple(cgh))) {
@@ -293,7 +382,12 @@ struct LocalOutput<
     false, IsRoot, LC, LR,
     ParallelCopy<LHSExpr, RHSExpr, Cols, Rows, OffsetColIn, OffsetRowIn,
                  OffsetColOut, OffsetRowOut, LeafType, LVL>> {
-  static auto getTuple(cl::sycl::handler &cgh)
+  static constexpr size_t Out_LC =
+      LocalOutput<false, false, LC, LR, RHSExpr>::Out_LC;
+  static constexpr size_t Out_LR =
+      LocalOutput<false, false, LC, LR, RHSExpr>::Out_LR;
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh)
       -> decltype(LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh)) {
     return LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh);
   }
@@ -307,20 +401,93 @@ template <size_t IsRoot, size_t LC, size_t LR, typename LHSExpr,
           size_t LVL>
 struct LocalOutput<false, IsRoot, LC, LR,
                    Assign<LHSExpr, RHSExpr, Cols, Rows, LeafType, LVL>> {
-  static auto getTuple(cl::sycl::handler &cgh)
+  static constexpr size_t Out_LC =
+      LocalOutput<false, IsRoot, LC, LR, RHSExpr>::Out_LC;
+  static constexpr size_t Out_LR =
+      LocalOutput<false, IsRoot, LC, LR, RHSExpr>::Out_LR;
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh)
       -> decltype(LocalOutput<false, IsRoot, LC, LR, RHSExpr>::getTuple(cgh)) {
     return LocalOutput<false, IsRoot, LC, LR, RHSExpr>::getTuple(cgh);
   }
 };
 
+/// \brief LocalOutput specialisation for the Assign of a Scan of the rows. A
+/// Scan is a global operation, so it is always the root of its kernel and it
+/// is the only node using local memory. The local memory holds the chunk of
+/// the rows loaded by the workgroup and the sums carried over to the next
+/// chunk.
+template <size_t IsRoot, size_t LC, size_t LR, typename LHSExpr, typename InTp,
+          typename RHSExpr, size_t ScanCols, size_t ScanRows,
+          size_t ScanLeafType, size_t ScanLVL, size_t Cols, size_t Rows,
+          size_t LeafType, size_t LVL>
+struct LocalOutput<
+    true, IsRoot, LC, LR,
+    Assign<LHSExpr, Scan<ScanOp<mem_dim::ColDim, InTp>, RHSExpr, ScanCols,
+                         ScanRows, ScanLeafType, ScanLVL>,
+           Cols, Rows, LeafType, LVL>> {
+  using OP = ScanOp<mem_dim::ColDim, InTp>;
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh)
+      -> decltype(OutputAccessor<false, ScanLeafType, OP::Chunk + 1, LR,
+                                 typename OP::OutType>::getTuple(cgh)) {
+    return OutputAccessor<false, ScanLeafType, OP::Chunk + 1, LR,
+                          typename OP::OutType>::getTuple(cgh);
+  }
+};
+
+/// \brief LocalOutput specialisation for the Assign of the second kernel of a
+/// Reduce. The local memory holds the value of each thread of the workgroup
+/// for the tree reduction.
+template <size_t IsRoot, size_t LC, size_t LR, typename LHSExpr,
+          typename ReduceOP, typename RHSExpr, size_t ReduceCols,
+          size_t ReduceRows, size_t ReduceLeafType, size_t ReduceLVL,
+          size_t Cols, size_t Rows, size_t LeafType, size_t LVL>
+struct LocalOutput<
+    true, IsRoot, LC, LR,
+    Assign<LHSExpr, Reduce<ReduceOP, reduce_stage::Final, RHSExpr, ReduceCols,
+                           ReduceRows, ReduceLeafType, ReduceLVL>,
+           Cols, Rows, LeafType, LVL>> {
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh)
+      -> decltype(OutputAccessor<false, ReduceLeafType, LC, LR,
+                                 typename ReduceOP::AccType>::getTuple(cgh)) {
+    return OutputAccessor<false, ReduceLeafType, LC, LR,
+                          typename ReduceOP::AccType>::getTuple(cgh);
+  }
+};
+
+/// \brief LocalOutput specialisation for the Assign of the first kernel of a
+/// Histogram. The local memory holds the bins of the LR tiles of the
+/// workgroup.
+template <size_t IsRoot, size_t LC, size_t LR, typename LHSExpr,
+          typename HistOP, typename RHSExpr, size_t HistCols, size_t HistRows,
+          size_t HistLeafType, size_t HistLVL, size_t Cols, size_t Rows,
+          size_t LeafType, size_t LVL>
+struct LocalOutput<
+    true, IsRoot, LC, LR,
+    Assign<LHSExpr,
+           Histogram<HistOP, reduce_stage::Partial, RHSExpr, HistCols,
+                     HistRows, HistLeafType, HistLVL>,
+           Cols, Rows, LeafType, LVL>> {
+  template <typename HandlerT>
+  static auto getTuple(HandlerT &cgh)
+      -> decltype(OutputAccessor<false, HistLeafType, HistOP::Bins, LR,
+                                 typename HistOP::OutType>::getTuple(cgh)) {
+    return OutputAccessor<false, HistLeafType, HistOP::Bins, LR,
+                          typename HistOP::OutType>::getTuple(cgh);
+  }
+};
+
 /// \brief create_local_accessors is a deduction function for creating local
 /// accessor.
 /// parameters:
-/// \param cgh: sycl command group handler
+/// \param cgh: the handler used to create the local memory. It is the sycl
+/// command group handler for the sycl backend.
 /// \return Tuple
 
-template <size_t LC, size_t LR, typename Expr>
-inline auto create_local_accessors(cl::sycl::handler &cgh)
+template <size_t LC, size_t LR, typename Expr, typename HandlerT>
+inline auto create_local_accessors(HandlerT &cgh)
     -> decltype(LocalOutput<Expr::Operation_type != ops_category::NeighbourOP,
                             true, LC, LR, Expr>::getTuple(cgh)) {
   return LocalOutput<Expr::Operation_type != ops_category::NeighbourOP, true,
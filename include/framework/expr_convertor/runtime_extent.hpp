@@ -0,0 +1,318 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file runtime_extent.hpp
+/// \brief RuntimeExtent is used to find the runtime column and row size of an
+/// expression. The static size of a node is used when it is known at compile
+/// time, otherwise the size is taken from the child whose extent is dynamic.
+/// It also finds the number of images processed by a batched expression, and
+/// checks that the operands of a node read at the same coordinate have the
+/// same runtime extent.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_RUNTIME_EXTENT_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_RUNTIME_EXTENT_HPP_
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace visioncpp {
+namespace internal {
+/// \brief specialisation of RuntimeExtent when the node is a LeafNode. The
+/// extent is the one the memory has been created with.
+/// template parameters:
+/// \param RHS is the visionMemory
+/// \param LVL shows the level of the node in the expression tree
+template <typename RHS, size_t LVL>
+struct RuntimeExtent<expr_category::Unary, LeafNode<RHS, LVL>> {
+  static inline size_t cols(const LeafNode<RHS, LVL> &expr) {
+    return expr.vilibMemory.get_cols();
+  }
+  static inline size_t rows(const LeafNode<RHS, LVL> &expr) {
+    return expr.vilibMemory.get_rows();
+  }
+  static inline size_t batch(const LeafNode<RHS, LVL> &expr) {
+    return expr.vilibMemory.get_batch();
+  }
+};
+
+/// \brief specialisation of RuntimeExtent when the node has one child
+/// template parameters:
+/// \param Expr is the node type
+template <typename Expr>
+struct RuntimeExtent<expr_category::Unary, Expr> {
+  using Nested = RuntimeExtent<Expr::RHSExpr::ND_Category,
+                               typename Expr::RHSExpr>;
+  static inline size_t cols(const Expr &expr) {
+    return (Expr::Type::Cols != dynamic) ? Expr::Type::Cols
+                                         : Nested::cols(expr.rhs);
+  }
+  static inline size_t rows(const Expr &expr) {
+    return (Expr::Type::Rows != dynamic) ? Expr::Type::Rows
+                                         : Nested::rows(expr.rhs);
+  }
+  static inline size_t batch(const Expr &expr) {
+    return Nested::batch(expr.rhs);
+  }
+};
+
+/// \brief specialisation of RuntimeExtent when the node has two children. The
+/// dynamic extent is taken from the left-hand side expression when it is
+/// dynamic, otherwise from the right-hand side expression. The batch is the
+/// largest one of the children, as a single image is shared by all the images
+/// of a batch.
+/// template parameters:
+/// \param Expr is the node type
+template <typename Expr>
+struct RuntimeExtent<expr_category::Binary, Expr> {
+  using LHSExtent = RuntimeExtent<Expr::LHSExpr::ND_Category,
+                                  typename Expr::LHSExpr>;
+  using RHSExtent = RuntimeExtent<Expr::RHSExpr::ND_Category,
+                                  typename Expr::RHSExpr>;
+  static inline size_t cols(const Expr &expr) {
+    return (Expr::Type::Cols != dynamic)
+               ? Expr::Type::Cols
+               : ((Expr::LHSExpr::Type::Cols == dynamic)
+                      ? LHSExtent::cols(expr.lhs)
+                      : RHSExtent::cols(expr.rhs));
+  }
+  static inline size_t rows(const Expr &expr) {
+    return (Expr::Type::Rows != dynamic)
+               ? Expr::Type::Rows
+               : ((Expr::LHSExpr::Type::Rows == dynamic)
+                      ? LHSExtent::rows(expr.lhs)
+                      : RHSExtent::rows(expr.rhs));
+  }
+  static inline size_t batch(const Expr &expr) {
+    return std::max(LHSExtent::batch(expr.lhs), RHSExtent::batch(expr.rhs));
+  }
+};
+
+/// function runtime_cols
+/// \brief template deduction for RuntimeExtent returning the column size of
+/// the expression.
+/// \param expr : the expression
+/// \return size_t
+template <typename Expr>
+inline size_t runtime_cols(const Expr &expr) {
+  return RuntimeExtent<Expr::ND_Category, Expr>::cols(expr);
+}
+
+/// function runtime_rows
+/// \brief template deduction for RuntimeExtent returning the row size of the
+/// expression.
+/// \param expr : the expression
+/// \return size_t
+template <typename Expr>
+inline size_t runtime_rows(const Expr &expr) {
+  return RuntimeExtent<Expr::ND_Category, Expr>::rows(expr);
+}
+
+/// function runtime_batch
+/// \brief template deduction for RuntimeExtent returning the number of images
+/// processed by the expression.
+/// \param expr : the expression
+/// \return size_t
+template <typename Expr>
+inline size_t runtime_batch(const Expr &expr) {
+  return RuntimeExtent<Expr::ND_Category, Expr>::batch(expr);
+}
+
+/// \struct MatchedExtent
+/// \brief MatchedExtent is true for the nodes whose two operands are read at
+/// the same coordinate, so their runtime extents must be the same.
+/// template parameters:
+/// \tparam Expr : the node type
+template <typename Expr>
+struct MatchedExtent {
+  static constexpr bool Value = false;
+};
+/// \brief specialisation of the MatchedExtent for RBiOP
+template <typename OP, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct MatchedExtent<RBiOP<OP, LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr bool Value = true;
+};
+/// \brief specialisation of the MatchedExtent for Assign
+template <typename LHS, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct MatchedExtent<Assign<LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr bool Value = true;
+};
+
+/// \struct BroadcastExtent
+/// \brief BroadcastExtent is true when the operand is read at every pixel of
+/// the other operand: a constant variable or a 1x1 image.
+/// template parameters:
+/// \tparam Expr : the operand type
+template <typename Expr>
+struct BroadcastExtent {
+  static constexpr bool Value =
+      Expr::Type::LeafType == memory_type::Const ||
+      (Expr::Type::Cols == 1 && Expr::Type::Rows == 1);
+};
+
+/// function check_matched_extent
+/// \brief throws std::invalid_argument when the extents of the two operands
+/// of a node differ in one dimension
+/// \param lhs : the extent of the left-hand side operand
+/// \param rhs : the extent of the right-hand side operand
+/// \param dimension : the name of the dimension
+/// \return void
+inline void check_matched_extent(size_t lhs, size_t rhs,
+                                 const char *dimension) {
+  if (lhs != rhs) {
+    throw std::invalid_argument(
+        std::string("visioncpp: the operands of a node have different ") +
+        dimension + " sizes " + std::to_string(lhs) + " and " +
+        std::to_string(rhs));
+  }
+}
+
+/// \struct ExtentCheck
+/// \brief ExtentCheck visits the expression and checks that the operands of
+/// each RBiOP and Assign have the same runtime extent when one of them is
+/// dynamic. The nodes with compile time sizes are checked by their types.
+/// template parameters:
+/// \tparam Category : the category of the node
+/// \tparam Expr : the node type
+template <size_t Category, typename Expr>
+struct ExtentCheck {
+  static inline void check(const Expr &) {}
+};
+/// \brief specialisation of the ExtentCheck for the LeafNode
+template <typename RHS, size_t LVL>
+struct ExtentCheck<expr_category::Unary, LeafNode<RHS, LVL>> {
+  static inline void check(const LeafNode<RHS, LVL> &) {}
+};
+/// \brief specialisation of the ExtentCheck when the node has one child
+template <typename Expr>
+struct ExtentCheck<expr_category::Unary, Expr> {
+  static inline void check(const Expr &expr) {
+    ExtentCheck<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr>::check(
+        expr.rhs);
+  }
+};
+/// \brief specialisation of the ExtentCheck when the node has two children
+template <typename Expr>
+struct ExtentCheck<expr_category::Binary, Expr> {
+  using LHS = typename Expr::LHSExpr;
+  using RHS = typename Expr::RHSExpr;
+  static constexpr bool Checked = MatchedExtent<Expr>::Value &&
+                                  !BroadcastExtent<LHS>::Value &&
+                                  !BroadcastExtent<RHS>::Value;
+  static inline void check(const Expr &expr) {
+    ExtentCheck<LHS::ND_Category, LHS>::check(expr.lhs);
+    ExtentCheck<RHS::ND_Category, RHS>::check(expr.rhs);
+    if (Checked &&
+        (LHS::Type::Cols == dynamic || RHS::Type::Cols == dynamic)) {
+      check_matched_extent(runtime_cols(expr.lhs), runtime_cols(expr.rhs),
+                           "column");
+    }
+    if (Checked &&
+        (LHS::Type::Rows == dynamic || RHS::Type::Rows == dynamic)) {
+      check_matched_extent(runtime_rows(expr.lhs), runtime_rows(expr.rhs),
+                           "row");
+    }
+  }
+};
+
+/// function check_runtime_extent
+/// \brief template deduction for ExtentCheck. It is called before launching
+/// the kernel of an expression.
+/// \param expr : the expression
+/// \return void
+template <typename Expr>
+inline void check_runtime_extent(const Expr &expr) {
+  ExtentCheck<Expr::ND_Category, Expr>::check(expr);
+}
+
+/// \struct BatchCheck
+/// \brief BatchCheck visits the expression executed by execute_batch and
+/// checks that each terminal node holds either a single image, which is
+/// shared by all the images of the batch, or as many images as the batch.
+/// A terminal holding fewer images would be read past its end.
+/// template parameters:
+/// \tparam Category : the category of the node
+/// \tparam Expr : the node type
+template <size_t Category, typename Expr>
+struct BatchCheck {
+  static inline void check(const Expr &, size_t) {}
+};
+/// \brief specialisation of the BatchCheck for the LeafNode
+template <typename RHS, size_t LVL>
+struct BatchCheck<expr_category::Unary, LeafNode<RHS, LVL>> {
+  static inline void check(const LeafNode<RHS, LVL> &expr, size_t batch) {
+    const size_t images = expr.vilibMemory.get_batch();
+    if (images != 1 && images != batch) {
+      throw std::invalid_argument(
+          "visioncpp: a terminal of the batch holds " +
+          std::to_string(images) + " images while the batch has " +
+          std::to_string(batch) + " images");
+    }
+  }
+};
+/// \brief specialisation of the BatchCheck for the LeafNode of a scheduled
+/// subexpression, whose terminals are checked
+template <bool PlcType, typename Node, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename StorageT, size_t LVL>
+struct BatchCheck<
+    expr_category::Unary,
+    LeafNode<VirtualMemory<PlcType, Node, LC, LR, LCT, LRT, StorageT>, LVL>> {
+  static inline void check(
+      const LeafNode<VirtualMemory<PlcType, Node, LC, LR, LCT, LRT, StorageT>,
+                     LVL> &expr,
+      size_t batch) {
+    BatchCheck<Node::ND_Category, Node>::check(expr.vilibMemory.subTree,
+                                               batch);
+  }
+};
+/// \brief specialisation of the BatchCheck when the node has one child
+template <typename Expr>
+struct BatchCheck<expr_category::Unary, Expr> {
+  static inline void check(const Expr &expr, size_t batch) {
+    BatchCheck<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr>::check(
+        expr.rhs, batch);
+  }
+};
+/// \brief specialisation of the BatchCheck when the node has two children
+template <typename Expr>
+struct BatchCheck<expr_category::Binary, Expr> {
+  static inline void check(const Expr &expr, size_t batch) {
+    BatchCheck<Expr::LHSExpr::ND_Category, typename Expr::LHSExpr>::check(
+        expr.lhs, batch);
+    BatchCheck<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr>::check(
+        expr.rhs, batch);
+  }
+};
+
+/// function check_runtime_batch
+/// \brief template deduction for BatchCheck. It is called by execute_batch
+/// and throws std::invalid_argument unless every terminal node, the output
+/// included, holds one image or as many images as the batch.
+/// \param expr : the expression
+/// \param batch : the number of images of the batch
+/// \return void
+template <typename Expr>
+inline void check_runtime_batch(const Expr &expr, size_t batch) {
+  BatchCheck<Expr::ND_Category, Expr>::check(expr, batch);
+}
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_RUNTIME_EXTENT_HPP_
@@ -0,0 +1,67 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file box_sum.hpp
+/// \brief This file contains the deduction functions of the box sum. The sum
+/// of any box is computed from the integral image with four reads per pixel.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_BOX_SUM_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_BOX_SUM_HPP_
+
+namespace visioncpp {
+/// function box_sum
+/// \brief template deduction of the sum of the box from Left columns on the
+/// left to Right columns on the right and from Top rows above to Bottom rows
+/// below each pixel. The pixels of the box outside of the image count as zero.
+/// template parameters:
+/// \tparam Top: the number of rows of the box above the pixel
+/// \tparam Left: the number of columns of the box on the left of the pixel
+/// \tparam Bottom: the number of rows of the box below the pixel
+/// \tparam Right: the number of columns of the box on the right of the pixel
+/// \tparam RHS: the type of the integral image expression
+/// function parameters:
+/// \param integral : the integral image of the input, see integral_image
+/// \return StnNoFilt
+template <size_t Top, size_t Left, size_t Bottom, size_t Right, typename RHS>
+auto box_sum(RHS integral)
+    -> decltype(neighbour_operation<OP_BoxSum<Top, Left, Bottom, Right>,
+                                    Top + 1, Left + 1, Bottom, Right,
+                                    border::Integral>(integral)) {
+  return neighbour_operation<OP_BoxSum<Top, Left, Bottom, Right>, Top + 1,
+                             Left + 1, Bottom, Right, border::Integral>(
+      integral);
+}
+
+/// function box_sum
+/// \brief template deduction of the sum of the square box of
+/// 2 * Radius + 1 pixels centred on each pixel, e.g. box_sum<7> for a 15x15
+/// window.
+/// template parameters:
+/// \tparam Radius: the radius of the box
+/// \tparam RHS: the type of the integral image expression
+/// function parameters:
+/// \param integral : the integral image of the input, see integral_image
+/// \return StnNoFilt
+template <size_t Radius, typename RHS>
+auto box_sum(RHS integral)
+    -> decltype(box_sum<Radius, Radius, Radius, Radius>(integral)) {
+  return box_sum<Radius, Radius, Radius, Radius>(integral);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_BOX_SUM_HPP_
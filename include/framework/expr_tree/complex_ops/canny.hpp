@@ -0,0 +1,203 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file canny.hpp
+/// \brief This file contains the Hysteresis node and the deduction function
+/// of the Canny edge detector. The Gaussian blur is executed first, so the
+/// Sobel gradient reads the border of the blurred image as OpenCV does. The
+/// Sobel gradient, the non maximum suppression and the double threshold are
+/// fused in one kernel, and the hysteresis is iterated on the device until
+/// the edges stop growing.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_CANNY_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_CANNY_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct CannyGrowPasses
+/// \brief builds Passes nested hysteresis steps, which are fused in one
+/// kernel. The pixels outside of the image are none, so they never grow.
+/// template parameters:
+/// \tparam Passes: the number of steps
+template <size_t Passes>
+struct CannyGrowPasses {
+  template <typename RHS>
+  static auto build(RHS rhs)
+      -> decltype(visioncpp::neighbour_operation<OP_CannyGrow,
+                                                 border::Constant>(
+          CannyGrowPasses<Passes - 1>::build(rhs))) {
+    return visioncpp::neighbour_operation<OP_CannyGrow, border::Constant>(
+        CannyGrowPasses<Passes - 1>::build(rhs));
+  }
+};
+/// \brief specialisation of the CannyGrowPasses for the last step
+template <>
+struct CannyGrowPasses<1> {
+  template <typename RHS>
+  static auto build(RHS rhs)
+      -> decltype(visioncpp::neighbour_operation<OP_CannyGrow,
+                                                 border::Constant>(rhs)) {
+    return visioncpp::neighbour_operation<OP_CannyGrow, border::Constant>(
+        rhs);
+  }
+};
+
+/// \struct Hysteresis
+/// \brief Hysteresis grows the strong pixels of its input through the weak
+/// ones. The node launches its own kernels: the input is executed once, then
+/// each kernel applies Passes steps of OP_CannyGrow between two intermediate
+/// memories and a reduction writes whether any pixel changed in a 1x1
+/// memory. Only this flag is read back by the host, and the iteration stops
+/// when it is zero. The node is always executed before its parent.
+/// template parameters:
+/// \tparam ExecPolicy: the policy used to execute the kernels of the node
+/// \tparam Passes: the number of hysteresis steps fused in each kernel
+/// \tparam RHS: the classes of the pixels, e.g. of OP_CannySuppress
+/// \tparam Cols: determines the column size of the output
+/// \tparam Rows: determines the row size of the output
+/// \tparam LfType: determines the type of the leafNode {Buffer2D, Buffer1D,
+/// Host, Image}
+/// \tparam LVL: the level of the node in the expression tree
+template <bool ExecPolicy, size_t Passes, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Hysteresis {
+ public:
+  static_assert(Cols != dynamic && Rows != dynamic,
+                "The hysteresis node requires compile time Cols and Rows");
+  static_assert(Passes > 0, "The hysteresis needs at least one step");
+  using RHSExpr = RHS;
+  static constexpr bool has_out = false;
+  using OutType = typename RHS::OutType;
+  using Type = typename OutputMemory<OutType, LfType, Cols, Rows, LVL>::Type;
+  static constexpr size_t Level = LVL;
+  static constexpr size_t RThread = Rows;
+  static constexpr size_t CThread = Cols;
+  static constexpr size_t ND_Category = expr_category::Unary;
+  static constexpr size_t LeafType = Type::LeafType;
+  static constexpr bool SubExpressionEvaluationNeeded = true;
+  static constexpr size_t Operation_type = ops_category::GlobalNeighbourOP;
+
+  RHS rhs;
+  bool subexpr_execution_reseter;
+  Hysteresis(RHS rhsArg) : rhs(rhsArg), subexpr_execution_reseter(false) {}
+
+  void reset(bool reset) {
+    rhs.reset(reset);
+    subexpr_execution_reseter = reset;
+  }
+  /// sub_expression_evaluation
+  /// \brief This function executes the hysteresis and replaces the node by
+  /// the leaf node holding the result. Each kernel is executed in its own
+  /// scope, so the intermediate memories of a kernel are released before
+  /// the next one and none of its results is reused by a later step.
+  /// template parameters:
+  ///\tparam ForcedToExec : a boolean value representing the decision made by
+  /// the parent of this node for launching a kernel.
+  /// \tparam LC: is the column size of local memory
+  /// \tparam LR: is the row size of local memory
+  /// \tparam LCT: is the column size of workgroup
+  /// \tparam LRT: is the row size of workgroup
+  /// \tparam DeviceT: type representing the device
+  /// function parameters:
+  /// \param dev : the selected device for executing the expression
+  /// \return LeafNode
+  template <bool ForcedToExec, size_t LC, size_t LR, size_t LCT, size_t LRT,
+            typename DeviceT>
+  LeafNode<Type, LVL> inline sub_expression_evaluation(const DeviceT &dev) {
+    using Classes = LeafNode<Type, LVL>;
+    using Change = decltype(visioncpp::reduce_max(
+        visioncpp::point_operation<OP_CannyChanged>(
+            std::declval<Classes>(), std::declval<Classes>())));
+    auto src = make_intermediate<Classes>(dev, Cols, Rows);
+    auto dst = make_intermediate<Classes>(dev, Cols, Rows);
+    auto flag =
+        make_intermediate<LeafNode<typename Change::Type, LVL>>(dev, 1, 1);
+    auto classify = visioncpp::assign(src, rhs);
+    visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(classify, dev);
+    float changed = 1.0f;
+    while (changed != 0.0f) {
+      auto grow = visioncpp::assign(dst, CannyGrowPasses<Passes>::build(src));
+      visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(grow, dev);
+      auto check = visioncpp::assign(
+          flag, visioncpp::reduce_max(
+                    visioncpp::point_operation<OP_CannyChanged>(src, dst)));
+      visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(check, dev);
+      flag.read_output(&changed);
+      std::swap(src, dst);
+    }
+    release_intermediate(dev, dst);
+    release_intermediate(dev, flag);
+    return src;
+  }
+};
+}  // internal
+
+/// function canny
+/// \brief template deduction of the Canny edge detector of a single channel
+/// image. The image is blurred by a Gaussian of the given radius in its own
+/// kernel, the Sobel gradient is computed and the pixels which are not a
+/// maximum along the gradient are suppressed, the gradient outside of the
+/// image being 0. The pixels whose gradient magnitude is above
+/// High are edges, and so are the pixels above Low connected to an edge. The
+/// result is 255 on the edges and 0 elsewhere. The thresholds are relative
+/// to the magnitude of the Sobel gradient of the input, e.g. a float image
+/// in [0, 1] has magnitudes up to about 5.7. The hysteresis reads back one
+/// value per Passes steps to know when to stop.
+/// template parameters:
+/// \tparam ExecPolicy: the policy used to execute the kernels of the
+/// hysteresis, which should be the policy of the execute of the expression
+/// \tparam Low: the low threshold of the gradient magnitude as a std::ratio
+/// \tparam High: the high threshold of the gradient magnitude as a std::ratio
+/// \tparam Radius: the radius of the Gaussian blur
+/// \tparam Passes: the number of hysteresis steps fused in each kernel
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return RUnOP
+template <bool ExecPolicy, typename Low, typename High, size_t Radius = 1,
+          size_t Passes = 4, typename RHS,
+          typename NMS = decltype(neighbour_operation<OP_CannySuppress<
+                                      Low, High>>(
+              neighbour_operation<OP_SobelGradient>(schedule<ExecPolicy>(
+                  gaussian_blur<Radius>(std::declval<RHS>())))))>
+auto canny(RHS rhs) -> decltype(point_operation<OP_CannyEdge>(
+    internal::Hysteresis<ExecPolicy, Passes, NMS, RHS::Type::Cols,
+                         RHS::Type::Rows, RHS::Type::LeafType,
+                         1 + NMS::Level>(std::declval<NMS>()))) {
+  using Edges =
+      internal::Hysteresis<ExecPolicy, Passes, NMS, RHS::Type::Cols,
+                           RHS::Type::Rows, RHS::Type::LeafType,
+                           1 + NMS::Level>;
+  return point_operation<OP_CannyEdge>(
+      Edges(neighbour_operation<OP_CannySuppress<Low, High>>(
+          neighbour_operation<OP_SobelGradient>(
+              schedule<ExecPolicy>(gaussian_blur<Radius>(rhs))))));
+}
+
+/// function canny
+/// \brief template deduction of the Canny edge detector whose hysteresis is
+/// executed with policy::Fuse
+template <typename Low, typename High, size_t Radius = 1, size_t Passes = 4,
+          typename RHS>
+auto canny(RHS rhs)
+    -> decltype(canny<policy::Fuse, Low, High, Radius, Passes>(rhs)) {
+  return canny<policy::Fuse, Low, High, Radius, Passes>(rhs);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_CANNY_HPP_
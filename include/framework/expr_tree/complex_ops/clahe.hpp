@@ -0,0 +1,66 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file clahe.hpp
+/// \brief This file contains the deduction function of the contrast limited
+/// adaptive histogram equalisation (CLAHE). The histograms of the tiles, their
+/// look up tables and the equalised image are computed on the device without
+/// going back to the host.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_CLAHE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_CLAHE_HPP_
+
+namespace visioncpp {
+/// function clahe
+/// \brief template deduction of the CLAHE of a single channel image of float
+/// pixels in [0, 1] or of unsigned char pixels. The image is divided in
+/// TilesC x TilesR tiles, so its size must be a multiple of the tile grid.
+/// The input is read by the histograms and by the look up, so it should be a
+/// terminal node or a scheduled expression.
+/// template parameters:
+/// \tparam TilesC: the number of tiles in the column dimension
+/// \tparam TilesR: the number of tiles in the row dimension
+/// \tparam ClipLimit: the clip limit of the histograms as a std::ratio,
+/// relative to the height of a flat histogram. The default is the one of
+/// OpenCV
+/// \tparam Bins: the number of bins of the histograms
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return Lookup
+template <size_t TilesC = 8, size_t TilesR = 8,
+          typename ClipLimit = std::ratio<40>, size_t Bins = 256,
+          typename RHS>
+auto clahe(RHS rhs) -> decltype(lookup_operation<
+    OP_Clahe<Bins, TilesC, TilesR, RHS::Type::Cols / TilesC,
+             RHS::Type::Rows / TilesR>>(
+    rhs, global_operation<
+             OP_ClaheLut<(RHS::Type::Cols / TilesC) * (RHS::Type::Rows / TilesR),
+                         ClipLimit>,
+             Bins, TilesC * TilesR, memory_type::Buffer2D>(
+             histogram<Bins, TilesC, TilesR>(rhs)))) {
+  constexpr size_t TileCols = RHS::Type::Cols / TilesC;
+  constexpr size_t TileRows = RHS::Type::Rows / TilesR;
+  return lookup_operation<OP_Clahe<Bins, TilesC, TilesR, TileCols, TileRows>>(
+      rhs, global_operation<OP_ClaheLut<TileCols * TileRows, ClipLimit>, Bins,
+                            TilesC * TilesR, memory_type::Buffer2D>(
+               histogram<Bins, TilesC, TilesR>(rhs)));
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_CLAHE_HPP_
@@ -132,6 +132,12 @@ struct PyramidLeafNode {
 };
 }  // end internal
 }  // end visioncpp
+#include "box_sum.hpp"
+#include "canny.hpp"
+#include "clahe.hpp"
+#include "equalize_hist.hpp"
+#include "gaussian_blur.hpp"
+#include "morphology.hpp"
 #include "pyramid_mem.hpp"
 #include "pyramid_with_auto_mem_gen.hpp"
 #include "pyramid_with_auto_mem_sep.hpp"
@@ -0,0 +1,54 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file equalize_hist.hpp
+/// \brief This file contains the deduction function of the histogram
+/// equalisation. The histogram, the look up table and the equalised image are
+/// computed on the device without going back to the host.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_EQUALIZE_HIST_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_EQUALIZE_HIST_HPP_
+
+namespace visioncpp {
+/// function equalize_hist
+/// \brief template deduction of the histogram equalisation of a single
+/// channel image of float pixels in [0, 1] or of unsigned char pixels. It
+/// runs the two kernels of the histogram, one kernel for the look up table and
+/// the look up which is fused with the parent of the expression. The input is
+/// read by the histogram and by the look up, so it should be a terminal node
+/// or a scheduled expression.
+/// template parameters:
+/// \tparam Bins: the number of bins of the histogram
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return Lookup
+template <size_t Bins = 256, typename RHS>
+auto equalize_hist(RHS rhs)
+    -> decltype(lookup_operation<OP_EqualizeHist<Bins>>(
+        rhs, global_operation<
+                 OP_EqualizeLut<RHS::Type::Cols * RHS::Type::Rows>, Bins, 1,
+                 memory_type::Buffer2D>(histogram<Bins>(rhs)))) {
+  return lookup_operation<OP_EqualizeHist<Bins>>(
+      rhs,
+      global_operation<OP_EqualizeLut<RHS::Type::Cols * RHS::Type::Rows>, Bins,
+                       1, memory_type::Buffer2D>(histogram<Bins>(rhs)));
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_EQUALIZE_HIST_HPP_
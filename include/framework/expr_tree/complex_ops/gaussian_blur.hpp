@@ -0,0 +1,98 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file gaussian_blur.hpp
+/// \brief This file contains the deduction functions of the separable
+/// Gaussian blur of any radius. The blur is built as a horizontal pass
+/// followed by a vertical pass whose halos are deduced from the radius, so
+/// when the expression is fused the result of the horizontal pass is kept in
+/// local memory and never written to global memory.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_GAUSSIAN_BLUR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_GAUSSIAN_BLUR_HPP_
+
+namespace visioncpp {
+/// function gaussian_blur
+/// \brief template deduction of the Gaussian blur whose taps are generated at
+/// compile time.
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+/// \tparam Sigma: the sigma of the Gaussian as a std::ratio, e.g.
+/// std::ratio<3, 2> for 1.5. By default it is the sigma used by OpenCV for the
+/// same window
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return StnNoFilt
+template <size_t Radius, typename Sigma = DefaultGaussianSigma<Radius>,
+          typename Border = border::Replicate, typename RHS>
+auto gaussian_blur(RHS rhs)
+    -> decltype(neighbour_operation<OP_GaussianBlurCol<Radius, Sigma>, Radius,
+                                    0, Radius, 0, Border>(
+        neighbour_operation<OP_GaussianBlurRow<Radius, Sigma>, 0, Radius, 0,
+                            Radius, Border>(rhs))) {
+  return neighbour_operation<OP_GaussianBlurCol<Radius, Sigma>, Radius, 0,
+                             Radius, 0, Border>(
+      neighbour_operation<OP_GaussianBlurRow<Radius, Sigma>, 0, Radius, 0,
+                          Radius, Border>(rhs));
+}
+
+/// function gaussian_blur
+/// \brief template deduction of the Gaussian blur whose sigma is only known at
+/// run time. The taps are computed on the host by gaussian_taps and given as a
+/// constant terminal of Radius + 1 columns and 1 row, e.g.
+/// \code
+/// float taps[Radius + 1];
+/// gaussian_taps<Radius>(sigma, taps);
+/// auto flt = terminal<float, Radius + 1, 1, memory_type::Buffer2D,
+///                     scope::Constant>(taps);
+/// auto blur = gaussian_blur<Radius>(in, flt);
+/// \endcode
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+/// \tparam LHS: the type of the input expression
+/// \tparam RHS: the type of the taps terminal
+/// function parameters:
+/// \param lhs : the input expression
+/// \param taps : the taps terminal
+/// \return StnFilt
+template <size_t Radius, typename Border = border::Replicate, typename LHS,
+          typename RHS>
+auto gaussian_blur(LHS lhs, RHS taps)
+    -> decltype(neighbour_operation<
+                OP_GaussianBlurColTaps<Radius>, Radius, 0, Radius, 0,
+                LHS::Type::Cols, LHS::Type::Rows, LHS::Type::LeafType, Border>(
+        neighbour_operation<OP_GaussianBlurRowTaps<Radius>, 0, Radius, 0,
+                            Radius, LHS::Type::Cols, LHS::Type::Rows,
+                            LHS::Type::LeafType, Border>(lhs, taps),
+        taps)) {
+  return neighbour_operation<OP_GaussianBlurColTaps<Radius>, Radius, 0,
+                             Radius, 0, LHS::Type::Cols, LHS::Type::Rows,
+                             LHS::Type::LeafType, Border>(
+      neighbour_operation<OP_GaussianBlurRowTaps<Radius>, 0, Radius, 0, Radius,
+                          LHS::Type::Cols, LHS::Type::Rows,
+                          LHS::Type::LeafType, Border>(lhs, taps),
+      taps);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_GAUSSIAN_BLUR_HPP_
@@ -0,0 +1,244 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file morphology.hpp
+/// \brief This file contains the deduction functions of the morphological
+/// operations: erode, dilate, morph_open, morph_close, morph_gradient, top_hat
+/// and black_hat. A rectangle is eroded by a horizontal pass followed by a
+/// vertical pass, so a window of 2 * RadiusC + 1 by 2 * RadiusR + 1 pixels
+/// costs 2 * (RadiusC + RadiusR) compares per pixel rather than one per pixel
+/// of the window, and a cross by the min of its row and of its column. Each
+/// pass is a neighbour operation whose halo is the radius of its line, so when
+/// the expression is fused the passes of an erosion or a dilation stay in
+/// local memory and run in one kernel. The second operation of an opening or
+/// a closing reads the first one outside of the image, where the border
+/// policy must apply to the result of the first operation rather than to its
+/// input, so the first operation is scheduled in its own kernel.
+/// The van Herk/Gil-Werman running min/max is not used: it shares prefix and
+/// suffix minima between the pixels of a block, which the neighbour functors,
+/// computing each pixel on its own, cannot do.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_MORPHOLOGY_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_MORPHOLOGY_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct MorphPass
+/// \brief MorphPass builds the min or the max of the 2 * Radius + 1 pixels of
+/// a row or of a column centred on each pixel, in a single neighbour operation
+/// whose halo is the radius along the line.
+/// template parameters:
+/// \tparam MorphOP: internal::MorphErode or internal::MorphDilate
+/// \tparam Horizontal: true for a row, false for a column
+/// \tparam Radius: the radius of the line
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+template <typename MorphOP, bool Horizontal, size_t Radius, typename Border>
+struct MorphPass {
+  using OP = OP_MorphLine<MorphOP, Radius, Horizontal>;
+  static constexpr size_t Halo_C = Horizontal ? Radius : 0;
+  static constexpr size_t Halo_R = Horizontal ? 0 : Radius;
+  template <typename RHS>
+  static auto build(RHS rhs)
+      -> decltype(visioncpp::neighbour_operation<OP, Halo_R, Halo_C, Halo_R,
+                                                 Halo_C, Border>(rhs)) {
+    return visioncpp::neighbour_operation<OP, Halo_R, Halo_C, Halo_R, Halo_C,
+                                          Border>(rhs);
+  }
+};
+/// \brief specialisation of MorphPass for a line of one pixel, which leaves
+/// the input unchanged.
+template <typename MorphOP, bool Horizontal, typename Border>
+struct MorphPass<MorphOP, Horizontal, 0, Border> {
+  template <typename RHS>
+  static RHS build(RHS rhs) {
+    return rhs;
+  }
+};
+
+/// \struct MorphElement
+/// \brief MorphElement builds the erosion or the dilation by a structuring
+/// element.
+/// template parameters:
+/// \tparam MorphOP: internal::MorphErode or internal::MorphDilate
+/// \tparam Element: morph::Rect or morph::Cross
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+template <typename MorphOP, typename Element, typename Border>
+struct MorphElement;
+/// \brief specialisation of MorphElement for a rectangle: the vertical pass
+/// is applied to the result of the horizontal pass.
+template <typename MorphOP, size_t RadiusC, size_t RadiusR, typename Border>
+struct MorphElement<MorphOP, morph::Rect<RadiusC, RadiusR>, Border> {
+  using Row = MorphPass<MorphOP, true, RadiusC, Border>;
+  using Col = MorphPass<MorphOP, false, RadiusR, Border>;
+  template <typename RHS>
+  static auto build(RHS rhs) -> decltype(Col::build(Row::build(rhs))) {
+    return Col::build(Row::build(rhs));
+  }
+};
+/// \brief specialisation of MorphElement for a cross: the horizontal and the
+/// vertical passes are both applied to the input and combined.
+template <typename MorphOP, size_t RadiusC, size_t RadiusR, typename Border>
+struct MorphElement<MorphOP, morph::Cross<RadiusC, RadiusR>, Border> {
+  using Row = MorphPass<MorphOP, true, RadiusC, Border>;
+  using Col = MorphPass<MorphOP, false, RadiusR, Border>;
+  using OP = OP_MorphCombine<MorphOP>;
+  template <typename RHS>
+  static auto build(RHS rhs) -> decltype(
+      visioncpp::point_operation<OP>(Row::build(rhs), Col::build(rhs))) {
+    return visioncpp::point_operation<OP>(Row::build(rhs), Col::build(rhs));
+  }
+};
+}  // internal
+
+/// function erode
+/// \brief template deduction of the erosion: each pixel is the min of the
+/// pixels of the structuring element centred on it, channel by channel.
+/// template parameters:
+/// \tparam Element: the structuring element, morph::Rect or morph::Cross
+/// \tparam Border: the border policy used to read the input outside of the
+/// image. The default border::Replicate never adds a value which is not
+/// already in the element.
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return StnNoFilt
+template <typename Element, typename Border = border::Replicate, typename RHS>
+auto erode(RHS rhs) -> decltype(
+    internal::MorphElement<internal::MorphErode, Element, Border>::build(rhs)) {
+  return internal::MorphElement<internal::MorphErode, Element, Border>::build(
+      rhs);
+}
+
+/// function dilate
+/// \brief template deduction of the dilation: each pixel is the max of the
+/// pixels of the structuring element centred on it, channel by channel.
+/// template parameters:
+/// \tparam Element: the structuring element, morph::Rect or morph::Cross
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return StnNoFilt
+template <typename Element, typename Border = border::Replicate, typename RHS>
+auto dilate(RHS rhs) -> decltype(
+    internal::MorphElement<internal::MorphDilate, Element, Border>::build(
+        rhs)) {
+  return internal::MorphElement<internal::MorphDilate, Element, Border>::build(
+      rhs);
+}
+
+/// function morph_open
+/// \brief template deduction of the opening, the dilation of the erosion. It
+/// removes the bright spots smaller than the structuring element, e.g. the
+/// noise of a thresholded mask. The erosion is executed in its own kernel,
+/// with policy::Fuse, so that the dilation reads its border as OpenCV does.
+/// template parameters:
+/// \tparam Element: the structuring element, morph::Rect or morph::Cross
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return StnNoFilt
+template <typename Element, typename Border = border::Replicate, typename RHS>
+auto morph_open(RHS rhs) -> decltype(dilate<Element, Border>(
+    schedule<policy::Fuse>(erode<Element, Border>(rhs)))) {
+  return dilate<Element, Border>(
+      schedule<policy::Fuse>(erode<Element, Border>(rhs)));
+}
+
+/// function morph_close
+/// \brief template deduction of the closing, the erosion of the dilation. It
+/// fills the dark holes smaller than the structuring element. The dilation is
+/// executed in its own kernel, as the erosion of morph_open.
+/// template parameters:
+/// \tparam Element: the structuring element, morph::Rect or morph::Cross
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return StnNoFilt
+template <typename Element, typename Border = border::Replicate, typename RHS>
+auto morph_close(RHS rhs) -> decltype(erode<Element, Border>(
+    schedule<policy::Fuse>(dilate<Element, Border>(rhs)))) {
+  return erode<Element, Border>(
+      schedule<policy::Fuse>(dilate<Element, Border>(rhs)));
+}
+
+/// function morph_gradient
+/// \brief template deduction of the morphological gradient, the dilation
+/// minus the erosion, which outlines the objects.
+/// template parameters:
+/// \tparam Element: the structuring element, morph::Rect or morph::Cross
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return PixelBinaryOp
+template <typename Element, typename Border = border::Replicate, typename RHS>
+auto morph_gradient(RHS rhs)
+    -> decltype(point_operation<OP_MorphDiff>(dilate<Element, Border>(rhs),
+                                              erode<Element, Border>(rhs))) {
+  return point_operation<OP_MorphDiff>(dilate<Element, Border>(rhs),
+                                       erode<Element, Border>(rhs));
+}
+
+/// function top_hat
+/// \brief template deduction of the top hat, the input minus its opening,
+/// which keeps the bright details smaller than the structuring element. The
+/// neighbour operations read 8 bit and float pixels unchanged, so the input
+/// must be of one of these types.
+/// template parameters:
+/// \tparam Element: the structuring element, morph::Rect or morph::Cross
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return PixelBinaryOp
+template <typename Element, typename Border = border::Replicate, typename RHS>
+auto top_hat(RHS rhs) -> decltype(
+    point_operation<OP_MorphDiff>(rhs, morph_open<Element, Border>(rhs))) {
+  return point_operation<OP_MorphDiff>(rhs, morph_open<Element, Border>(rhs));
+}
+
+/// function black_hat
+/// \brief template deduction of the black hat, the closing minus the input,
+/// which keeps the dark details smaller than the structuring element. The
+/// input must be an 8 bit or a float image, as for top_hat.
+/// template parameters:
+/// \tparam Element: the structuring element, morph::Rect or morph::Cross
+/// \tparam Border: the border policy used to read the input outside of the
+/// image
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return PixelBinaryOp
+template <typename Element, typename Border = border::Replicate, typename RHS>
+auto black_hat(RHS rhs) -> decltype(
+    point_operation<OP_MorphDiff>(morph_close<Element, Border>(rhs), rhs)) {
+  return point_operation<OP_MorphDiff>(morph_close<Element, Border>(rhs), rhs);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_COMPLEX_OPS_MORPHOLOGY_HPP_
@@ -49,10 +49,13 @@ struct GlobalUnaryOp {
 /// template parameters:
 /// \tparam USROP : the user/built-in functor
 /// \tparam InTp the input type for that unary functor
-template <typename USROP, typename InTp>
+/// \tparam BorderT the border policy used to read outside of the input
+template <typename USROP, typename InTp,
+          typename BorderT = visioncpp::border::Replicate>
 struct LocalUnaryOp {
   using OP = USROP;
   using InType = InTp;
+  using Border = BorderT;
   visioncpp::internal::LocalNeighbour<InTp> x;
   using OutType = decltype(OP()(x));
   static constexpr size_t Operation_type = internal::ops_category::NeighbourOP;
@@ -65,11 +68,15 @@ struct LocalUnaryOp {
 /// \tparam USROP : the user/built-in functor
 /// \tparam InTp1 the left hand side input type for the binary functor
 /// \tparam InTp2 the right hand side input type for the binary functor
-template <typename USROP, typename InTp1, typename InTp2>
+/// \tparam BorderT the border policy used to read outside of the left hand
+/// side input
+template <typename USROP, typename InTp1, typename InTp2,
+          typename BorderT = visioncpp::border::Replicate>
 struct LocalBinaryOp {
   using OP = USROP;
   using InType1 = InTp1;
   using InType2 = InTp2;
+  using Border = BorderT;
   visioncpp::internal::LocalNeighbour<InTp1> x;
   visioncpp::internal::ConstNeighbour<InTp2> y;
   using OutType = decltype(OP()(x, y));
@@ -106,6 +113,57 @@ struct PixelBinaryOp {
   InType2 y;
   using OutType = decltype(OP()(x, y));
 };
+/// \struct LookupOp
+/// \brief This class is used to encapsulate the look up functor and the
+/// types of each operand in this functor. The functor passed to this struct is
+/// called with a pixel, the whole table and the column and row of the pixel.
+/// This struct is used for the Lookup point operation.
+/// template parameters:
+/// \tparam USROP : the user/built-in functor
+/// \tparam InTp1 the pixel type of the input
+/// \tparam InTp2 the element type of the table
+template <typename USROP, typename InTp1, typename InTp2>
+struct LookupOp {
+  using OP = USROP;
+  using InType1 = InTp1;
+  using InType2 = InTp2;
+  InType1 x;
+  visioncpp::internal::GlobalNeighbour<InTp2> y;
+  using OutType = decltype(OP()(x, y, 0, 0));
+};
+/// \struct ResizeOp
+/// \brief This class is used to encapsulate the resize functor and the type of
+/// its input. The functor passed to this struct is called with the whole input,
+/// whose offset is the output pixel, and the ratio between the input and the
+/// output size in each dimension. This struct is used for the Resize node.
+/// template parameters:
+/// \tparam USROP : the user/built-in functor
+/// \tparam InTp the pixel type of the input
+template <typename USROP, typename InTp>
+struct ResizeOp {
+  using OP = USROP;
+  using InType = InTp;
+  visioncpp::internal::GlobalNeighbour<InTp> x;
+  using OutType = decltype(OP()(x, 1.0f, 1.0f));
+};
+/// \struct WarpOp
+/// \brief This class is used to encapsulate the warp functor and the types of
+/// each operand in this functor. The functor passed to this struct is called
+/// with the whole input, whose offset is the output pixel, and the transform
+/// read from constant memory. This struct is used for the Warp node.
+/// template parameters:
+/// \tparam USROP : the user/built-in functor
+/// \tparam InTp1 the pixel type of the input
+/// \tparam InTp2 the element type of the transform
+template <typename USROP, typename InTp1, typename InTp2>
+struct WarpOp {
+  using OP = USROP;
+  using InType1 = InTp1;
+  using InType2 = InTp2;
+  visioncpp::internal::GlobalNeighbour<InTp1> x;
+  visioncpp::internal::ConstNeighbour<InTp2> y;
+  using OutType = decltype(OP()(x, y));
+};
 
 }  // internal
 }  // visioncpp
@@ -0,0 +1,197 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file histogram.hpp
+/// \brief This file contains the Histogram struct which is used to construct
+/// the nodes computing the histogram of an image, or of each tile of a grid
+/// of tiles covering the image.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_HISTOGRAM_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_HISTOGRAM_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct HistogramOp
+/// \brief This class is used to encapsulate the parameters of a histogram.
+/// The image is divided in TilesC x TilesR tiles of equal size and each tile
+/// has a histogram of BinCount bins. The pixels of a tile are shared by Units
+/// threads of the first kernel, whose counts are gathered in Groups partial
+/// histograms of GroupUnits consecutive units.
+/// template parameters:
+/// \tparam BinCount : the number of bins of each histogram
+/// \tparam TilesC : the number of tiles in the column dimension
+/// \tparam TilesR : the number of tiles in the row dimension
+/// \tparam InTp : the input pixel type
+/// \tparam InCols : the column size of the input
+/// \tparam InRows : the row size of the input
+template <size_t BinCount, size_t TilesC, size_t TilesR, typename InTp,
+          size_t InCols, size_t InRows>
+struct HistogramOp {
+  static_assert(InCols % TilesC == 0 && InRows % TilesR == 0,
+                "The image size must be a multiple of the histogram tiles");
+  using InType = InTp;
+  using OutType = unsigned int;
+  static constexpr size_t Bins = BinCount;
+  static constexpr size_t Tiles = TilesC * TilesR;
+  static constexpr size_t TileCols = InCols / TilesC;
+  static constexpr size_t TileRows = InRows / TilesR;
+  static constexpr size_t TilePixels = TileCols * TileRows;
+  static constexpr size_t Operation_type =
+      internal::ops_category::GlobalNeighbourOP;
+  /// the number of threads sharing the pixels of a tile in the first kernel.
+  /// As for the ReduceOp, there are at most 2048 of them for the whole image.
+  static constexpr size_t Units =
+      (Tiles >= 2048) ? 1 : ((TilePixels < 2048 / Tiles) ? TilePixels
+                                                          : 2048 / Tiles);
+  /// the number of consecutive units counted in the same partial histogram.
+  /// A workgroup counts a whole group in its local memory, so the partial
+  /// histograms do not grow with the number of units.
+  static constexpr size_t GroupUnits = 8;
+  /// the number of partial histograms of a tile
+  static constexpr size_t Groups = (Units + GroupUnits - 1) / GroupUnits;
+  /// \brief the bin of the pixel p, defined with the histogram operators
+  static inline size_t bin(const InType &p) { return histogram_bin<Bins>(p); }
+};
+
+/// \struct Histogram
+/// \brief Histogram is one of the two kernels computing a histogram.
+/// The reduce_stage::Partial node has Units threads per tile. Each unit
+/// reads the pixels of its tile Units apart, so neighbour threads read
+/// neighbour pixels, and a point operation input is fused with it. The bins
+/// are privatised per workgroup: a workgroup counts the units of a group
+/// with atomics in local memory and writes the bins in the row of the group,
+/// so there are Groups rows per tile. The reduce_stage::Final node has one
+/// thread per bin and tile which sums its column of the partial histograms
+/// of the tile. The result is a Bins x Tiles image of unsigned int.
+/// template parameters:
+/// \tparam HistOP: the HistogramOp applied
+/// \tparam Stage: the kernel, reduce_stage::Partial or reduce_stage::Final
+/// \tparam RHS: the input
+/// \tparam Cols: determines the column size of the output
+/// \tparam Rows: determines the row size of the output
+/// \tparam LfType: determines the type of the leafNode {Buffer2D, Buffer1D,
+/// Host, Image}
+/// \tparam LVL: the level of the node in the expression tree
+template <typename HistOP, size_t Stage, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Histogram {
+ public:
+  static_assert(RHS::Type::Cols != dynamic && RHS::Type::Rows != dynamic,
+                "The histogram node requires compile time Cols and Rows");
+  using RHSExpr = RHS;
+  static constexpr bool has_out = false;
+  using OPType = HistOP;
+  using OutType = typename HistOP::OutType;
+  using Type = typename OutputMemory<OutType, LfType, Cols, Rows, LVL>::Type;
+  static constexpr size_t Level = LVL;
+  /// the partial kernel has Units threads per tile and the final kernel one
+  /// thread per bin and tile
+  static constexpr size_t RThread = HistOP::Tiles;
+  static constexpr size_t CThread =
+      (Stage == reduce_stage::Partial) ? HistOP::Units : HistOP::Bins;
+  static constexpr size_t ND_Category = expr_category::Unary;
+  static constexpr size_t LeafType = Type::LeafType;
+  static constexpr bool SubExpressionEvaluationNeeded = true;
+  static constexpr size_t Operation_type = OPType::Operation_type;
+  /// a point operation input is evaluated for each pixel by the partial
+  /// kernel. Any other input is executed first.
+  static constexpr bool BreakChild =
+      (Stage == reduce_stage::Final) ||
+      (RHS::Operation_type != ops_category::PointOP);
+  template <typename TmpRHS>
+  using ExprExchange =
+      Histogram<HistOP, Stage, TmpRHS, Cols, Rows, LfType, LVL>;
+
+  RHS rhs;
+  bool subexpr_execution_reseter;
+  Histogram(RHS rhsArg) : rhs(rhsArg), subexpr_execution_reseter(false) {}
+
+  void reset(bool reset) {
+    rhs.reset(reset);
+    subexpr_execution_reseter = reset;
+  }
+  /// sub_expression_evaluation
+  /// \brief This function is used to break the expression tree whenever
+  /// necessary. The partial histograms are always written to global memory
+  /// before the final kernel reads them.
+  /// template parameters:
+  ///\tparam ForcedToExec : a boolean value representing the decision made by
+  /// the parent of this node for launching a kernel.
+  /// \tparam LC: is the column size of local memory
+  /// \tparam LR: is the row size of local memory
+  /// \tparam LCT: is the column size of workgroup
+  /// \tparam LRT: is the row size of workgroup
+  /// \tparam DeviceT: type representing the device
+  /// function parameters:
+  /// \param dev : the selected device for executing the expression
+  /// \return LeafNode
+  template <bool ForcedToExec, size_t LC, size_t LR, size_t LCT, size_t LRT,
+            typename DeviceT>
+  auto inline sub_expression_evaluation(const DeviceT &dev)
+      -> decltype(execute_expr<BreakChild, ForcedToExec, ExprExchange<RHS>, LC,
+                               LR, LCT, LRT>(
+          rhs.template sub_expression_evaluation<BreakChild, LC, LR, LCT,
+                                                 LRT>(dev),
+          dev)) {
+    return execute_expr<BreakChild, ForcedToExec, ExprExchange<RHS>, LC, LR,
+                        LCT, LRT>(
+        rhs.template sub_expression_evaluation<BreakChild, LC, LR, LCT, LRT>(
+            dev),
+        dev);
+  }
+};
+}  // internal
+
+/// function histogram
+/// \brief template deduction for the histograms of the TilesC x TilesR tiles
+/// of a single channel input. A float pixel in [0, 1] or an unsigned char
+/// pixel in [0, 255] is counted in the bin of its value scaled to
+/// [0, Bins). The histograms are computed by two kernels without going back
+/// to the host and the result is an image of Bins columns with one row per
+/// tile, in row major order of the tiles. The image size must be a multiple
+/// of the tile grid.
+/// template parameters:
+/// \tparam Bins: the number of bins of each histogram
+/// \tparam TilesC: the number of tiles in the column dimension
+/// \tparam TilesR: the number of tiles in the row dimension
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return Histogram
+template <size_t Bins, size_t TilesC = 1, size_t TilesR = 1, typename RHS,
+          typename HOP =
+              internal::HistogramOp<Bins, TilesC, TilesR, typename RHS::OutType,
+                                    RHS::Type::Cols, RHS::Type::Rows>>
+auto histogram(RHS rhs)
+    -> internal::Histogram<
+        HOP, internal::reduce_stage::Final,
+        internal::Histogram<HOP, internal::reduce_stage::Partial, RHS, Bins,
+                            HOP::Groups * HOP::Tiles, RHS::Type::LeafType,
+                            1 + RHS::Level>,
+        Bins, HOP::Tiles, RHS::Type::LeafType, 2 + RHS::Level> {
+  using Partial =
+      internal::Histogram<HOP, internal::reduce_stage::Partial, RHS, Bins,
+                          HOP::Groups * HOP::Tiles, RHS::Type::LeafType,
+                          1 + RHS::Level>;
+  return internal::Histogram<HOP, internal::reduce_stage::Final, Partial, Bins,
+                             HOP::Tiles, RHS::Type::LeafType, 2 + RHS::Level>(
+      Partial(rhs));
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_HISTOGRAM_HPP_
@@ -24,7 +24,10 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_NEIGHBOUR_OPS_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_NEIGHBOUR_OPS_HPP_
 
+#include "histogram.hpp"
+#include "reduce.hpp"
 #include "reduction.hpp"
+#include "scan.hpp"
 #include "stencil_no_filter.hpp"
 #include "stencil_with_filter.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_NEIGHBOUR_OPS_HPP_
@@ -0,0 +1,212 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file reduce.hpp
+/// \brief This file contains the Reduce struct which is used to construct the
+/// nodes reducing a whole image to a single pixel, e.g. its sum, minimum,
+/// maximum or mean.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_REDUCE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_REDUCE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct ReduceOp
+/// \brief This class is used to encapsulate the reduction functor and the
+/// types of each operand in this functor. The pixels are mapped to the AccType
+/// which is reduced over the image, and the OutType is the result computed
+/// from the reduction of the whole image.
+/// template parameters:
+/// \tparam USROP : the user/built-in reduction functor
+/// \tparam InTp : the input type of the functor
+/// \tparam InPixels : the number of pixels of the input
+template <typename USROP, typename InTp, size_t InPixels>
+struct ReduceOp {
+  using OP = USROP;
+  using InType = InTp;
+  static constexpr size_t Pixels = InPixels;
+  InTp x;
+  using AccType = decltype(OP().map(x, 0, 0));
+  AccType acc;
+  using OutType = decltype(OP().result(acc, 0));
+  static constexpr size_t Operation_type =
+      internal::ops_category::GlobalNeighbourOP;
+  /// the number of partial values computed by the first kernel. Each one is
+  /// the reduction of the pixels Units apart.
+  static constexpr size_t Units = (Pixels < 2048) ? Pixels : 2048;
+};
+
+/// \struct Reduce
+/// \brief Reduce is one of the two kernels reducing a whole image. The
+/// reduce_stage::Partial node has one thread for each of its Cols partial
+/// values, which reduces the pixels Cols apart, so the threads of a workgroup
+/// read consecutive pixels. A point operation input is fused with it. The
+/// reduce_stage::Final node combines the partial values with a tree reduction
+/// in the local memory of a single workgroup and writes the result in a 1x1
+/// image, which can be read by the point operations of any image size.
+/// template parameters:
+/// \tparam ReduceOP: the ReduceOp applied
+/// \tparam Stage: the kernel, reduce_stage::Partial or reduce_stage::Final
+/// \tparam RHS: the input
+/// \tparam Cols: determines the column size of the output
+/// \tparam Rows: determines the row size of the output
+/// \tparam LfType: determines the type of the leafNode {Buffer2D, Buffer1D,
+/// Host, Image}
+/// \tparam LVL: the level of the node in the expression tree
+template <typename ReduceOP, size_t Stage, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Reduce {
+ public:
+  static_assert(RHS::Type::Cols != dynamic && RHS::Type::Rows != dynamic,
+                "The reduce node requires compile time Cols and Rows");
+  using RHSExpr = RHS;
+  static constexpr bool has_out = false;
+  using OPType = ReduceOP;
+  using OutType =
+      typename tools::StaticIf<Stage == reduce_stage::Partial,
+                               typename ReduceOP::AccType,
+                               typename ReduceOP::OutType>::Type;
+  using Type = typename OutputMemory<OutType, LfType, Cols, Rows, LVL>::Type;
+  static constexpr size_t Level = LVL;
+  /// both kernels have one thread for each partial value
+  static constexpr size_t RThread = 1;
+  static constexpr size_t CThread =
+      (Stage == reduce_stage::Partial) ? Cols : RHS::Type::Cols;
+  static constexpr size_t ND_Category = expr_category::Unary;
+  static constexpr size_t LeafType = Type::LeafType;
+  static constexpr bool SubExpressionEvaluationNeeded = true;
+  static constexpr size_t Operation_type = OPType::Operation_type;
+  /// a point operation input is evaluated for each pixel by the partial
+  /// kernel. Any other input is executed first.
+  static constexpr bool BreakChild =
+      (Stage == reduce_stage::Final) ||
+      (RHS::Operation_type != ops_category::PointOP);
+  template <typename TmpRHS>
+  using ExprExchange = Reduce<ReduceOP, Stage, TmpRHS, Cols, Rows, LfType, LVL>;
+
+  RHS rhs;
+  bool subexpr_execution_reseter;
+  Reduce(RHS rhsArg) : rhs(rhsArg), subexpr_execution_reseter(false) {}
+
+  void reset(bool reset) {
+    rhs.reset(reset);
+    subexpr_execution_reseter = reset;
+  }
+  /// sub_expression_evaluation
+  /// \brief This function is used to break the expression tree whenever
+  /// necessary. The partial values are always written to global memory
+  /// before the final kernel reads them.
+  /// template parameters:
+  ///\tparam ForcedToExec : a boolean value representing the decision made by
+  /// the parent of this node for launching a kernel.
+  /// \tparam LC: is the column size of local memory
+  /// \tparam LR: is the row size of local memory
+  /// \tparam LCT: is the column size of workgroup
+  /// \tparam LRT: is the row size of workgroup
+  /// \tparam DeviceT: type representing the device
+  /// function parameters:
+  /// \param dev : the selected device for executing the expression
+  /// \return LeafNode
+  template <bool ForcedToExec, size_t LC, size_t LR, size_t LCT, size_t LRT,
+            typename DeviceT>
+  auto inline sub_expression_evaluation(const DeviceT &dev)
+      -> decltype(execute_expr<BreakChild, ForcedToExec, ExprExchange<RHS>, LC,
+                               LR, LCT, LRT>(
+          rhs.template sub_expression_evaluation<BreakChild, LC, LR, LCT,
+                                                 LRT>(dev),
+          dev)) {
+    return execute_expr<BreakChild, ForcedToExec, ExprExchange<RHS>, LC, LR,
+                        LCT, LRT>(
+        rhs.template sub_expression_evaluation<BreakChild, LC, LR, LCT, LRT>(
+            dev),
+        dev);
+  }
+};
+}  // internal
+
+/// function reduce
+/// \brief template deduction for the reduction of the whole input by the OP
+/// functor, e.g. OP_ReduceSum. The reduction is computed by two kernels: the
+/// first one reduces the input to ReduceOp::Units partial values and the
+/// second one combines them. The result is a 1x1 image, so it can be used by
+/// the point operations on the input without going back to the host, e.g.
+/// point_operation<OP_Div>(in, reduce<OP_ReduceMean>(in)).
+/// template parameters:
+/// \tparam OP: the reduction functor
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return Reduce
+template <typename OP, typename RHS,
+          typename ROP = internal::ReduceOp<OP, typename RHS::OutType,
+                                            RHS::Type::Cols * RHS::Type::Rows>,
+          size_t Units = ROP::Units>
+auto reduce(RHS rhs)
+    -> internal::Reduce<
+        ROP, internal::reduce_stage::Final,
+        internal::Reduce<ROP, internal::reduce_stage::Partial, RHS, Units, 1,
+                         RHS::Type::LeafType, 1 + RHS::Level>,
+        1, 1, RHS::Type::LeafType, 2 + RHS::Level> {
+  using Partial =
+      internal::Reduce<ROP, internal::reduce_stage::Partial, RHS, Units, 1,
+                       RHS::Type::LeafType, 1 + RHS::Level>;
+  return internal::Reduce<ROP, internal::reduce_stage::Final, Partial, 1, 1,
+                          RHS::Type::LeafType, 2 + RHS::Level>(Partial(rhs));
+}
+
+/// \brief template deduction for the sum of the pixels of the input, channel
+/// by channel. An 8 bit image should be converted to float first.
+template <typename RHS>
+auto reduce_sum(RHS rhs) -> decltype(reduce<OP_ReduceSum>(rhs)) {
+  return reduce<OP_ReduceSum>(rhs);
+}
+/// \brief template deduction for the mean of the pixels of the input, channel
+/// by channel.
+template <typename RHS>
+auto reduce_mean(RHS rhs) -> decltype(reduce<OP_ReduceMean>(rhs)) {
+  return reduce<OP_ReduceMean>(rhs);
+}
+/// \brief template deduction for the minimum of the pixels of the input,
+/// channel by channel.
+template <typename RHS>
+auto reduce_min(RHS rhs) -> decltype(reduce<OP_ReduceMin>(rhs)) {
+  return reduce<OP_ReduceMin>(rhs);
+}
+/// \brief template deduction for the maximum of the pixels of the input,
+/// channel by channel.
+template <typename RHS>
+auto reduce_max(RHS rhs) -> decltype(reduce<OP_ReduceMax>(rhs)) {
+  return reduce<OP_ReduceMax>(rhs);
+}
+/// \brief template deduction for the maximum of a single channel input and
+/// its location. The result is an F32C3 pixel holding the maximum, its column
+/// and its row.
+template <typename RHS>
+auto reduce_argmax(RHS rhs) -> decltype(reduce<OP_ReduceArgMax>(rhs)) {
+  return reduce<OP_ReduceArgMax>(rhs);
+}
+/// \brief template deduction for the mean and the standard deviation of a
+/// single channel input. The result is an F32C2 pixel holding the mean and
+/// the standard deviation.
+template <typename RHS>
+auto mean_stddev(RHS rhs) -> decltype(reduce<OP_ReduceMeanStdDev>(rhs)) {
+  return reduce<OP_ReduceMeanStdDev>(rhs);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_REDUCE_HPP_
@@ -41,6 +41,10 @@ template <typename DownSmplOP, typename RHS, size_t Cols, size_t Rows,
           size_t LfType, size_t LVL>
 struct RDCN {
  public:
+  static_assert(Cols != dynamic && Rows != dynamic &&
+                    RHS::Type::Cols != dynamic && RHS::Type::Rows != dynamic,
+                "The reduction node requires compile time Cols and Rows for "
+                "both its input and output");
   static constexpr size_t LC_Ratio =
       tools::IfConst<DownSmplOP::Operation_type ==
                          ops_category::GlobalNeighbourOP,
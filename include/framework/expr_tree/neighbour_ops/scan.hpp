@@ -0,0 +1,173 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file scan.hpp
+/// \brief This file contains the Scan struct which is used to construct a
+/// node computing the prefix sum of its input along the rows or the columns,
+/// and the integral_image built from two of them.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_SCAN_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_SCAN_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct ScanOp
+/// \brief ScanOp is used to encapsulate the types of the inclusive prefix sum
+/// applied by a Scan node. The output has the pixel type of the input.
+/// template parameters:
+/// \tparam ScanDim: the dimension scanned, mem_dim::ColDim to sum each row from
+/// its first column and mem_dim::RowDim to sum each column from its first row
+/// \tparam InTp: the input type
+template <size_t ScanDim, typename InTp>
+struct ScanOp {
+  using OP = ScanOp;
+  static constexpr size_t Dim = ScanDim;
+  using InType = InTp;
+  using OutType = InTp;
+  static constexpr size_t Operation_type =
+      internal::ops_category::GlobalNeighbourOP;
+  /// the number of columns loaded at once in local memory by a workgroup
+  /// scanning the rows
+  static constexpr size_t Chunk = 32;
+};
+
+/// \struct ScanThread
+/// \brief ScanThread gives the threads of a Scan node. Each thread of a Scan
+/// walks whole lines of the image, so there is a single column of threads
+/// when the rows are scanned and a single row of threads when the columns are
+/// scanned.
+/// template parameters:
+/// \tparam Dim: the dimension scanned
+/// \tparam Cols: the column size of the image
+/// \tparam Rows: the row size of the image
+template <size_t Dim, size_t Cols, size_t Rows>
+struct ScanThread {
+  static constexpr size_t CThread = 1;
+  static constexpr size_t RThread = Rows;
+};
+/// \brief specialisation of ScanThread when the columns are scanned
+template <size_t Cols, size_t Rows>
+struct ScanThread<mem_dim::RowDim, Cols, Rows> {
+  static constexpr size_t CThread = Cols;
+  static constexpr size_t RThread = 1;
+};
+
+/// \struct Scan
+/// \brief Scan computes the inclusive prefix sum of its input along one
+/// dimension. It is a global operation: its input is always executed first and
+/// the Scan runs in its own kernel, as the sum of a pixel depends on the
+/// pixels computed by the other workgroups.
+/// template parameters:
+/// \tparam ScanOP: the ScanOp giving the dimension scanned
+/// \tparam RHS: the input
+/// \tparam Cols: determines the column size of the output
+/// \tparam Rows: determines the row size of the output
+/// \tparam LfType: determines the type of the leafNode {Buffer2D, Buffer1D,
+/// Host, Image}
+/// \tparam LVL: the level of the node in the expression tree
+template <typename ScanOP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct Scan {
+ public:
+  static_assert(Cols != dynamic && Rows != dynamic,
+                "The scan node requires compile time Cols and Rows");
+  using RHSExpr = RHS;
+  static constexpr bool has_out = false;
+  using OPType = ScanOP;
+  using OutType = typename OPType::OutType;
+  using Type = typename OutputMemory<OutType, LfType, Cols, Rows, LVL>::Type;
+  static constexpr size_t Level = LVL;
+  static constexpr size_t RThread =
+      ScanThread<ScanOP::Dim, Cols, Rows>::RThread;
+  static constexpr size_t CThread =
+      ScanThread<ScanOP::Dim, Cols, Rows>::CThread;
+  static constexpr size_t ND_Category = expr_category::Unary;
+  static constexpr size_t LeafType = Type::LeafType;
+  static constexpr bool SubExpressionEvaluationNeeded = true;
+  static constexpr size_t Operation_type = OPType::Operation_type;
+  template <typename TmpRHS>
+  using ExprExchange = Scan<ScanOP, TmpRHS, Cols, Rows, LfType, LVL>;
+
+  RHS rhs;
+  bool subexpr_execution_reseter;
+  Scan(RHS rhsArg) : rhs(rhsArg), subexpr_execution_reseter(false) {}
+
+  void reset(bool reset) {
+    rhs.reset(reset);
+    subexpr_execution_reseter = reset;
+  }
+  /// sub_expression_evaluation
+  /// \brief This function is used to break the expression tree whenever
+  /// necessary. The input of a Scan is always executed separately.
+  /// template parameters:
+  ///\tparam ForcedToExec : a boolean value representing the decision made by
+  /// the parent of this node for launching a kernel.
+  /// \tparam LC: is the column size of local memory
+  /// \tparam LR: is the row size of local memory
+  /// \tparam LCT: is the column size of workgroup
+  /// \tparam LRT: is the row size of workgroup
+  /// \tparam DeviceT: type representing the device
+  /// function parameters:
+  /// \param dev : the selected device for executing the expression
+  /// \return LeafNode
+  template <bool ForcedToExec, size_t LC, size_t LR, size_t LCT, size_t LRT,
+            typename DeviceT>
+  auto inline sub_expression_evaluation(const DeviceT &dev)
+      -> decltype(execute_expr<true, ForcedToExec, ExprExchange<RHS>, LC, LR,
+                               LCT, LRT>(
+          rhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+          dev)) {
+    return execute_expr<true, ForcedToExec, ExprExchange<RHS>, LC, LR, LCT,
+                        LRT>(
+        rhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+        dev);
+  }
+};
+}  // internal
+
+/// \brief template deduction function for Scan. The prefix sum is computed
+/// along the columns of each row when Dim is mem_dim::ColDim, and along the
+/// rows of each column when it is mem_dim::RowDim.
+template <size_t Dim, typename RHS>
+auto scan(RHS rhs)
+    -> internal::Scan<internal::ScanOp<Dim, typename RHS::OutType>, RHS,
+                      RHS::Type::Cols, RHS::Type::Rows, RHS::Type::LeafType,
+                      1 + RHS::Level> {
+  return internal::Scan<internal::ScanOp<Dim, typename RHS::OutType>, RHS,
+                        RHS::Type::Cols, RHS::Type::Rows, RHS::Type::LeafType,
+                        1 + RHS::Level>(rhs);
+}
+
+/// function integral_image
+/// \brief template deduction for the integral image (summed area table) of
+/// the input. The pixel (c, r) of the output is the sum of the input pixels
+/// (i, j) with i <= c and j <= r. It is computed by a scan of the rows followed
+/// by a scan of the columns, each one reading and writing the image once. The
+/// output has the pixel type of the input, so an 8 bit image should be
+/// converted to float first. A float sum is exact up to 2^24.
+/// \param rhs : the input expression
+/// \return Scan
+template <typename RHS>
+auto integral_image(RHS rhs)
+    -> decltype(scan<internal::mem_dim::RowDim>(
+        scan<internal::mem_dim::ColDim>(rhs))) {
+  return scan<internal::mem_dim::RowDim>(scan<internal::mem_dim::ColDim>(rhs));
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_SCAN_HPP_
@@ -119,33 +119,48 @@ struct StnNoFilt {
 };
 
 /// \brief template deduction for StnNoFilt class when the memory type of the
-/// output and column and row are defined by a user.
+/// output and column and row are defined by a user. In all the StnNoFilt
+/// deductions, the optional Border type is the border policy used to read the
+/// input outside of the image; it is border::Replicate by default.
 template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
           size_t Halo_R, size_t Cols, size_t Rows, size_t LeafType,
-          typename RHS>
-auto neighbour_operation(RHS rhs)
-    -> internal::StnNoFilt<internal::LocalUnaryOp<OP, typename RHS::OutType>,
-                           Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols, Rows,
-                           LeafType, 1 + RHS::Level> {
-  return internal::StnNoFilt<internal::LocalUnaryOp<OP, typename RHS::OutType>,
-                             Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols, Rows,
-                             LeafType, 1 + RHS::Level>(rhs);
+          typename Border = border::Replicate, typename RHS>
+auto neighbour_operation(RHS rhs) -> internal::StnNoFilt<
+    internal::LocalUnaryOp<OP, typename RHS::OutType, Border>, Halo_T, Halo_L,
+    Halo_B, Halo_R, RHS, Cols, Rows, LeafType, 1 + RHS::Level> {
+  return internal::StnNoFilt<
+      internal::LocalUnaryOp<OP, typename RHS::OutType, Border>, Halo_T,
+      Halo_L, Halo_B, Halo_R, RHS, Cols, Rows, LeafType, 1 + RHS::Level>(rhs);
 }
 }  // namespace
 
 /// \brief template deduction for StnNoFilt class when the memory type of the
 /// output and column and row are automatically deduced from the input.
 template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
-          size_t Halo_R, typename RHS>
-auto neighbour_operation(RHS rhs)
-    -> internal::StnNoFilt<internal::LocalUnaryOp<OP, typename RHS::OutType>,
-                           Halo_T, Halo_L, Halo_B, Halo_R, RHS, RHS::Type::Cols,
-                           RHS::Type::Rows, RHS::Type::LeafType,
-                           1 + RHS::Level> {
-  return internal::StnNoFilt<internal::LocalUnaryOp<OP, typename RHS::OutType>,
-                             Halo_T, Halo_L, Halo_B, Halo_R, RHS,
-                             RHS::Type::Cols, RHS::Type::Rows,
-                             RHS::Type::LeafType, 1 + RHS::Level>(rhs);
+          size_t Halo_R, typename Border = border::Replicate, typename RHS>
+auto neighbour_operation(RHS rhs) -> internal::StnNoFilt<
+    internal::LocalUnaryOp<OP, typename RHS::OutType, Border>, Halo_T, Halo_L,
+    Halo_B, Halo_R, RHS, RHS::Type::Cols, RHS::Type::Rows, RHS::Type::LeafType,
+    1 + RHS::Level> {
+  return internal::StnNoFilt<
+      internal::LocalUnaryOp<OP, typename RHS::OutType, Border>, Halo_T,
+      Halo_L, Halo_B, Halo_R, RHS, RHS::Type::Cols, RHS::Type::Rows,
+      RHS::Type::LeafType, 1 + RHS::Level>(rhs);
+}
+
+/// \brief template deduction for StnNoFilt class when the functor defines its
+/// Radius, e.g. the median filters. The halo on each side is the radius and the
+/// memory type of the output and column and row are automatically deduced from
+/// the input.
+template <typename OP, typename Border = border::Replicate, typename RHS>
+auto neighbour_operation(RHS rhs) -> internal::StnNoFilt<
+    internal::LocalUnaryOp<OP, typename RHS::OutType, Border>, OP::Radius,
+    OP::Radius, OP::Radius, OP::Radius, RHS, RHS::Type::Cols, RHS::Type::Rows,
+    RHS::Type::LeafType, 1 + RHS::Level> {
+  return internal::StnNoFilt<
+      internal::LocalUnaryOp<OP, typename RHS::OutType, Border>, OP::Radius,
+      OP::Radius, OP::Radius, OP::Radius, RHS, RHS::Type::Cols,
+      RHS::Type::Rows, RHS::Type::LeafType, 1 + RHS::Level>(rhs);
 }
 }  // visioncpp
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_STENCIL_NO_FILTER_HPP_
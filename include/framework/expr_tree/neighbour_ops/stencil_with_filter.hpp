@@ -131,17 +131,21 @@ struct StnFilt {
 }  // internal
 
 /// \brief template deduction for StnFilt class when the memory types of the
-/// output and column and row are defined by a user.
-template <typename OP, size_t Cols, size_t Rows, size_t LeafType, typename LHS,
-          typename RHS>
+/// output and column and row are defined by a user. In all the StnFilt
+/// deductions, the optional Border type is the border policy used to read the
+/// input outside of the image; it is border::Replicate by default.
+template <typename OP, size_t Cols, size_t Rows, size_t LeafType,
+          typename Border = border::Replicate, typename LHS, typename RHS>
 auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
-    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType>,
+    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                            Border>,
     RHS::Type::Rows / 2, RHS::Type::Cols / 2, RHS::Type::Rows / 2,
     RHS::Type::Cols / 2, LHS, RHS, Cols, Rows, LeafType,
     1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
                                   RHS>::Type::Level> {
   return internal::StnFilt<
-      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType>,
+      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                              Border>,
       RHS::Type::Rows / 2, RHS::Type::Cols / 2, RHS::Type::Rows / 2,
       RHS::Type::Cols / 2, LHS, RHS, Cols, Rows, LeafType,
       1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
@@ -150,16 +154,19 @@ auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
 
 /// \brief template deduction for StnFilt class when the memory type of the
 /// output and column and row are automatically deduced from the input.
-template <typename OP, typename LHS, typename RHS>
+template <typename OP, typename Border = border::Replicate, typename LHS,
+          typename RHS>
 auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
-    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType>,
+    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                            Border>,
     RHS::Type::Rows / 2, RHS::Type::Cols / 2, RHS::Type::Rows / 2,
     RHS::Type::Cols / 2, LHS, RHS, LHS::Type::Cols, LHS::Type::Rows,
     LHS::Type::LeafType,
     1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
                                   RHS>::Type::Level> {
   return internal::StnFilt<
-      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType>,
+      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                              Border>,
       RHS::Type::Rows / 2, RHS::Type::Cols / 2, RHS::Type::Rows / 2,
       RHS::Type::Cols / 2, LHS, RHS, LHS::Type::Cols, LHS::Type::Rows,
       LHS::Type::LeafType,
@@ -171,14 +178,16 @@ auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
 /// output; halos; and column and row are defined by a user.
 template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
           size_t Halo_R, size_t Cols, size_t Rows, size_t LeafType,
-          typename LHS, typename RHS>
+          typename Border = border::Replicate, typename LHS, typename RHS>
 auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
-    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType>,
+    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                            Border>,
     Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols, Rows, LeafType,
     1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
                                   RHS>::Type::Level> {
   return internal::StnFilt<
-      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType>,
+      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                              Border>,
       Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols, Rows, LeafType,
       1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
                                     RHS>::Type::Level>(lhs, rhs);
@@ -188,15 +197,18 @@ auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
 /// output and column and row are automatically deduced from the input. However,
 /// the halos are defined by user.
 template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
-          size_t Halo_R, typename LHS, typename RHS>
+          size_t Halo_R, typename Border = border::Replicate, typename LHS,
+          typename RHS>
 auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
-    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType>,
+    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                            Border>,
     Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, LHS::Type::Cols, LHS::Type::Rows,
     LHS::Type::LeafType,
     1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
                                   RHS>::Type::Level> {
   return internal::StnFilt<
-      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType>,
+      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                              Border>,
       Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, LHS::Type::Cols,
       LHS::Type::Rows, LHS::Type::LeafType,
       1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
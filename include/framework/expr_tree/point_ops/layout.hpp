@@ -0,0 +1,75 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file layout.hpp
+/// \brief This file contains the deduction functions of the conversions
+/// between the interleaved and the planar layouts.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_LAYOUT_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_LAYOUT_HPP_
+
+namespace visioncpp {
+/// function from_planar
+/// \brief template deduction for reading a planar image as pixels of N
+/// channels. The input is an image of channels with N planes of Rows / N rows
+/// one below the other, e.g. a terminal of layout::Planar. Each output pixel
+/// reads its channels from the N planes, so neighbour work-items read
+/// contiguous elements of each plane, and the conversion is fused with the
+/// point and neighbour operations applied to its output.
+/// template parameters:
+/// \tparam N: the number of channels
+/// \tparam RHS: the type of the planar expression
+/// function parameters:
+/// \param rhs : the planar expression
+/// \return Resize
+template <size_t N, typename RHS>
+auto from_planar(RHS rhs) -> internal::Resize<
+    internal::ResizeOp<OP_FromPlanar<N>, typename RHS::OutType>, RHS,
+    RHS::Type::Cols, RHS::Type::Rows / N, RHS::Type::LeafType,
+    1 + RHS::Level> {
+  static_assert(RHS::Type::Rows % N == 0,
+                "The rows of a planar image must be a multiple of its channels");
+  return internal::Resize<
+      internal::ResizeOp<OP_FromPlanar<N>, typename RHS::OutType>, RHS,
+      RHS::Type::Cols, RHS::Type::Rows / N, RHS::Type::LeafType,
+      1 + RHS::Level>(rhs);
+}
+
+/// function to_planar
+/// \brief template deduction for writing an image of pixels in the planar
+/// layout. The output is an image of channels with one plane of Rows rows
+/// per channel, to be assigned to a terminal of layout::Planar. The input is
+/// executed before the conversion unless it is a terminal node.
+/// template parameters:
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return Resize
+template <typename RHS, size_t N = RHS::OutType::elements>
+auto to_planar(RHS rhs) -> internal::Resize<
+    internal::ResizeOp<OP_ToPlanar, typename RHS::OutType>, RHS,
+    RHS::Type::Cols, RHS::Type::Rows * N, RHS::Type::LeafType,
+    1 + RHS::Level> {
+  return internal::Resize<
+      internal::ResizeOp<OP_ToPlanar, typename RHS::OutType>, RHS,
+      RHS::Type::Cols, RHS::Type::Rows * N, RHS::Type::LeafType,
+      1 + RHS::Level>(rhs);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_LAYOUT_HPP_
@@ -54,6 +54,9 @@ struct LeafNode {
   static constexpr size_t Operation_type = internal::ops_category::PointOP;
   LeafNode(RHS dt) : vilibMemory(dt), subexpr_execution_reseter(false) {}
   LeafNode() : LeafNode(Type()) {}  // at this point RHS =Type must hold
+  /// creates the device only memory with the given runtime size. The size is
+  /// only used for dynamic extents.
+  LeafNode(size_t cols, size_t rows) : LeafNode(Type(cols, rows)) {}
   /// buffer copy is lightweight no need to pass by ref
   bool subexpr_execution_reseter;
   LeafNode(typename RHS::syclBuffer dt) : LeafNode(RHS(dt)) {}
@@ -103,6 +106,13 @@ struct LeafNode {
   /// \return void
   inline void reset_input(Scalar *dt) { vilibMemory.reset_input(dt); }
 
+  /// \brief read_output is used to copy the content of the memory to the given
+  /// host pointer without destroying the sycl buffer. This can be used when we
+  /// are dealing with video streaming and the output memory is reused for
+  /// every frame.
+  /// \return void
+  inline void read_output(Scalar *dt) { vilibMemory.read_output(dt); }
+
   /// \brief lock function is used to access the sycl buffer on the host using
   /// a host pointer. Because the host accessor is blocking. We are creating it
   /// dynamically so by calling the lock function. It is the responsibility of
@@ -132,6 +142,9 @@ auto terminal(typename internal::MemoryProperties<ElemTp>::ChannelType *dt)
             Rows, ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc,
             0>,
         0> {
+  static_assert(Cols != dynamic && Rows != dynamic,
+                "The runtime size must be passed to the terminal node when "
+                "Cols or Rows is dynamic");
   return internal::LeafNode<
       internal::VisionMemory<
           true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
@@ -153,6 +166,9 @@ auto terminal() -> internal::LeafNode<
         typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
         ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>,
     0> {
+  static_assert(Cols != dynamic && Rows != dynamic,
+                "The runtime size must be passed to the terminal node when "
+                "Cols or Rows is dynamic");
   return internal::LeafNode<
       internal::VisionMemory<
           false, internal::MemoryProperties<ElemTp>::ElementCategory,
@@ -165,6 +181,236 @@ auto terminal() -> internal::LeafNode<
       ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>());
 }
 
+/// \brief template deduction of LeafNode for buffer/image/host 2d when the
+/// size of the memory is given at runtime. The runtime size is used when Cols
+/// or Rows is dynamic.
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          size_t Sc = scope::Global>
+auto terminal(typename internal::MemoryProperties<ElemTp>::ChannelType *dt,
+              size_t cols, size_t rows)
+    -> internal::LeafNode<
+        internal::VisionMemory<
+            true, internal::MemoryProperties<ElemTp>::ElementCategory,
+            MemoryType,
+            typename internal::MemoryProperties<ElemTp>::ChannelType, Cols,
+            Rows, ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc,
+            0>,
+        0> {
+  return internal::LeafNode<
+      internal::VisionMemory<
+          true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+          typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+          ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>,
+      0>(internal::VisionMemory<
+      true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+      typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+      ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>(
+      dt, cols, rows));
+}
+
+/// \brief template deduction of LeafNode for buffer/host 2d sharing the host
+/// memory with the device. The sycl buffer is created with the use_host_ptr
+/// property, so a cpu or integrated gpu device reads and writes the host
+/// memory in place, and reset_input and read_output given the same pointer do
+/// not copy the frame. The pointer must be aligned on host_ptr_alignment
+/// bytes, e.g. allocated by aligned_allocator, otherwise std::invalid_argument
+/// is thrown.
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          size_t Sc = scope::Global>
+auto terminal(typename internal::MemoryProperties<ElemTp>::ChannelType *dt,
+              use_host_ptr_t tag)
+    -> internal::LeafNode<
+        internal::VisionMemory<
+            true, internal::MemoryProperties<ElemTp>::ElementCategory,
+            MemoryType,
+            typename internal::MemoryProperties<ElemTp>::ChannelType, Cols,
+            Rows, ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc,
+            0>,
+        0> {
+  static_assert(Cols != dynamic && Rows != dynamic,
+                "The runtime size must be passed to the terminal node when "
+                "Cols or Rows is dynamic");
+  static_assert(MemoryType != memory_type::Image &&
+                    MemoryType != memory_type::Const,
+                "use_host_ptr is only supported for buffer memory");
+  return internal::LeafNode<
+      internal::VisionMemory<
+          true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+          typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+          ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>,
+      0>(internal::VisionMemory<
+      true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+      typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+      ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>(dt,
+                                                                      tag));
+}
+
+/// \brief template deduction of LeafNode sharing the host memory with the
+/// device when the size of the memory is given at runtime. The runtime size
+/// is used when Cols or Rows is dynamic.
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          size_t Sc = scope::Global>
+auto terminal(typename internal::MemoryProperties<ElemTp>::ChannelType *dt,
+              size_t cols, size_t rows, use_host_ptr_t tag)
+    -> internal::LeafNode<
+        internal::VisionMemory<
+            true, internal::MemoryProperties<ElemTp>::ElementCategory,
+            MemoryType,
+            typename internal::MemoryProperties<ElemTp>::ChannelType, Cols,
+            Rows, ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc,
+            0>,
+        0> {
+  static_assert(MemoryType != memory_type::Image &&
+                    MemoryType != memory_type::Const,
+                "use_host_ptr is only supported for buffer memory");
+  return internal::LeafNode<
+      internal::VisionMemory<
+          true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+          typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+          ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>,
+      0>(internal::VisionMemory<
+      true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+      typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+      ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>(
+      dt, tag, cols, rows));
+}
+
+/// \brief creation of the device only memory when the size of the memory is
+/// given at runtime. The runtime size is used when Cols or Rows is dynamic.
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          size_t Sc = scope::Global>
+auto terminal(size_t cols, size_t rows) -> internal::LeafNode<
+    internal::VisionMemory<
+        false, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+        typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+        ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>,
+    0> {
+  return internal::LeafNode<
+      internal::VisionMemory<
+          false, internal::MemoryProperties<ElemTp>::ElementCategory,
+          MemoryType, typename internal::MemoryProperties<ElemTp>::ChannelType,
+          Cols, Rows, ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize,
+          Sc, 0>,
+      0>(internal::VisionMemory<
+      false, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+      typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+      ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>(cols,
+                                                                      rows));
+}
+
+/// \brief template deduction of LeafNode holding a batch of N images of the
+/// same size. The images are stored one after the other in the host pointer.
+/// The batch is processed by a single kernel when the expression is executed
+/// by execute_batch.
+template <typename ElemTp, size_t Cols, size_t Rows, size_t N,
+          size_t MemoryType, size_t Sc = scope::Global>
+auto terminal_batch(
+    typename internal::MemoryProperties<ElemTp>::ChannelType *dt)
+    -> internal::LeafNode<
+        internal::VisionMemory<
+            true, internal::MemoryProperties<ElemTp>::ElementCategory,
+            MemoryType,
+            typename internal::MemoryProperties<ElemTp>::ChannelType, Cols,
+            Rows, ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc,
+            0>,
+        0> {
+  static_assert(Cols != dynamic && Rows != dynamic && N > 0,
+                "The size of the images and of the batch must be known at "
+                "compile time");
+  return internal::LeafNode<
+      internal::VisionMemory<
+          true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+          typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+          ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>,
+      0>(internal::VisionMemory<
+      true, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+      typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+      ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>(
+      dt, Cols, Rows, N));
+}
+
+/// \brief creation of the device only memory holding a batch of N images
+template <typename ElemTp, size_t Cols, size_t Rows, size_t N,
+          size_t MemoryType, size_t Sc = scope::Global>
+auto terminal_batch() -> internal::LeafNode<
+    internal::VisionMemory<
+        false, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+        typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+        ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>,
+    0> {
+  static_assert(Cols != dynamic && Rows != dynamic && N > 0,
+                "The size of the images and of the batch must be known at "
+                "compile time");
+  return internal::LeafNode<
+      internal::VisionMemory<
+          false, internal::MemoryProperties<ElemTp>::ElementCategory,
+          MemoryType, typename internal::MemoryProperties<ElemTp>::ChannelType,
+          Cols, Rows, ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize,
+          Sc, 0>,
+      0>(internal::VisionMemory<
+      false, internal::MemoryProperties<ElemTp>::ElementCategory, MemoryType,
+      typename internal::MemoryProperties<ElemTp>::ChannelType, Cols, Rows,
+      ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>(
+      Cols, Rows, N));
+}
+
+namespace internal {
+/// \struct LayoutStorage
+/// \brief LayoutStorage gives the element type and the row size of the memory
+/// of a terminal node of the pixel type ElemTp stored with the Layout.
+/// template parameters:
+/// \tparam ElemTp: the pixel type
+/// \tparam Layout: the layout::Interleaved or layout::Planar
+/// \tparam Rows: the row size of the image
+template <typename ElemTp, typename Layout, size_t Rows>
+struct LayoutStorage;
+
+/// \brief specialisation of the LayoutStorage for the interleaved layout. The
+/// memory is an image of pixels.
+template <typename ElemTp, size_t Rows>
+struct LayoutStorage<ElemTp, layout::Interleaved, Rows> {
+  using Type = ElemTp;
+  static constexpr size_t StorageRows = Rows;
+};
+
+/// \brief specialisation of the LayoutStorage for the planar layout. The
+/// memory is an image of channels with the planes one below the other.
+template <typename ElemTp, size_t Rows>
+struct LayoutStorage<ElemTp, layout::Planar, Rows> {
+  using Type = typename MemoryProperties<ElemTp>::ChannelType;
+  static constexpr size_t StorageRows =
+      Rows * MemoryProperties<ElemTp>::ChannelSize;
+};
+}  // internal
+
+/// \brief template deduction of LeafNode for buffer/host 2d stored with the
+/// given layout. The planar memory of the pixel type ElemTp is a terminal of
+/// its channel type with Rows rows per channel, e.g. a Cols x (3 * Rows)
+/// image of float for pixel::F32C3, which is read as pixels by from_planar.
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          typename Layout,
+          typename StorageT = internal::LayoutStorage<ElemTp, Layout, Rows>>
+auto terminal(typename internal::MemoryProperties<ElemTp>::ChannelType *dt)
+    -> decltype(terminal<typename StorageT::Type, Cols, StorageT::StorageRows,
+                         MemoryType>(dt)) {
+  static_assert(MemoryType != memory_type::Image,
+                "The planar layout is not supported for image memory");
+  return terminal<typename StorageT::Type, Cols, StorageT::StorageRows,
+                  MemoryType>(dt);
+}
+
+/// \brief creation of the device only memory stored with the given layout
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          typename Layout,
+          typename StorageT = internal::LayoutStorage<ElemTp, Layout, Rows>>
+auto terminal() -> decltype(terminal<typename StorageT::Type, Cols,
+                                     StorageT::StorageRows, MemoryType>()) {
+  static_assert(MemoryType != memory_type::Image,
+                "The planar layout is not supported for image memory");
+  return terminal<typename StorageT::Type, Cols, StorageT::StorageRows,
+                  MemoryType>();
+}
+
 /// \brief template deduction of LeafNode where the memory_type is a constant
 /// variable and element_category is Struct
 template <typename ElemTp, size_t LeafType>
@@ -0,0 +1,142 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file lookup.hpp
+/// \brief This file contains the Lookup struct which is used to construct a
+/// point operation reading a table at a location computed from each pixel,
+/// e.g. the look up table of a histogram equalisation.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_LOOKUP_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_LOOKUP_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct Lookup
+/// \brief Lookup applies a point operation to the left-hand side (LHS) which
+/// can read any element of the right-hand side (RHS) table. The table is
+/// always executed before the kernel of the Lookup, so the operation is fused
+/// with the point and neighbour operations of its input and of its parent.
+/// template parameters:
+/// \tparam LUT_OP : the LookupOp applied
+/// \tparam LHS is the input expression
+/// \tparam RHS is the table expression
+/// \tparam Cols: determines the column size of the output
+/// \tparam Rows: determines the row size of the output
+/// \tparam LfType: determines the type of the leafNode {Buffer2D, Buffer1D,
+/// Host, Image}
+/// \tparam LVL: the level of the node in the expression tree
+template <typename LUT_OP, typename LHS, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Lookup {
+ public:
+  static constexpr bool has_out = false;
+  using OutType = typename LUT_OP::OutType;
+  using OPType = LUT_OP;
+  using LHSExpr = LHS;
+  using RHSExpr = RHS;
+  using Type = typename OutputMemory<OutType, LfType, Cols, Rows, LVL>::Type;
+  static constexpr size_t Level = LVL;
+  static constexpr size_t RThread = Rows;
+  static constexpr size_t CThread = Cols;
+  static constexpr size_t ND_Category = expr_category::Binary;
+  static constexpr size_t LeafType = Type::LeafType;
+  /// the input is executed first when its size differs or when it is a
+  /// global neighbour operation
+  static constexpr bool Lookup_Conds =
+      (RThread != LHS::RThread) || (CThread != LHS::CThread) ||
+      (LHS::Operation_type == ops_category::GlobalNeighbourOP);
+  /// the table is replaced by its leaf node before the execution
+  static constexpr bool SubExpressionEvaluationNeeded = true;
+  static constexpr size_t Operation_type = LHS::Operation_type;
+
+  template <typename TmpLHS, typename TmpRHS>
+  using ExprExchange =
+      Lookup<LUT_OP, TmpLHS, TmpRHS, Cols, Rows, LfType, LVL>;
+
+  LHS lhs;
+  RHS rhs;
+  bool subexpr_execution_reseter;
+  Lookup(LHS lhsArg, RHS rhsArg)
+      : lhs(lhsArg), rhs(rhsArg), subexpr_execution_reseter(false) {}
+
+  void reset(bool reset) {
+    lhs.reset(reset);
+    rhs.reset(reset);
+    subexpr_execution_reseter = reset;
+  }
+  /// sub_expression_evaluation
+  /// \brief This function is used to break the expression tree whenever
+  /// necessary. The table is always forced to execute, the input only when
+  /// its size differs.
+  /// template parameters:
+  ///\tparam ForcedToExec : a boolean value representing the decision made by
+  /// the parent of this node for launching a kernel.
+  /// \tparam LC: is the column size of local memory
+  /// \tparam LR: is the row size of local memory
+  /// \tparam LCT: is the column size of workgroup
+  /// \tparam LRT: is the row size of workgroup
+  /// \tparam DeviceT: type representing the device
+  /// function parameters:
+  /// \param dev : the selected device for executing the expression
+  /// \return LeafNode
+  template <bool ForcedToExec, size_t LC, size_t LR, size_t LCT, size_t LRT,
+            typename DeviceT>
+  auto inline sub_expression_evaluation(const DeviceT &dev)
+      -> decltype(execute_expr<false, ForcedToExec, ExprExchange<LHS, RHS>, LC,
+                               LR, LCT, LRT>(
+          lhs.template sub_expression_evaluation<Lookup_Conds, LC, LR, LCT,
+                                                 LRT>(dev),
+          rhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+          dev)) {
+    return execute_expr<false, ForcedToExec, ExprExchange<LHS, RHS>, LC, LR,
+                        LCT, LRT>(
+        lhs.template sub_expression_evaluation<Lookup_Conds, LC, LR, LCT, LRT>(
+            dev),
+        rhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+        dev);
+  }
+};
+}  // internal
+
+/// function lookup_operation
+/// \brief template deduction for Lookup. The output has the size of the
+/// input. The functor OP is called for each pixel of the input as
+/// OP()(pixel, table, col, row) and reads the table with table.at(c, r).
+/// template parameters:
+/// \tparam OP: the look up functor
+/// \tparam LHS: the type of the input expression
+/// \tparam RHS: the type of the table expression
+/// function parameters:
+/// \param lhs : the input expression
+/// \param table : the table expression, e.g. a histogram
+/// \return Lookup
+template <typename OP, typename LHS, typename RHS>
+auto lookup_operation(LHS lhs, RHS table) -> internal::Lookup<
+    internal::LookupOp<OP, typename LHS::OutType, typename RHS::OutType>, LHS,
+    RHS, LHS::Type::Cols, LHS::Type::Rows, LHS::Type::LeafType,
+    1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                  RHS>::Type::Level> {
+  return internal::Lookup<
+      internal::LookupOp<OP, typename LHS::OutType, typename RHS::OutType>,
+      LHS, RHS, LHS::Type::Cols, LHS::Type::Rows, LHS::Type::LeafType,
+      1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                    RHS>::Type::Level>(lhs, table);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_LOOKUP_HPP_
@@ -49,6 +49,11 @@ template <typename LHS, typename RHS, size_t Cols, size_t Rows,
           size_t OffsetColIn, size_t OffsetRowIn, size_t OffsetColOut,
           size_t OffsetRowOut, size_t LfType, size_t LVL>
 struct ParallelCopy {
+  static_assert(Cols != dynamic && Rows != dynamic &&
+                    LHS::Type::Cols != dynamic && LHS::Type::Rows != dynamic &&
+                    RHS::Type::Cols != dynamic && RHS::Type::Rows != dynamic,
+                "The partial assign node requires compile time Cols and Rows "
+                "for both its input and output");
   static constexpr bool has_out = true;
   using OutType = typename LHS::OutType;
   using Type = typename LHS::Type;
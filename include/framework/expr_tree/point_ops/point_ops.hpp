@@ -25,8 +25,12 @@
 #define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_POINT_OPS_HPP_
 
 #include "assign.hpp"
+#include "layout.hpp"
 #include "leaf_node.hpp"
+#include "lookup.hpp"
 #include "parallel_copy.hpp"
 #include "resizable_binary.hpp"
 #include "resizable_unary.hpp"
+#include "resize.hpp"
+#include "warp.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_POINT_OPS_HPP_
\ No newline at end of file
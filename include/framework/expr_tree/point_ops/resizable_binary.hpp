@@ -31,7 +31,9 @@ namespace internal {
 /// \brief This struct is used to extract the output type of the binary
 /// operation from both input. This is useful when one of the operands passed is
 /// a constant variable and the other one is a buffer. This inheritance allows to
-/// swap the place of the constant variable in the node construction
+/// swap the place of the constant variable in the node construction. A 1x1
+/// image, e.g. the result of a reduce, is read at every pixel of the other
+/// operand, so it is inherited the same way as a constant variable.
 /// template parameters
 /// \tparam LHSExpr left hand side expression
 /// \tparam RHSExpr right hand side expression
@@ -39,9 +41,11 @@ template <typename LHSExpr, typename RHSExpr>
 struct InheritTypeBinary {
   using LHSTypeDetector = typename LHSExpr::Type;
   using RHSTypeDetector = typename RHSExpr::Type;
-  using Type =
-      typename tools::StaticIf<LHSTypeDetector::LeafType != memory_type::Const,
-                               LHSTypeDetector, RHSTypeDetector>::Type;
+  static constexpr bool LHSIsScalar =
+      LHSTypeDetector::LeafType == memory_type::Const ||
+      (LHSTypeDetector::Cols == 1 && LHSTypeDetector::Rows == 1);
+  using Type = typename tools::StaticIf<!LHSIsScalar, LHSTypeDetector,
+                                        RHSTypeDetector>::Type;
 };
 
 /// \struct OpTP
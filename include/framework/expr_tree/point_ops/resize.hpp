@@ -0,0 +1,127 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file resize.hpp
+/// \brief This file contains the Resize struct which is used to construct a
+/// point operation sampling its input at any scale.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_RESIZE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_RESIZE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct Resize
+/// \brief Resize samples the right-hand side (RHS) at the position of each
+/// output pixel. The input is always executed before the kernel of the
+/// Resize, unless it is a terminal node, and it is read from global memory.
+/// The output is computed for each pixel as a point operation, so it is fused
+/// with the point and neighbour operations of its parent. It is also used by
+/// the conversions between the interleaved and the planar layouts, which
+/// gather each output pixel from the input in the same way.
+/// template parameters:
+/// \tparam RSZ_OP : the ResizeOp applied
+/// \tparam RHS is the input expression
+/// \tparam Cols: determines the column size of the output
+/// \tparam Rows: determines the row size of the output
+/// \tparam LfType: determines the type of the leafNode {Buffer2D, Buffer1D,
+/// Host, Image}
+/// \tparam LVL: the level of the node in the expression tree
+template <typename RSZ_OP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct Resize {
+ public:
+  static_assert(RHS::Type::Cols != dynamic && RHS::Type::Rows != dynamic,
+                "The resize node requires compile time Cols and Rows");
+  static constexpr bool has_out = false;
+  using OutType = typename RSZ_OP::OutType;
+  using OPType = RSZ_OP;
+  using RHSExpr = RHS;
+  using Type = typename OutputMemory<OutType, LfType, Cols, Rows, LVL>::Type;
+  static constexpr size_t Level = LVL;
+  static constexpr size_t RThread = Rows;
+  static constexpr size_t CThread = Cols;
+  static constexpr size_t ND_Category = expr_category::Unary;
+  static constexpr size_t LeafType = Type::LeafType;
+  /// the input is replaced by its leaf node before the execution
+  static constexpr bool SubExpressionEvaluationNeeded = true;
+  static constexpr size_t Operation_type = ops_category::PointOP;
+
+  template <typename TmpRHS>
+  using ExprExchange = Resize<RSZ_OP, TmpRHS, Cols, Rows, LfType, LVL>;
+
+  RHS rhs;
+  bool subexpr_execution_reseter;
+  Resize(RHS rhsArg) : rhs(rhsArg), subexpr_execution_reseter(false) {}
+
+  void reset(bool reset) {
+    rhs.reset(reset);
+    subexpr_execution_reseter = reset;
+  }
+  /// sub_expression_evaluation
+  /// \brief This function is used to break the expression tree whenever
+  /// necessary. The input is always forced to execute.
+  /// template parameters:
+  ///\tparam ForcedToExec : a boolean value representing the decision made by
+  /// the parent of this node for launching a kernel.
+  /// \tparam LC: is the column size of local memory
+  /// \tparam LR: is the row size of local memory
+  /// \tparam LCT: is the column size of workgroup
+  /// \tparam LRT: is the row size of workgroup
+  /// \tparam DeviceT: type representing the device
+  /// function parameters:
+  /// \param dev : the selected device for executing the expression
+  /// \return LeafNode
+  template <bool ForcedToExec, size_t LC, size_t LR, size_t LCT, size_t LRT,
+            typename DeviceT>
+  auto inline sub_expression_evaluation(const DeviceT &dev)
+      -> decltype(execute_expr<false, ForcedToExec, ExprExchange<RHS>, LC, LR,
+                               LCT, LRT>(
+          rhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+          dev)) {
+    return execute_expr<false, ForcedToExec, ExprExchange<RHS>, LC, LR, LCT,
+                        LRT>(
+        rhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+        dev);
+  }
+};
+}  // internal
+
+/// function resize
+/// \brief template deduction for Resize. The output has the pixel type of the
+/// input and any size, e.g. a 1920x1080 frame is scaled on the device with
+/// resize<640, 480>(in). The unsigned char pixels are rounded and saturated.
+/// template parameters:
+/// \tparam Cols: the column size of the output
+/// \tparam Rows: the row size of the output
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+/// \tparam RHS: the type of the input expression
+/// function parameters:
+/// \param rhs : the input expression
+/// \return Resize
+template <size_t Cols, size_t Rows, typename Interp = interpolation::Bilinear,
+          typename RHS>
+auto resize(RHS rhs) -> internal::Resize<
+    internal::ResizeOp<OP_Resize<Interp>, typename RHS::OutType>, RHS, Cols,
+    Rows, RHS::Type::LeafType, 1 + RHS::Level> {
+  return internal::Resize<
+      internal::ResizeOp<OP_Resize<Interp>, typename RHS::OutType>, RHS, Cols,
+      Rows, RHS::Type::LeafType, 1 + RHS::Level>(rhs);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_RESIZE_HPP_
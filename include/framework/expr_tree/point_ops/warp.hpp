@@ -0,0 +1,198 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file warp.hpp
+/// \brief This file contains the Warp struct which is used to construct the
+/// geometric transforms of an image, and the deduction functions of the
+/// affine warp, the perspective warp and the remap.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_WARP_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_WARP_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct Warp
+/// \brief Warp samples the left-hand side (LHS) at the position of each output
+/// pixel given by a transform, the right-hand side (RHS). The input is always
+/// executed before the kernel of the Warp, unless it is a terminal node, and
+/// it is read from global memory. The transform is a terminal node of the
+/// constant scope. The output is computed for each pixel as a point operation,
+/// so it is fused with the point and neighbour operations of its parent.
+/// template parameters:
+/// \tparam WARP_OP : the WarpOp applied
+/// \tparam LHS is the input expression
+/// \tparam RHS is the transform
+/// \tparam Cols: determines the column size of the output
+/// \tparam Rows: determines the row size of the output
+/// \tparam LfType: determines the type of the leafNode {Buffer2D, Buffer1D,
+/// Host, Image}
+/// \tparam LVL: the level of the node in the expression tree
+template <typename WARP_OP, typename LHS, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Warp {
+ public:
+  static_assert(LHS::Type::Cols != dynamic && LHS::Type::Rows != dynamic,
+                "The warp node requires compile time Cols and Rows");
+  static constexpr bool has_out = false;
+  using OutType = typename WARP_OP::OutType;
+  using OPType = WARP_OP;
+  using LHSExpr = LHS;
+  using RHSExpr = RHS;
+  using Type = typename OutputMemory<OutType, LfType, Cols, Rows, LVL>::Type;
+  static constexpr size_t Level = LVL;
+  static constexpr size_t RThread = Rows;
+  static constexpr size_t CThread = Cols;
+  static constexpr size_t ND_Category = expr_category::Binary;
+  static constexpr size_t LeafType = Type::LeafType;
+  /// the input is replaced by its leaf node before the execution
+  static constexpr bool SubExpressionEvaluationNeeded = true;
+  static constexpr size_t Operation_type = ops_category::PointOP;
+
+  template <typename TmpLHS, typename TmpRHS>
+  using ExprExchange = Warp<WARP_OP, TmpLHS, TmpRHS, Cols, Rows, LfType, LVL>;
+
+  LHS lhs;
+  RHS rhs;
+  bool subexpr_execution_reseter;
+  Warp(LHS lhsArg, RHS rhsArg)
+      : lhs(lhsArg), rhs(rhsArg), subexpr_execution_reseter(false) {}
+
+  void reset(bool reset) {
+    lhs.reset(reset);
+    rhs.reset(reset);
+    subexpr_execution_reseter = reset;
+  }
+  /// sub_expression_evaluation
+  /// \brief This function is used to break the expression tree whenever
+  /// necessary. The input is always forced to execute.
+  /// template parameters:
+  ///\tparam ForcedToExec : a boolean value representing the decision made by
+  /// the parent of this node for launching a kernel.
+  /// \tparam LC: is the column size of local memory
+  /// \tparam LR: is the row size of local memory
+  /// \tparam LCT: is the column size of workgroup
+  /// \tparam LRT: is the row size of workgroup
+  /// \tparam DeviceT: type representing the device
+  /// function parameters:
+  /// \param dev : the selected device for executing the expression
+  /// \return LeafNode
+  template <bool ForcedToExec, size_t LC, size_t LR, size_t LCT, size_t LRT,
+            typename DeviceT>
+  auto inline sub_expression_evaluation(const DeviceT &dev)
+      -> decltype(execute_expr<false, ForcedToExec, ExprExchange<LHS, RHS>, LC,
+                               LR, LCT, LRT>(
+          lhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+          rhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+          dev)) {
+    return execute_expr<false, ForcedToExec, ExprExchange<LHS, RHS>, LC, LR,
+                        LCT, LRT>(
+        lhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+        rhs.template sub_expression_evaluation<true, LC, LR, LCT, LRT>(dev),
+        dev);
+  }
+};
+}  // internal
+
+/// function warp_affine
+/// \brief template deduction for the affine warp of an image. The transform
+/// is a terminal of 6 floats in the constant scope holding the 2x3 matrix, in
+/// row major order, which maps each output pixel to its position in the input
+/// (the inverse of the matrix given to cv::warpAffine). The pixels outside of
+/// the input are zero.
+/// template parameters:
+/// \tparam Cols: the column size of the output
+/// \tparam Rows: the row size of the output
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+/// \tparam LHS: the type of the input expression
+/// \tparam RHS: the type of the transform
+/// function parameters:
+/// \param lhs : the input expression
+/// \param transform : the transform
+/// \return Warp
+template <size_t Cols, size_t Rows, typename Interp = interpolation::Bilinear,
+          typename LHS, typename RHS>
+auto warp_affine(LHS lhs, RHS transform) -> internal::Warp<
+    internal::WarpOp<OP_WarpAffine<Interp>, typename LHS::OutType,
+                     typename RHS::OutType>,
+    LHS, RHS, Cols, Rows, LHS::Type::LeafType,
+    1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                  RHS>::Type::Level> {
+  return internal::Warp<
+      internal::WarpOp<OP_WarpAffine<Interp>, typename LHS::OutType,
+                       typename RHS::OutType>,
+      LHS, RHS, Cols, Rows, LHS::Type::LeafType,
+      1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                    RHS>::Type::Level>(lhs, transform);
+}
+
+/// function warp_perspective
+/// \brief template deduction for the perspective warp of an image. The
+/// transform is a terminal of 9 floats in the constant scope holding the 3x3
+/// homography, in row major order, which maps each output pixel to its
+/// position in the input (the inverse of the matrix given to
+/// cv::warpPerspective). The pixels outside of the input are zero.
+/// template parameters:
+/// \tparam Cols: the column size of the output
+/// \tparam Rows: the row size of the output
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+/// \tparam LHS: the type of the input expression
+/// \tparam RHS: the type of the transform
+/// function parameters:
+/// \param lhs : the input expression
+/// \param transform : the transform
+/// \return Warp
+template <size_t Cols, size_t Rows, typename Interp = interpolation::Bilinear,
+          typename LHS, typename RHS>
+auto warp_perspective(LHS lhs, RHS transform) -> internal::Warp<
+    internal::WarpOp<OP_WarpPerspective<Interp>, typename LHS::OutType,
+                     typename RHS::OutType>,
+    LHS, RHS, Cols, Rows, LHS::Type::LeafType,
+    1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                  RHS>::Type::Level> {
+  return internal::Warp<
+      internal::WarpOp<OP_WarpPerspective<Interp>, typename LHS::OutType,
+                       typename RHS::OutType>,
+      LHS, RHS, Cols, Rows, LHS::Type::LeafType,
+      1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                    RHS>::Type::Level>(lhs, transform);
+}
+
+/// function remap
+/// \brief template deduction for the remap of an image. The map is a
+/// pixel::F32C2 expression of the size of the output giving the column and row
+/// in the input of each output pixel, e.g. the undistortion map of a camera.
+/// The map is usually a terminal created once and reused for each frame, so
+/// it is only uploaded once. It is read as a point operation, and the input is
+/// read from global memory. The pixels outside of the input are zero.
+/// template parameters:
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+/// \tparam LHS: the type of the input expression
+/// \tparam RHS: the type of the map expression
+/// function parameters:
+/// \param lhs : the input expression
+/// \param map : the map
+/// \return Lookup
+template <typename Interp = interpolation::Bilinear, typename LHS,
+          typename RHS>
+auto remap(LHS lhs, RHS map)
+    -> decltype(lookup_operation<OP_Remap<Interp>>(map, lhs)) {
+  return lookup_operation<OP_Remap<Interp>>(map, lhs);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_WARP_HPP_
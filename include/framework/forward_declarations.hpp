@@ -43,17 +43,83 @@ static constexpr size_t Image = 3;
 static constexpr size_t Const = 4;
 }
 
+/// \brief dynamic can be used instead of the Cols or Rows template parameter
+/// of a terminal node when the extent of the image is only known at runtime.
+/// The runtime extent is passed to the terminal node constructor and it is
+/// propagated to all the nodes depending on it.
+static constexpr size_t dynamic = 0;
+
 /// \brief defines Executor policies available
 namespace policy {
 constexpr static bool Fuse = true;
 constexpr static bool NoFuse = false;
 }
 
+/// \brief defines the border policies of the neighbour operations. A border
+/// policy decides which pixel is read by a neighbour operation outside of its
+/// input. It is passed as an optional type after the integral template
+/// parameters of neighbour_operation, e.g.
+/// neighbour_operation<OP_Filter2D, border::Reflect101>(in, filter).
+/// With policy::Fuse, a neighbour operation fused with a neighbour operation
+/// below it applies its border policy to the leaves of the fused kernel, not
+/// to the result of the operation below, so the pixels close to the border
+/// of the image differ from policy::NoFuse. A neighbour operation whose
+/// border must apply to its input is given a scheduled input.
+/// The examples show the pixels read on each side of the row abcdefgh.
+namespace border {
+/// \brief the pixels outside of the image are zero: 000|abcdefgh|000
+struct Constant {};
+/// \brief the first and last pixels are repeated: aaa|abcdefgh|hhh
+struct Replicate {};
+/// \brief the image is mirrored including the border: cba|abcdefgh|hgf
+struct Reflect {};
+/// \brief the image is mirrored excluding the border: dcb|abcdefgh|gfe
+struct Reflect101 {};
+/// \brief the image is repeated: fgh|abcdefgh|abc
+struct Wrap {};
+/// \brief the border of an integral image: the pixels before the image are zero
+/// and the last pixels are repeated after it: 000|abcdefgh|hhh. It is the
+/// integral image of the input padded with zeros, used by box_sum.
+struct Integral {};
+}
+
+/// \brief defines the layouts of the channels of a multi-channel terminal
+/// node. It is passed after the memory_type to terminal, e.g.
+/// terminal<pixel::F32C3, Cols, Rows, memory_type::Buffer2D, layout::Planar>.
+namespace layout {
+/// \brief the channels of a pixel are stored together: RGBRGBRGB
+struct Interleaved {};
+/// \brief each channel is stored in its own plane, the planes one after the
+/// other: RRR GGG BBB. The memory is an image of the channel type with one row
+/// of planes per channel, which is read as pixels by from_planar and written
+/// by to_planar.
+struct Planar {};
+}
+
+/// \brief the alignment in bytes of the host memory shared with the device by
+/// a terminal created with use_host_ptr. The OpenCL drivers of the cpu and of
+/// the integrated gpus only use the host memory in place when it is aligned on
+/// a page.
+static constexpr size_t host_ptr_alignment = 4096;
+
+/// \struct use_host_ptr_t
+/// \brief tag type of use_host_ptr
+struct use_host_ptr_t {};
+/// \brief passed after the host pointer to terminal to share the host memory
+/// with the device instead of copying it, e.g.
+/// terminal<pixel::U8C3, Cols, Rows, memory_type::Buffer2D>(ptr, use_host_ptr).
+/// The pointer must be aligned on host_ptr_alignment bytes, e.g. allocated by
+/// aligned_allocator.
+static constexpr use_host_ptr_t use_host_ptr{};
+
 /// \class backend
 /// \brief enum class that defines supported backends.
 enum class backend {
   /// represents sycl backend.
   sycl,
+  /// represents the native backend executing on the host cpu through a pool
+  /// of std::thread.
+  native,
   /// number of backends.
   size
 };
@@ -91,6 +157,20 @@ internal::Device_<BK, DV> make_device() {
   return internal::Device_<BK, DV>();
 }
 
+/// \brief the definition is in \ref profiler
+class profiler;
+
+/// \brief template deduction function for Device_ class recording each
+/// executed kernel in the profiler
+/// \tparam BK is used to determine the backend
+/// \tparam  DV is used to determine the selected device for that backend
+/// \param prof the profiler recording the kernels. It must outlive the device
+/// \return Device_
+template <backend BK, device DV>
+internal::Device_<BK, DV> make_device(profiler &prof) {
+  return internal::Device_<BK, DV>(prof);
+}
+
 template <bool ExecPolicy, typename Expr, typename DeviceT>
 void execute(Expr &, DeviceT &);
 
@@ -116,7 +196,7 @@ constexpr static size_t GlobalNeighbourOP = 2;
 
 /// \brief the definition is in \ref VirtualMemory
 template <bool PlcType, typename Node, size_t LC = 8, size_t LR = 8,
-          size_t LCT = 8, size_t LRT = 8>
+          size_t LCT = 8, size_t LRT = 8, typename StorageT = void>
 struct VirtualMemory;
 
 /// \brief the definition is in \ref LeafNode.
@@ -149,6 +229,59 @@ struct StnNoFilt;
 template <typename DownSmplOP, typename RHS, size_t Cols, size_t Rows,
           size_t LfType, size_t LVL>
 struct RDCN;
+
+/// \brief The definition is in \ref Scan file.
+template <size_t ScanDim, typename InTp>
+struct ScanOp;
+
+/// \brief The definition is in \ref Scan file.
+template <typename ScanOP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct Scan;
+
+/// \brief The definition is in \ref Reduce file.
+template <typename USROP, typename InTp, size_t InPixels>
+struct ReduceOp;
+
+/// \brief the two kernels of a whole image reduction. The Partial stage
+/// reduces the image to a few thousand partial values and the Final stage
+/// combines them into a single pixel.
+namespace reduce_stage {
+static constexpr size_t Partial = 0;
+static constexpr size_t Final = 1;
+}
+
+/// \brief The definition is in \ref Reduce file.
+template <typename ReduceOP, size_t Stage, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Reduce;
+
+/// \brief The definition is in \ref Histogram file.
+template <size_t BinCount, size_t TilesC, size_t TilesR, typename InTp,
+          size_t InCols, size_t InRows>
+struct HistogramOp;
+
+/// \brief The definition is in \ref Histogram file. It has the same
+/// reduce_stage kernels as the Reduce.
+template <typename HistOP, size_t Stage, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Histogram;
+
+/// \brief The definition is in \ref Lookup file.
+template <typename LUT_OP, typename LHS, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Lookup;
+
+/// \brief The definition is in \ref Resize file.
+template <typename RSZ_OP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct Resize;
+
+/// \brief The definition is in \ref Warp file.
+template <typename WARP_OP, typename LHS, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct Warp;
+
 /// \brief The definition is in \ref ParallelCopy file.
 template <typename LHS, typename RHS, size_t Cols, size_t Rows,
           size_t OffsetColIn, size_t OffsetRowIn, size_t OffsetColOut,
@@ -165,6 +298,48 @@ template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t LVL,
           typename Expr,typename DeviceT>
 struct SubExprRes;
 
+/// \brief The definition is in \ref RuntimeExtent file.
+template <size_t Category, typename Expr>
+struct RuntimeExtent;
+
+template <typename Expr>
+size_t runtime_cols(const Expr &);
+
+template <typename Expr>
+size_t runtime_rows(const Expr &);
+
+template <typename Expr>
+size_t runtime_batch(const Expr &);
+
+/// \brief The definition is in \ref intermediate_memory.hpp file.
+template <typename DeviceT>
+struct IntermediateMemory;
+
+template <typename LeafT, typename DeviceT>
+LeafT make_intermediate(const DeviceT &, size_t, size_t);
+
+template <typename DeviceT, typename LeafT>
+void release_intermediate(const DeviceT &, const LeafT &);
+
+template <typename DeviceT>
+class IntermediateScope;
+
+/// \brief The definition is in \ref batch_device.hpp file.
+template <typename DeviceT>
+class BatchDevice;
+
+struct SubtreeKey;
+
+template <typename Expr>
+SubtreeKey make_subtree_key(const Expr &);
+
+template <typename LeafT, typename DeviceT>
+std::shared_ptr<typename LeafT::RHSExpr> find_common(const DeviceT &,
+                                                     const SubtreeKey &);
+
+template <typename DeviceT, typename LeafT>
+void keep_common(const DeviceT &, const SubtreeKey &, const LeafT &);
+
 template <size_t LC, size_t LR, size_t LCT, size_t LRT, typename Expr,
           typename DeviceT>
 void fuse(Expr, const DeviceT &);
@@ -41,6 +41,9 @@
 // Evaluation tree headers
 #include "evaluator/evaluator.hpp"
 
+// completion handle of the asynchronous execution
+#include "executor/event.hpp"
+
 // Executor Policies
 #include "executor/executor.hpp"
 
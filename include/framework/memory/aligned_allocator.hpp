@@ -0,0 +1,100 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file aligned_allocator.hpp
+/// \brief This file contains the aligned_allocator used to allocate the host
+/// memories shared with the device by the terminals created with use_host_ptr.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_ALIGNED_ALLOCATOR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_ALIGNED_ALLOCATOR_HPP_
+
+#include <cstdint>
+#include <new>
+
+namespace visioncpp {
+/// \class aligned_allocator
+/// \brief aligned_allocator is a standard allocator returning memory aligned
+/// on Alignment bytes. The frames allocated with it, e.g.
+/// std::vector<unsigned char, aligned_allocator<unsigned char>>, can be given
+/// to a terminal with use_host_ptr, so the host and the device share the same
+/// bytes.
+/// template parameters:
+/// \tparam T: the type of the elements
+/// \tparam Alignment: the alignment in bytes, a power of two
+template <typename T, size_t Alignment = host_ptr_alignment>
+class aligned_allocator {
+  static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0,
+                "The alignment must be a power of two");
+  static_assert(Alignment >= sizeof(void *),
+                "The alignment must hold a pointer");
+
+ public:
+  using value_type = T;
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  aligned_allocator() noexcept {}
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+  /// \brief allocates n elements. The address of the block returned by
+  /// operator new is stored just before the aligned memory.
+  /// \param n: the number of elements
+  /// \return T*
+  T *allocate(size_t n) {
+    void *block = ::operator new(n * sizeof(T) + Alignment + sizeof(void *));
+    std::uintptr_t aligned =
+        (reinterpret_cast<std::uintptr_t>(block) + sizeof(void *) +
+         Alignment - 1) &
+        ~static_cast<std::uintptr_t>(Alignment - 1);
+    reinterpret_cast<void **>(aligned)[-1] = block;
+    return reinterpret_cast<T *>(aligned);
+  }
+
+  /// \brief deallocates the memory returned by allocate
+  /// \param p: the aligned memory
+  void deallocate(T *p, size_t) noexcept {
+    ::operator delete(reinterpret_cast<void **>(p)[-1]);
+  }
+};
+
+template <typename T, typename U, size_t Alignment>
+bool operator==(const aligned_allocator<T, Alignment> &,
+                const aligned_allocator<U, Alignment> &) {
+  return true;
+}
+
+template <typename T, typename U, size_t Alignment>
+bool operator!=(const aligned_allocator<T, Alignment> &,
+                const aligned_allocator<U, Alignment> &) {
+  return false;
+}
+
+/// function is_host_ptr_aligned
+/// \brief checks whether a host pointer can be shared with the device by a
+/// terminal created with use_host_ptr
+/// \param ptr: the host pointer
+/// \return bool
+inline bool is_host_ptr_aligned(const void *ptr) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % host_ptr_alignment == 0;
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_ALIGNED_ALLOCATOR_HPP_
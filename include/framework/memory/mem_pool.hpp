@@ -0,0 +1,338 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file mem_pool.hpp
+/// \brief This file contains the BufferPool which is used to recycle the
+/// intermediate memories created when an expression is broken into several
+/// kernels, and to share the result of the common subexpressions.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_POOL_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_POOL_HPP_
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <typeindex>
+#include <vector>
+
+namespace visioncpp {
+namespace internal {
+/// \struct SubtreeKey
+/// \brief SubtreeKey identifies the result of a subexpression. Two
+/// subexpressions compute the same result when they have the same type and
+/// read the same leaf buffers. The key is not valid when one of the leaves
+/// cannot be identified (e.g. a pyramid), in which case the result is never
+/// shared.
+struct SubtreeKey {
+  std::type_index type;
+  std::vector<const void *> leaves;
+  bool valid;
+  SubtreeKey(std::type_index type) : type(type), valid(true) {}
+  bool operator==(const SubtreeKey &other) const {
+    return valid && other.valid && type == other.type &&
+           leaves == other.leaves;
+  }
+};
+
+/// \class BufferPool
+/// \brief BufferPool keeps the sycl buffers of the intermediate memories. A
+/// buffer is keyed on its sycl buffer type (element type and dimension), its
+/// memory type, its runtime size and its number of images, so it can be reused
+/// by any node of the expression tree producing the same kind of output
+/// regardless of its level.
+/// A buffer is handed out by acquire and becomes available again once it has
+/// been released, which happens as soon as all of its consumers have been
+/// executed. The pool also remembers which buffer holds the result of each
+/// subexpression executed so far. Such a buffer is kept alive until the end of
+/// the execution, so an identical subexpression met later reads it instead of
+/// being executed again.
+/// Each execution opens a scope which owns the buffers acquired by its thread
+/// until the scope is closed, so two executions sharing the pool from
+/// different threads never release the buffers of each other. The free
+/// buffers are kept up to a capacity in bytes, beyond which the least recently
+/// used ones are destroyed, so the buffers of sizes which are no longer
+/// requested do not stay alive with the pool.
+class BufferPool {
+  /// \brief holds one buffer of the pool and the key it has been created for
+  struct Entry {
+    std::type_index type;
+    size_t leaf_type;
+    size_t cols;
+    size_t rows;
+    size_t batch;
+    size_t bytes;
+    std::shared_ptr<void> buffer;
+    bool in_use;
+    /// the scope owning the buffer while it is in use, 0 for none
+    size_t owner;
+    /// the acquisition count when the buffer was last acquired
+    size_t last_use;
+  };
+  /// \brief holds the memory containing the result of a subexpression
+  struct Common {
+    SubtreeKey key;
+    std::type_index type;
+    std::shared_ptr<void> memory;
+    const void *buffer;
+  };
+  std::vector<Entry> entries;
+  std::vector<Common> commons;
+  /// \brief the stack of the scopes opened by each thread, the innermost one
+  /// owns the buffers acquired by the thread
+  std::map<std::thread::id, std::vector<size_t>> scopes;
+  /// \brief the identifier of the next scope
+  size_t next_scope;
+  /// \brief counts the acquired buffers. It is used to find the least
+  /// recently used free buffer.
+  size_t clock;
+  /// \brief the number of bytes of free buffers kept by the pool
+  size_t capacity;
+  mutable std::mutex mutex;
+
+ public:
+  /// \brief the default number of bytes of free buffers kept by the pool
+  static constexpr size_t default_capacity = size_t(256) << 20;
+
+  BufferPool() : next_scope(1), clock(0), capacity(default_capacity) {}
+  BufferPool(const BufferPool &) = delete;
+  BufferPool &operator=(const BufferPool &) = delete;
+
+  /// \brief returns a LeafNode whose memory is a free buffer of the pool. A
+  /// new buffer is created when there is no free buffer with the same key.
+  /// template parameters:
+  /// \tparam LeafT : the type of the LeafNode representing the memory
+  /// function parameters:
+  /// \param cols : the runtime column size of the memory
+  /// \param rows : the runtime row size of the memory
+  /// \param batch : the number of images of the memory
+  /// \return LeafT
+  template <typename LeafT>
+  LeafT acquire(size_t cols, size_t rows, size_t batch = 1) {
+    using Memory = typename LeafT::RHSExpr;
+    using Buffer = typename Memory::syclBuffer;
+    const std::type_index type(typeid(Buffer));
+    cols = (Memory::Cols != dynamic) ? Memory::Cols : cols;
+    rows = (Memory::Rows != dynamic) ? Memory::Rows : rows;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &entry : entries) {
+      if (!entry.in_use && entry.type == type &&
+          entry.leaf_type == Memory::LeafType && entry.cols == cols &&
+          entry.rows == rows && entry.batch == batch) {
+        entry.in_use = true;
+        entry.owner = current_scope();
+        entry.last_use = clock++;
+        return LeafT(Memory(std::static_pointer_cast<Buffer>(entry.buffer),
+                            cols, rows, batch));
+      }
+    }
+    Memory memory(cols, rows, batch);
+    entries.push_back(Entry{
+        type, Memory::LeafType, cols, rows, batch,
+        cols * rows * batch * sizeof(typename Memory::ElementType),
+        memory.syclData, true, current_scope(), clock++});
+    return LeafT(memory);
+  }
+
+  /// \brief gives the buffer of the LeafNode back to the pool. Nothing happens
+  /// when the buffer does not belong to the pool (e.g. a user terminal node).
+  /// \param leaf : the LeafNode whose buffer is released
+  /// \return void
+  template <bool MapAllocator, size_t ScalarType, size_t MemoryType,
+            typename Sclr, size_t Col, size_t Row, typename ElementTp,
+            size_t Elements, size_t Sc, size_t LVL, size_t LeafLVL>
+  void release(const LeafNode<VisionMemory<MapAllocator, ScalarType, MemoryType,
+                                           Sclr, Col, Row, ElementTp, Elements,
+                                           Sc, LVL>,
+                              LeafLVL> &leaf) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const void *buffer = leaf.vilibMemory.syclData.get();
+    for (auto &common : commons) {
+      if (common.buffer == buffer) {
+        /// the buffer is shared by another consumer
+        return;
+      }
+    }
+    for (auto &entry : entries) {
+      if (entry.buffer.get() == buffer) {
+        entry.in_use = false;
+        entry.owner = 0;
+        forget(buffer);
+      }
+    }
+    evict();
+  }
+  /// \brief the LeafNodes which are not backed by a sycl buffer (e.g. a
+  /// constant) never belong to the pool.
+  template <typename LeafT>
+  void release(const LeafT &) {}
+
+  /// \brief opens a scope on the calling thread. The buffers acquired by the
+  /// thread belong to it until it is closed or a nested scope is opened.
+  /// \return size_t : the identifier of the scope
+  size_t open_scope() {
+    std::lock_guard<std::mutex> lock(mutex);
+    const size_t id = next_scope++;
+    scopes[std::this_thread::get_id()].push_back(id);
+    return id;
+  }
+
+  /// \brief closes the scope opened by open_scope on the calling thread and
+  /// gives back to the pool all the buffers it owns
+  /// \param id : the identifier returned by open_scope
+  /// \return void
+  void close_scope(size_t id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto stack = scopes.find(std::this_thread::get_id());
+    if (stack != scopes.end()) {
+      stack->second.erase(
+          std::remove(stack->second.begin(), stack->second.end(), id),
+          stack->second.end());
+      if (stack->second.empty()) {
+        scopes.erase(stack);
+      }
+    }
+    for (auto &entry : entries) {
+      if (entry.in_use && entry.owner == id) {
+        entry.in_use = false;
+        entry.owner = 0;
+        forget(entry.buffer.get());
+      }
+    }
+    evict();
+  }
+
+  /// \brief sets the number of bytes of free buffers kept by the pool and
+  /// destroys the least recently used free buffers beyond it
+  /// \param bytes : the capacity in bytes
+  /// \return void
+  void set_capacity(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    capacity = bytes;
+    evict();
+  }
+
+  /// \brief returns the memory holding the result of the subexpression
+  /// identified by the key, or nullptr when it has not been executed yet.
+  /// template parameters:
+  /// \tparam Memory : the type of the memory holding the result
+  /// function parameters:
+  /// \param key : the key of the subexpression
+  /// \return std::shared_ptr<Memory>
+  template <typename Memory>
+  std::shared_ptr<Memory> find_common(const SubtreeKey &key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &common : commons) {
+      if (common.key == key && common.type == std::type_index(typeid(Memory))) {
+        return std::static_pointer_cast<Memory>(common.memory);
+      }
+    }
+    return nullptr;
+  }
+
+  /// \brief remembers that the memory holds the result of the subexpression
+  /// identified by the key. Nothing happens when the key is not valid or the
+  /// memory does not belong to the pool.
+  /// template parameters:
+  /// \tparam Memory : the type of the memory holding the result
+  /// function parameters:
+  /// \param key : the key of the subexpression
+  /// \param memory : the memory holding the result of the subexpression
+  /// \return void
+  template <typename Memory>
+  void keep_common(const SubtreeKey &key, const Memory &memory) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!key.valid) {
+      return;
+    }
+    for (auto &entry : entries) {
+      if (entry.in_use && entry.buffer == memory.syclData) {
+        commons.push_back(Common{key, std::type_index(typeid(Memory)),
+                                 std::make_shared<Memory>(memory),
+                                 memory.syclData.get()});
+        return;
+      }
+    }
+  }
+
+  /// \brief destroys all the free buffers of the pool
+  /// \return void
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Entry> used;
+    for (auto &entry : entries) {
+      if (entry.in_use) {
+        used.push_back(entry);
+      }
+    }
+    entries.swap(used);
+  }
+
+  /// \brief returns the number of buffers owned by the pool
+  /// \return size_t
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+  }
+
+ private:
+  /// \brief returns the innermost scope opened by the calling thread, or 0
+  size_t current_scope() const {
+    auto stack = scopes.find(std::this_thread::get_id());
+    return (stack == scopes.end()) ? 0 : stack->second.back();
+  }
+
+  /// \brief destroys the least recently used free buffers until the free
+  /// buffers fit in the capacity. The buffers still read by a pending kernel
+  /// are kept alive by the sycl runtime.
+  void evict() {
+    size_t free_bytes = 0;
+    for (auto &entry : entries) {
+      free_bytes += entry.in_use ? 0 : entry.bytes;
+    }
+    while (free_bytes > capacity) {
+      auto oldest = entries.end();
+      for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (!it->in_use &&
+            (oldest == entries.end() || it->last_use < oldest->last_use)) {
+          oldest = it;
+        }
+      }
+      free_bytes -= oldest->bytes;
+      entries.erase(oldest);
+    }
+  }
+
+  /// \brief forgets the results held by the buffer and the results computed
+  /// from it, as its content is about to be overwritten.
+  void forget(const void *buffer) {
+    std::vector<Common> kept;
+    for (auto &common : commons) {
+      if (common.buffer != buffer &&
+          std::find(common.key.leaves.begin(), common.key.leaves.end(),
+                    buffer) == common.key.leaves.end()) {
+        kept.push_back(common);
+      }
+    }
+    commons.swap(kept);
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_POOL_HPP_
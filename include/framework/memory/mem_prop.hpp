@@ -86,6 +86,14 @@ struct MemoryProperties<int> {
   static constexpr size_t ChannelSize = 1;
 };
 
+/// \brief Specialisation of the MemoryProperties when the output is half
+template <>
+struct MemoryProperties<cl::sycl::half> {
+  static constexpr size_t ElementCategory = element_category::Basic;
+  using ChannelType = cl::sycl::half;
+  static constexpr size_t ChannelSize = 1;
+};
+
 /// \brief Specialisation of the MemoryProperties when the output is float
 template <>
 struct MemoryProperties<float> {
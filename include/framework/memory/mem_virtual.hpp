@@ -29,6 +29,27 @@
 
 namespace visioncpp {
 namespace internal {
+/// \struct VirtualMemoryType
+/// \brief VirtualMemoryType is the memory of the result of a scheduled
+/// subexpression. It is the output memory of the subexpression unless a
+/// storage pixel type is given, e.g. pixel::S16C1 for the result of a
+/// gradient which is computed in float.
+/// template parameters
+/// \tparam Node: the subexpression tree needed to be executed
+/// \tparam StorageT: the pixel type stored, void for the output type of Node
+template <typename Node, typename StorageT>
+struct VirtualMemoryType {
+  using Type = typename OutputMemory<StorageT, Node::Type::LeafType,
+                                     Node::Type::Cols, Node::Type::Rows,
+                                     Node::Level>::Type;
+};
+/// \brief specialisation of the VirtualMemoryType when the storage is the
+/// output type of the subexpression
+template <typename Node>
+struct VirtualMemoryType<Node, void> {
+  using Type = typename Node::Type;
+};
+
 /// \struct VirtualMemory
 /// \brief VirtualMemory struct is nothing but a future LeafNode representing
 /// the result of the subexpression passed to it to be executed. It is used by
@@ -43,11 +64,13 @@ namespace internal {
 /// \tparam LR: is the row size of local memory
 /// \tparam LCT: is the column size of workgroup
 /// \tparam LRT: is the row size of workgroup
+/// \tparam StorageT: the pixel type stored in the memory, void for the output
+/// type of the subexpression
 template <bool PlcType, typename Node, size_t LC, size_t LR, size_t LCT,
-          size_t LRT>
+          size_t LRT, typename StorageT>
 struct VirtualMemory {
   static constexpr bool policyType = PlcType;
-  using Type = typename Node::Type;
+  using Type = typename VirtualMemoryType<Node, StorageT>::Type;
   using Scalar = typename Type::Scalar;
   using ElementType = typename Type::ElementType;
   template <cl::sycl::access::mode acMd>
@@ -61,6 +84,12 @@ struct VirtualMemory {
   Node subTree;
   using syclBuffer = Node;
   VirtualMemory(Node nd) : subTree(nd){};
+  /// \brief returns the runtime column size of the subexpression result
+  inline size_t get_cols() const { return runtime_cols(subTree); }
+  /// \brief returns the runtime row size of the subexpression result
+  inline size_t get_rows() const { return runtime_rows(subTree); }
+  /// \brief returns the number of images of the subexpression result
+  inline size_t get_batch() const { return runtime_batch(subTree); }
   /// sub_expression_evaluation
   /// \brief This function is used to break the expression tree whenever
   /// necessary. The decision for breaking the tree will be determined based on
@@ -87,10 +116,17 @@ struct VirtualMemory {
       const DeviceT &dev) {
     // this is manually breaking so we have to break and we cannot use the
     // condition used in the subtree for evalifneeded
-    auto lhs = internal::LeafNode<Type, Level>();
     auto rhs =
         subTree.template sub_expression_evaluation<false, LC1, LR1, LRT1, LCT1>(
             dev);
+    // an identical subexpression has already been executed
+    auto key = make_subtree_key(rhs);
+    auto common = find_common<internal::LeafNode<Type, Level>>(dev, key);
+    if (common) {
+      return internal::LeafNode<Type, Level>(*common);
+    }
+    auto lhs = make_intermediate<internal::LeafNode<Type, Level>>(
+        dev, get_cols(), get_rows());
     auto a =
         internal::Assign<decltype(lhs), decltype(rhs),
                          decltype(lhs)::Type::Cols, decltype(lhs)::Type::Rows,
@@ -100,6 +136,7 @@ struct VirtualMemory {
                                  decltype(lhs), decltype(rhs)>::Type::Level>(
             lhs, rhs);
     execute<PlcType, LC, LR, LCT, LRT>(a, dev);
+    keep_common(dev, key, lhs);
     return lhs;
   }
 };
@@ -126,5 +163,34 @@ auto schedule(Type dt)
                             Type::Level>(
       internal::VirtualMemory<plcType, Type>(dt));
 }
+/// brief function schedule is a template deduction function for VirtualMemory
+/// when the result is stored as the pixel type StorageT, e.g.
+/// schedule<policy::Fuse, pixel::S16C1>(sobel). The subexpression is computed
+/// in its own output type and each pixel is converted to StorageT when it is
+/// written, so a narrow StorageT halves the memory traffic of the
+/// intermediate result.
+template <size_t plcType, typename StorageT, typename Type>
+auto schedule(Type dt) -> decltype(internal::LeafNode<
+    internal::VirtualMemory<plcType, Type, 8, 8, 8, 8, StorageT>, Type::Level>(
+    dt)) {
+  return internal::LeafNode<
+      internal::VirtualMemory<plcType, Type, 8, 8, 8, 8, StorageT>,
+      Type::Level>(
+      internal::VirtualMemory<plcType, Type, 8, 8, 8, 8, StorageT>(dt));
+}
+/// brief function schedule is a template deduction function for VirtualMemory
+/// when the local memory and workgroup size is defined by a user and the
+/// result is stored as the pixel type StorageT.
+template <size_t plcType, size_t LWV, size_t LHV, size_t LCTV, size_t LRTV,
+          typename StorageT, typename Type>
+auto schedule(Type dt) -> decltype(internal::LeafNode<
+    internal::VirtualMemory<plcType, Type, LWV, LHV, LCTV, LRTV, StorageT>,
+    Type::Level>(dt)) {
+  return internal::LeafNode<
+      internal::VirtualMemory<plcType, Type, LWV, LHV, LCTV, LRTV, StorageT>,
+      Type::Level>(
+      internal::VirtualMemory<plcType, Type, LWV, LHV, LCTV, LRTV, StorageT>(
+          dt));
+}
 }  // visioncpp
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_VIRTUAL_HPP_
\ No newline at end of file
@@ -24,6 +24,8 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_VISION_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_VISION_HPP_
 
+#include <stdexcept>
+
 namespace visioncpp {
 namespace internal {
 
@@ -40,8 +42,10 @@ namespace internal {
 /// Buffer1D, Image, Host)
 /// \tparam Sclr: represent the type of each channel of the elements of the
 /// memory
-/// \tparam Col: represents the column size of the memory
-/// \tparam Row: represents the Row size of the memory
+/// \tparam Col: represents the column size of the memory. It can be dynamic
+/// when the size is only known at runtime
+/// \tparam Row: represents the Row size of the memory. It can be dynamic
+/// when the size is only known at runtime
 /// \tparam ElementTp: represents the types of each element inside the memory
 /// \tparam Elements: represents the number of channels for each element
 /// \tparam Sc: represents the memory target on the device (global memory or
@@ -81,6 +85,14 @@ struct VisionMemory {
       typename SyclMem<HasMapAllocator, LeafType, Dim, ElementType>::Type;
   std::shared_ptr<syclBuffer> syclData;
   std::shared_ptr<HostAccessor<cl::sycl::access::mode::read>> hostAcc;
+  /// the runtime column size of the memory
+  size_t cols;
+  /// the runtime row size of the memory
+  size_t rows;
+  /// the number of images of the memory. The images are stored one after the
+  /// other and are processed by the same kernel when the expression is
+  /// executed by execute_batch.
+  size_t batch;
 
   static constexpr size_t used_memory() {
     return (Rows * Cols * Channels * sizeof(Scalar));
@@ -88,17 +100,69 @@ struct VisionMemory {
 
   static constexpr size_t get_size() { return (Type::used_memory()); }
 
-  VisionMemory(Scalar *dt) {
+  /// \brief the static size is used when it is known at compile time, the
+  /// given size is only used for dynamic extents.
+  VisionMemory(Scalar *dt, size_t cls = Cols, size_t rws = Rows,
+               size_t btch = 1)
+      : cols(Cols != dynamic ? Cols : cls),
+        rows(Rows != dynamic ? Rows : rws),
+        batch(btch) {
+    create_sycl_buffer<LeafType, ElementType, Scalar>(
+        syclData, dt, get_range<Dim>(rows * batch, cols));
+  }
+  /// \brief creates the sycl buffer using the host pointer as its memory, so
+  /// the host and the device share the same bytes and reset_input and
+  /// read_output do not copy when they are given the same pointer. It throws
+  /// std::invalid_argument when the pointer is not aligned on
+  /// host_ptr_alignment bytes.
+  VisionMemory(Scalar *dt, use_host_ptr_t tag, size_t cls = Cols,
+               size_t rws = Rows, size_t btch = 1)
+      : cols(Cols != dynamic ? Cols : cls),
+        rows(Rows != dynamic ? Rows : rws),
+        batch(btch) {
+    if (!is_host_ptr_aligned(dt)) {
+      throw std::invalid_argument(
+          "visioncpp: the host pointer of a use_host_ptr terminal must be "
+          "aligned on host_ptr_alignment bytes");
+    }
     create_sycl_buffer<LeafType, ElementType, Scalar>(
-        syclData, dt, get_range<Dim>(Rows, Cols));
+        syclData, dt, get_range<Dim>(rows * batch, cols), tag);
   }
   /// buffer copy is lightweight no need to pass by ref
-  VisionMemory(syclBuffer dt) { syclData = std::make_shared<syclBuffer>(dt); }
+  VisionMemory(syclBuffer dt, size_t cls = Cols, size_t rws = Rows)
+      : cols(Cols != dynamic ? Cols : cls),
+        rows(Rows != dynamic ? Rows : rws),
+        batch(1) {
+    syclData = std::make_shared<syclBuffer>(dt);
+  }
+
+  /// \brief shares the given sycl buffer. This is used to reuse the buffers
+  /// of the BufferPool.
+  VisionMemory(std::shared_ptr<syclBuffer> dt, size_t cls, size_t rws,
+               size_t btch = 1)
+      : syclData(dt),
+        cols(Cols != dynamic ? Cols : cls),
+        rows(Rows != dynamic ? Rows : rws),
+        batch(btch) {}
 
-  VisionMemory() {
+  VisionMemory() : VisionMemory(Cols, Rows) {}
+
+  /// \brief creates the device only memory of the given size. The size is
+  /// only used for dynamic extents.
+  VisionMemory(size_t cls, size_t rws, size_t btch = 1)
+      : cols(Cols != dynamic ? Cols : cls),
+        rows(Rows != dynamic ? Rows : rws),
+        batch(btch) {
     create_sycl_buffer<LeafType, ElementType, Scalar>(
-        syclData, get_range<Dim>(Rows, Cols));
+        syclData, get_range<Dim>(rows * batch, cols));
   }
+
+  /// \brief returns the runtime column size of the memory
+  inline size_t get_cols() const { return cols; }
+  /// \brief returns the runtime row size of the memory
+  inline size_t get_rows() const { return rows; }
+  /// \brief returns the number of images of the memory
+  inline size_t get_batch() const { return batch; }
   /// sub_expression_evaluation
   /// \brief This function is used to break the expression tree whenever
   /// necessary. The decision for breaking the tree will be determined based on
@@ -140,7 +204,16 @@ struct VisionMemory {
   /// we want to pass different input stream to the expression.
   /// \return void
   void reset_input(Scalar *dt) {
-    buffer_update<LeafType, Rows, Cols, ElementType, Scalar>(syclData, dt);
+    buffer_update<LeafType, ElementType, Scalar>(syclData, dt, rows * batch,
+                                                 cols);
+  }
+
+  /// \brief read_output is used to copy the content of the memory to the given
+  /// host pointer while keeping the sycl buffer alive. This can be used when
+  /// the same memory is reused for every frame of a video stream.
+  /// \return void
+  void read_output(Scalar *dt) {
+    buffer_read<ElementType, Scalar>(syclData, dt, rows * batch, cols);
   }
 
   /// \brief set_output function is used to destroy the sycl buffer and manually
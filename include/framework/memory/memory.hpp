@@ -124,6 +124,18 @@ inline cl::sycl::range<Dim> get_range(size_t r, size_t c) {
   //  return SyclRange<Dim>::get_range(r, c);
 }
 
+/// function get_batch_range
+/// \brief returns the sycl range<3> used to execute an expression on a batch
+/// of images. The images of the batch are the third dimension.
+/// \param r: row size
+/// \param c: column size
+/// \param n: the number of images of the batch
+/// \return cl::sycl::range<3>
+inline cl::sycl::range<3> get_batch_range(size_t r, size_t c, size_t n) {
+  /// column major
+  return cl::sycl::range<3>(c, r, n);
+}
+
 /// \struct SyclScope
 /// \brief determines the memory target on the device based on the
 /// memory type and suggested target.
@@ -340,6 +352,22 @@ struct CreateSyclBuffer {
         VisionMem((static_cast<ElemType *>(static_cast<void *>(dt))), rng));
   }
 
+  /// function create_buffer
+  /// \brief This function is used to create a sycl buffer which uses the host
+  /// memory in place of its own storage, so the host and the device share the
+  /// same bytes when the device can access the host memory.
+  /// parameters:
+  /// \param ptr : shared_ptr containing the VisionMem
+  /// \param dt : the input pointer for creating buffer
+  /// \param rng : the sycl range for creating buffer
+  /// \return void
+  static inline void create_buffer(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                                   RNG rng, use_host_ptr_t) {
+    ptr = std::make_shared<VisionMem>(
+        VisionMem((static_cast<ElemType *>(static_cast<void *>(dt))), rng,
+                  {cl::sycl::property::buffer::use_host_ptr()}));
+  }
+
   /// function create_buffer
   /// \brief This function is used to create a device only buffer when there is
   /// no host pointer allocated for synchronization.
@@ -425,6 +453,29 @@ inline void create_sycl_buffer(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
       ptr, dt, rng);
 }
 
+/// function create_sycl_buffer
+/// \brief template deduction for CreateSyclBuffer struct when the buffer uses
+/// the host pointer in place of its own storage
+/// template parameters:
+/// \tparam LeafType: determines the memory type
+/// \tparam ElemType : determines the type of the element in each memory
+/// \tparam Scalar : determines the type of each channel of each element
+/// \tparam VisionMem: represent the type of the memory created by using SyclMem
+/// \tparam RNG : the sycl range type for creating memory
+/// function parameters
+/// parameters:
+/// \param ptr : shared_ptr containing the VisionMem
+/// \param dt : the input pointer shared with the buffer
+/// \param rng : the sycl range for creating buffer
+/// \return void
+template <size_t LeafType, typename ElemType, typename Scalar,
+          typename VisionMem, typename RNG>
+inline void create_sycl_buffer(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                               RNG rng, use_host_ptr_t tag) {
+  CreateSyclBuffer<LeafType, ElemType, Scalar, VisionMem, RNG>::create_buffer(
+      ptr, dt, rng, tag);
+}
+
 /// function create_sycl_buffer
 /// \brief template deduction for CreateSyclBuffer struct. this one create
 /// another buffer from accepting an input buffer. It is used for creating
@@ -473,59 +524,61 @@ inline void create_sycl_buffer(std::shared_ptr<VisionMem> &ptr, RNG rng) {
 /// \struct BufferUpdate
 /// \brief This is used to update the Vision Memory with new value
 /// update sycl buffer at the moment we use ptr.reset() because it was faster
-/// than getting the host pointer and updating it in the host side.
+/// than getting the host pointer and updating it in the host side. Nothing is
+/// copied when the buffer uses the given pointer as its host memory, the
+/// discard_write access only tells the runtime the content has changed.
 /// template parameters:
 /// \tparam LeafType : is the memory type
-/// \tparam Rows: is the row size of the buffer
-/// \tparam Cols: is the column size of the buffer
 /// \tparam ElemType: is the type of element in the buffer
 /// \tparam Scalar is the type of each channel of the element
 /// \tparam VisionMem is the created SyclMem
-template <size_t LeafType, size_t Rows, size_t Cols, typename ElemType,
-          typename Scalar, typename VisionMem>
+template <size_t LeafType, typename ElemType, typename Scalar,
+          typename VisionMem>
 struct BufferUpdate {
   /// function buffer_update
   /// \brief this function is used to update the sycl buffer with a new value
   /// parameters:
   /// \param ptr : is the shared_ptr containing the SyclMem
   /// \param dt: is the pointer containing the new value for the buffer
+  /// \param rows: is the row size of the buffer
+  /// \param cols: is the column size of the buffer
   /// \return void
-  static inline void buffer_update(std::shared_ptr<VisionMem> &ptr,
-                                   Scalar *dt) {
+  static inline void buffer_update(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                                   size_t rows, size_t cols) {
     auto host_ptr =
         (*ptr)
             .template get_access<cl::sycl::access::mode::discard_write,
                                  cl::sycl::access::target::host_buffer>()
             .get_pointer();
 
-    memcpy(host_ptr, dt, sizeof(Scalar) * ElemType::elements * Rows * Cols);
+    if (static_cast<void *>(host_ptr) != static_cast<void *>(dt)) {
+      memcpy(host_ptr, dt, sizeof(Scalar) * ElemType::elements * rows * cols);
+    }
   }
 };
 
 /// \brief specialisation of the BufferUpdate when the memory_type is Image
-template <size_t Rows, size_t Cols, typename ElemType, typename Scalar,
-          typename VisionMem>
-struct BufferUpdate<memory_type::Image, Rows, Cols, ElemType, Scalar,
-                    VisionMem> {
+template <typename ElemType, typename Scalar, typename VisionMem>
+struct BufferUpdate<memory_type::Image, ElemType, Scalar, VisionMem> {
   /// function buffer_update
   /// \brief this function is used to update the sycl buffer with a new value
   /// parameters:
   /// \param ptr : is the shared_ptr containing the SyclMem
   /// \param dt: is the pointer containing the new value for the buffer
+  /// \param rows: is the row size of the buffer
+  /// \param cols: is the column size of the buffer
   /// \return void
   using Properties = ImageProperties<ElemType, Scalar>;
-  static inline void buffer_update(std::shared_ptr<VisionMem> &ptr,
-                                   Scalar *dt) {
+  static inline void buffer_update(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                                   size_t rows, size_t cols) {
     static_assert(true, "image is not supported in this version");
   }
 };
 
 /// \brief specialisation of the BufferUpdate when the memory_type is Constant
 /// variable
-template <size_t Rows, size_t Cols, typename ElemType, typename Scalar,
-          typename VisionMem>
-struct BufferUpdate<memory_type::Const, Rows, Cols, ElemType, Scalar,
-                    VisionMem> {
+template <typename ElemType, typename Scalar, typename VisionMem>
+struct BufferUpdate<memory_type::Const, ElemType, Scalar, VisionMem> {
   /// function buffer_update
   /// \brief this function is used to update the sycl buffer with a new value
   /// parameters:
@@ -533,7 +586,7 @@ struct BufferUpdate<memory_type::Const, Rows, Cols, ElemType, Scalar,
   /// \param dt: is the pointer containing the new value for the buffer
   /// \return void
   static inline void buffer_update(std::shared_ptr<VisionMem> &ptr,
-                                   VisionMem dt) {
+                                   VisionMem dt, size_t, size_t) {
     *ptr = dt;
   }
 };
@@ -542,29 +595,60 @@ struct BufferUpdate<memory_type::Const, Rows, Cols, ElemType, Scalar,
 /// \brief template deduction function for BufferUpdate
 /// template parameters:
 /// \tparam LeafType : is the memory type
-/// \tparam Rows: is the row size of the buffer
-/// \tparam Cols: is the column size of the buffer
 /// \tparam ElemType: is the type of element in the buffer
 /// \tparam Scalar is the type of each channel of the element
 /// \tparam VisionMem is the created SyclMem
 /// function parameters:
 /// \param ptr : is the shared_ptr containing the SyclMem
 /// \param dt: is the pointer containing the new value for the buffer
+/// \param rows: is the row size of the buffer
+/// \param cols: is the column size of the buffer
 /// \return void
-template <size_t LeafType, size_t Rows, size_t Cols, typename ElemType,
-          typename Scalar, typename VisionMem>
-inline void buffer_update(std::shared_ptr<VisionMem> &ptr, Scalar *dt) {
-  BufferUpdate<LeafType, Rows, Cols, ElemType, Scalar,
-               VisionMem>::buffer_update(ptr, dt);
+template <size_t LeafType, typename ElemType, typename Scalar,
+          typename VisionMem>
+inline void buffer_update(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                          size_t rows, size_t cols) {
+  BufferUpdate<LeafType, ElemType, Scalar, VisionMem>::buffer_update(
+      ptr, dt, rows, cols);
+}
+
+/// function buffer_read
+/// \brief this function is used to copy the content of the sycl buffer back
+/// to a host pointer without destroying the buffer. Nothing is copied when the
+/// buffer uses the given pointer as its host memory.
+/// template parameters:
+/// \tparam ElemType: is the type of element in the buffer
+/// \tparam Scalar is the type of each channel of the element
+/// \tparam VisionMem is the created SyclMem
+/// function parameters:
+/// \param ptr : is the shared_ptr containing the SyclMem
+/// \param dt: is the pointer receiving the content of the buffer
+/// \param rows: is the row size of the buffer
+/// \param cols: is the column size of the buffer
+/// \return void
+template <typename ElemType, typename Scalar, typename VisionMem>
+inline void buffer_read(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                        size_t rows, size_t cols) {
+  auto host_ptr =
+      (*ptr)
+          .template get_access<cl::sycl::access::mode::read,
+                               cl::sycl::access::target::host_buffer>()
+          .get_pointer();
+
+  if (static_cast<void *>(host_ptr) != static_cast<void *>(dt)) {
+    memcpy(dt, host_ptr, sizeof(Scalar) * ElemType::elements * rows * cols);
+  }
 }
 }  // namespace internal
 }  // namespace visioncpp
 
 // Vision Memories Headers
+#include "aligned_allocator.hpp"
 #include "mem_const.hpp"
 #include "mem_prop.hpp"
 #include "mem_virtual.hpp"
 #include "mem_vision.hpp"
+#include "mem_pool.hpp"
 // memory_access in sycl
 #include "memory_access/memory_access.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEMORY_HPP_
@@ -34,6 +34,8 @@ namespace mem_dim {
 /// ColDim=1 and RowDim==0;
 static constexpr size_t ColDim = 0;
 static constexpr size_t RowDim = 1;
+/// \brief the images of a batch are always in the last dimension
+static constexpr size_t BatchDim = 2;
 };
 /// \struct Coordinate
 /// \brief Coordinate is used to specify
@@ -43,9 +45,13 @@ static constexpr size_t RowDim = 1;
 /// \tparam LC The column size for local memory
 /// \tparam LR The Row size for the local memory
 /// \tparam ItemID provided by sycl
-template <size_t LC, size_t LR, typename ItemID>
+/// \tparam VecW The number of consecutive columns a thread evaluates at once
+/// in a point operation, 1 when the point operations are not vectorised
+template <size_t LC, size_t LR, typename ItemID, size_t VecW = 1>
 struct Coordinate {
-  Coordinate(ItemID itemID)
+  /// the number of consecutive columns evaluated at once by a point operation
+  static constexpr size_t VecWidth = VecW;
+  Coordinate(ItemID itemID, size_t cols, size_t rows)
       : itemID(itemID),
         cLRng(itemID.get_local_range()[mem_dim::ColDim]),
         rLRng(itemID.get_local_range()[mem_dim::RowDim]),
@@ -56,7 +62,9 @@ struct Coordinate {
         g_r(itemID.get_local_id(mem_dim::RowDim) +
             itemID.get_group(mem_dim::RowDim) * ((LR / rLRng) * rLRng)),
         l_c(itemID.get_local_id(mem_dim::ColDim)),
-        l_r(itemID.get_local_id(mem_dim::RowDim)) {}
+        l_r(itemID.get_local_id(mem_dim::RowDim)),
+        cols(cols),
+        rows(rows) {}
 
   /// function barrier is used to call sycl local barrier for local threads
   /// \return void
@@ -79,11 +87,17 @@ struct Coordinate {
   size_t g_r;
   size_t l_c;
   size_t l_r;
+  /// the runtime column size of the image used by the nodes with dynamic
+  /// extent
+  size_t cols;
+  /// the runtime row size of the image used by the nodes with dynamic extent
+  size_t rows;
 };
 /// deduction function for Coordinate
-template <size_t LC, size_t LR, typename ItemID>
-Coordinate<LC, LR, ItemID> memLocation(ItemID itemID) {
-  return Coordinate<LC, LR, ItemID>(itemID);
+template <size_t LC, size_t LR, size_t VecW = 1, typename ItemID>
+Coordinate<LC, LR, ItemID, VecW> memLocation(ItemID itemID, size_t cols,
+                                             size_t rows) {
+  return Coordinate<LC, LR, ItemID, VecW>(itemID, cols, rows);
 }
 }  // internal
 }  // visioncpp
@@ -24,24 +24,40 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEMORY_ACCESS_MEM_NEIGHBOUR_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEMORY_ACCESS_MEM_NEIGHBOUR_HPP_
 
+#include <cassert>
+
 namespace visioncpp {
 namespace internal {
 /// \struct LocalNeighbour
 /// \brief LocalNeighbour is used to provide local access for each
 /// element of the local memory based on the Coordinate passed by eval
 /// expression. It is used as an input type for user functor when the local
-/// neighbour operation is required.
+/// neighbour operation is required. The local memory already contains the
+/// halo of the operation, loaded with its border policy, therefore a functor
+/// must not read further than the halo it declares. When NDEBUG is not
+/// defined, a coordinate outside of the local memory fails an assert. The
+/// functor of a neighbour_operation can tell the pixels of the image from the
+/// pixels of the halo outside of it with inside. The half and 16 bit integer
+/// pixels are read as float, see tools::AccumulatorType.
 /// template parameters
 /// \tparam T is the pixel type for the local memory
 template <typename T> struct LocalNeighbour {
 public:
-  using PixelType = T;
+  using PixelType = typename tools::AccumulatorType<T>::Type;
   cl::sycl::local_ptr<T> &ptr;
 
   int I_c;
   int I_r;
   LocalNeighbour(cl::sycl::local_ptr<T> &ptr, size_t colsArg, size_t rowsArg)
-      : ptr(ptr), I_c(0), I_r(0), cols(colsArg), rows(rowsArg) {}
+      : ptr(ptr),
+        I_c(0),
+        I_r(0),
+        cols(colsArg),
+        rows(rowsArg),
+        origin_c(0),
+        origin_r(0),
+        image_cols(colsArg),
+        image_rows(rowsArg) {}
   /// function set_offset:
   /// \brief used to  set the local memory offset for each local thread
   /// function parameters:
@@ -52,35 +68,70 @@ public:
     I_c = c;
     I_r = r;
   }
+  /// function set_image:
+  /// \brief places the local memory in the image read by the operation. By
+  /// default the whole local memory is inside of the image.
+  /// function parameters:
+  /// \param c : the image column of the first element of the local memory
+  /// \param r : the image row of the first element of the local memory
+  /// \param colsArg : the column size of the image
+  /// \param rowsArg : the row size of the image
+  /// \return void
+  inline void set_image(int c, int r, size_t colsArg, size_t rowsArg) {
+    origin_c = c;
+    origin_r = r;
+    image_cols = colsArg;
+    image_rows = rowsArg;
+  }
+  /// function inside
+  /// \brief whether the element (c, r) of the local memory is a pixel of the
+  /// image rather than a pixel of the halo read with the border policy
+  /// parameters:
+  /// \param c: column index
+  /// \param r: row index
+  /// \return bool
+  inline bool inside(int c, int r) const {
+    return origin_c + c >= 0 &&
+           static_cast<size_t>(origin_c + c) < image_cols &&
+           origin_r + r >= 0 && static_cast<size_t>(origin_r + r) < image_rows;
+  }
   /// function at provides access to a specific Coordinate for a 2d buffer
   /// parameters:
   /// \param c: column index
   /// \param r: row index
   /// \return PixelType
   inline PixelType at(int c, int r) const {
-    c = (c >= 0 ? c : 0);
-    r = (r >= 0 ? r : 0);
-    return *(ptr + calculate_index(c, r, cols, rows));
+    assert(c >= 0 && static_cast<size_t>(c) < cols && r >= 0 &&
+           static_cast<size_t>(r) < rows);
+    return tools::convert<PixelType>(*(ptr + c + cols * r));
   }
   /// function at provides access to a specific Coordinate for a 1d buffer
   /// parameters:
   /// \param c: index
   /// \return PixelType
-  inline PixelType at(int c) const { return *(ptr + c); }
+  inline PixelType at(int c) const {
+    return tools::convert<PixelType>(*(ptr + c));
+  }
 
 private:
   size_t cols;
   size_t rows;
+  int origin_c;
+  int origin_r;
+  size_t image_cols;
+  size_t image_rows;
 };
 /// \struct GlobalNeighbour
 /// \brief GlobalNeighbour is used to provide local access for each
 /// element of the global memory based on the Coordinate passed by eval
 /// expression. It is used as an input type for user functor when the global
-/// neighbour operation is required.
+/// neighbour operation is required. A coordinate outside of the memory reads
+/// the closest pixel inside of it. The half and 16 bit integer pixels are read
+/// as float, see tools::AccumulatorType.
 /// template parameters
 /// \tparam T is the pixel type for the global memory
 template <typename T> struct GlobalNeighbour {
-  using PixelType = T;
+  using PixelType = typename tools::AccumulatorType<T>::Type;
   size_t I_c;
   size_t I_r;
   size_t cols;
@@ -104,21 +155,25 @@ template <typename T> struct GlobalNeighbour {
   /// \param r: row index
   /// \return PixelType
   inline PixelType at(int c, int r) const {
-    c = (c >= 0 ? c : 0);
-    r = (r >= 0 ? r : 0);
-    return *(ptr + calculate_index(c, r, cols, rows));
+    return tools::convert<PixelType>(
+        *(ptr + border_index<border::Replicate>(c, cols) +
+          cols * border_index<border::Replicate>(r, rows)));
   }
   /// function at provides access to a specific coordinate for a 1d buffer
   /// parameters:
   /// \param c:  index
   /// \return PixelType
-  inline PixelType at(int c) const { return *(ptr + c); }
+  inline PixelType at(int c) const {
+    return tools::convert<PixelType>(*(ptr + c));
+  }
 };
 /// \struct ConstNeighbour
 /// \brief ConstNeighbour is used to provide global access to the constant
 /// memory. It is used as an input type for user functor when a constant pointer
 /// needed to be passed on the device side. An example of such node can be a
-/// filter node for convolution operation.
+/// filter node for convolution operation. The coordinate must be inside of
+/// the filter. When NDEBUG is not defined, a coordinate outside of the filter
+/// fails an assert.
 /// template parameters
 /// \tparam T is the pixel type for the constant memory
 template <typename T> struct ConstNeighbour {
@@ -134,9 +189,9 @@ template <typename T> struct ConstNeighbour {
   /// \param r: row index
   /// \return PixelType
   inline PixelType at(int c, int r) const {
-    c = (c >= 0 ? c : 0);
-    r = (r >= 0 ? r : 0);
-    return *(ptr + calculate_index(c, r, cols, rows));
+    assert(c >= 0 && static_cast<size_t>(c) < cols && r >= 0 &&
+           static_cast<size_t>(r) < rows);
+    return *(ptr + c + cols * r);
   }
   /// function at provides access to an specific Coordinate for a 1d buffer
   /// parameters:
@@ -26,6 +26,20 @@
 
 namespace visioncpp {
 namespace internal {
+/// function extent
+/// \brief returns the size of a dimension. The static size is used when it is
+/// known at compile time, otherwise the runtime size is returned.
+/// template parameters:
+/// \tparam StaticSize: the compile time size of the dimension. It can be
+/// dynamic
+/// function parameters:
+/// \param runtime_size : the runtime size of the dimension
+/// \return size_t
+template <size_t StaticSize>
+static inline size_t extent(size_t runtime_size) {
+  return (StaticSize != dynamic) ? StaticSize : runtime_size;
+}
+
 /// \struct CompareIdBasedScope
 /// \brief this is used for range check to make sure the
 /// index is within the range. It uses the local value when the Conds
@@ -33,7 +47,7 @@ namespace internal {
 /// template parameters:
 /// \tparam Conds: determines whether or not the local variable should be used
 /// \tparam LDSize : determines the local dimension size
-/// \tparam GDSize: determines the global dimension size
+/// \tparam GDSize: determines the global dimension size. It can be dynamic
 /// \tparam T determines the type of the dimension index
 template <bool Conds, size_t LDSize, size_t GDSize, typename T>
 struct CompareIdBasedScope {
@@ -43,15 +57,18 @@ struct CompareIdBasedScope {
   /// \param g is the global dimension size
   /// \param i is the offset needed to be added to the local dimension
   /// before comparison
+  /// \param gsize is the runtime global dimension size
   /// \return bool
-  static inline bool get(T &l, int &i, T &g) { return (l + i < LDSize); }
+  static inline bool get(T &l, int &i, T &g, size_t gsize) {
+    return (l + i < LDSize);
+  }
 };
 
 /// \brief specialisation of the CompareIdBasedScope when the Conds is false in
 /// this case the range check is with the global size
 /// template parameters:
 /// \tparam LDSize : determines the local dimension size
-/// \tparam GDSize: determines the global dimension size
+/// \tparam GDSize: determines the global dimension size. It can be dynamic
 /// \tparam T: determines the type of the dimension index
 template <size_t LDSize, size_t GDSize, typename T>
 struct CompareIdBasedScope<false, LDSize, GDSize, T> {
@@ -61,9 +78,10 @@ struct CompareIdBasedScope<false, LDSize, GDSize, T> {
   /// \param g is the global dimension size
   /// \param i is the offset needed to be added to the global dimension
   /// before comparison
+  /// \param gsize is the runtime global dimension size
   /// return bool
-  static inline bool get(T &l, int &i, T &g) {
-    return ((l + i < LDSize) && (g + i < GDSize));
+  static inline bool get(T &l, int &i, T &g, size_t gsize) {
+    return ((l + i < LDSize) && (g + i < extent<GDSize>(gsize)));
   }
 };
 /// function get_compare
@@ -71,17 +89,19 @@ struct CompareIdBasedScope<false, LDSize, GDSize, T> {
 /// template parameters:
 /// \tparam Conds: determines whether or not the local variable should be used
 /// \tparam LDSize : determines the local dimension size
-/// \tparam GDSize: determines the global dimension size
+/// \tparam GDSize: determines the global dimension size. It can be dynamic
 /// \tparam T: determines the type of the dimension index
 /// function parameters:
 /// \param l is the local dimension size
 /// \param g is the global dimension size
 /// \param i is the offset needed to be added to the correct dimension
 /// before comparison
+/// \param gsize is the runtime global dimension size used when GDSize is
+/// dynamic
 /// return bool
 template <bool Conds, size_t LDSize, size_t GDSize, typename T>
-static inline bool get_compare(T l, int i, T g) {
-  return CompareIdBasedScope<Conds, LDSize, GDSize, T>::get(l, i, g);
+static inline bool get_compare(T l, int i, T g, size_t gsize = GDSize) {
+  return CompareIdBasedScope<Conds, LDSize, GDSize, T>::get(l, i, g, gsize);
 }
 
 /// \struct GetIdBasedScope
@@ -154,6 +174,94 @@ static inline size_t calculate_index(size_t c, size_t r, size_t cols,
   return (((r * cols) + c) < cols * rows) ? ((r * cols) + c)
                                           : (cols * rows) - 1;
 }
+
+/// \struct BorderIndex
+/// \brief BorderIndex is used to map a coordinate outside of an image
+/// dimension to the coordinate read by the border policy. It is only applied by
+/// the workgroups whose neighbour area crosses the border of the image.
+/// template parameters
+/// \tparam Border the border policy defined in visioncpp::border
+template <typename Border>
+struct BorderIndex;
+/// \brief specialisation of BorderIndex for border::Constant. A coordinate
+/// outside of the image is -1, meaning the pixel is zero.
+template <>
+struct BorderIndex<border::Constant> {
+  /// function map
+  /// parameters:
+  /// \param v : the coordinate in the dimension
+  /// \param size : the size of the dimension
+  /// \return int
+  static inline int map(int v, int size) {
+    return (v >= 0 && v < size) ? v : -1;
+  }
+};
+/// \brief specialisation of BorderIndex for border::Replicate
+template <>
+struct BorderIndex<border::Replicate> {
+  static inline int map(int v, int size) {
+    return (v < 0) ? 0 : ((v < size) ? v : size - 1);
+  }
+};
+/// \brief specialisation of BorderIndex for border::Reflect. The reflection
+/// is periodic, so it is valid for a halo larger than the image.
+template <>
+struct BorderIndex<border::Reflect> {
+  static inline int map(int v, int size) {
+    const int period = 2 * size;
+    v = ((v % period) + period) % period;
+    return (v < size) ? v : period - 1 - v;
+  }
+};
+/// \brief specialisation of BorderIndex for border::Reflect101
+template <>
+struct BorderIndex<border::Reflect101> {
+  static inline int map(int v, int size) {
+    if (size == 1) {
+      return 0;
+    }
+    const int period = 2 * size - 2;
+    v = ((v % period) + period) % period;
+    return (v < size) ? v : period - v;
+  }
+};
+/// \brief specialisation of BorderIndex for border::Wrap
+template <>
+struct BorderIndex<border::Wrap> {
+  static inline int map(int v, int size) { return ((v % size) + size) % size; }
+};
+/// \brief specialisation of BorderIndex for border::Integral
+template <>
+struct BorderIndex<border::Integral> {
+  static inline int map(int v, int size) {
+    return (v < 0) ? -1 : ((v < size) ? v : size - 1);
+  }
+};
+/// \brief template deduction function for BorderIndex
+/// template parameters
+/// \tparam Border the border policy defined in visioncpp::border
+/// function parameters:
+/// \param v : the coordinate in the dimension
+/// \param size : the size of the dimension
+/// \return int : the coordinate read, -1 when the pixel is zero
+template <typename Border>
+static inline int border_index(int v, size_t size) {
+  return BorderIndex<Border>::map(v, static_cast<int>(size));
+}
+
+/// function ratio_step
+/// \brief this function is used to calculate the stride of the threads of a
+/// workgroup when only a 1/ratio of the workgroup writes the output of a
+/// node (e.g. downsampling). The stride never becomes zero, therefore a
+/// workgroup smaller than the ratio (e.g. a single thread per tile) still
+/// covers the whole output.
+/// parameters:
+/// \param rng : the workgroup size in the dimension
+/// \param ratio : the ratio between the input and output size in the dimension
+/// \return size_t
+static inline size_t ratio_step(size_t rng, size_t ratio) {
+  return ((rng / ratio) > 0) ? (rng / ratio) : 1;
+}
 }  // internal
 }  // visioncpp
 #include "mem_coordinate.hpp"
@@ -45,6 +45,34 @@ struct Convertor {
   static inline T convert(T t) { return t; }
 };
 
+/// \brief Specialisation of Convertor when the output is any other pixel
+/// type, e.g. F32C1 or S16C2. A pixel of the same number of channels is
+/// converted channel by channel, a 16 bit integer channel being rounded and
+/// saturated.
+template <typename T, size_t N>
+struct Convertor<visioncpp::pixel::Storage<T, N>> {
+  /// function convert
+  /// \brief Returns the input type.
+  /// parameters:
+  /// \param t  Input type to be converted
+  /// \return Storage<T, N>
+  static inline visioncpp::pixel::Storage<T, N> convert(
+      visioncpp::pixel::Storage<T, N> t) {
+    return t;
+  }
+
+  /// function convert
+  /// \brief Convert each channel of the input pixel to the output type.
+  /// parameters:
+  /// \param t  Input type to be converted
+  /// \return Storage<T, N>
+  template <typename U>
+  static inline visioncpp::pixel::Storage<T, N> convert(
+      visioncpp::pixel::Storage<U, N> t) {
+    return storage_cast<T>(t);
+  }
+};
+
 /// \brief Specialisation of Convertor when the output is float4
 template <>
 struct Convertor<cl::sycl::float4> {
@@ -217,6 +245,17 @@ struct Convertor<cl::sycl::uint4> {
 /// \brief specialisation of the Convertor when the output is F32C3
 template <>
 struct Convertor<visioncpp::pixel::F32C3> {
+  /// function convert
+  /// \brief Convert each channel of the input pixel to the F32C3 output type.
+  /// parameters:
+  /// \param t  input type needed to be converted
+  /// \return F32C3
+  template <typename U>
+  static inline visioncpp::pixel::F32C3 convert(
+      visioncpp::pixel::Storage<U, 3> t) {
+    return storage_cast<visioncpp::pixel::F32C3::data_type>(t);
+  }
+
   /// function convert
   /// \brief Convert the cl::sycl::float4 input type to the F32C3 output type.
   /// parameters:
@@ -269,6 +308,17 @@ struct Convertor<visioncpp::pixel::F32C3> {
 /// \brief specialisation of the Convertor when the output is F32C4
 template <>
 struct Convertor<visioncpp::pixel::F32C4> {
+  /// function convert
+  /// \brief Convert each channel of the input pixel to the F32C4 output type.
+  /// parameters:
+  /// \param t  input type needed to be converted
+  /// \return F32C4
+  template <typename U>
+  static inline visioncpp::pixel::F32C4 convert(
+      visioncpp::pixel::Storage<U, 4> t) {
+    return storage_cast<visioncpp::pixel::F32C4::data_type>(t);
+  }
+
   /// function convert
   /// \brief Convert the cl::sycl::float4 input type to the F32C4 output type.
   /// parameters:
@@ -321,6 +371,17 @@ struct Convertor<visioncpp::pixel::F32C4> {
 /// \brief specialisation of the Convertor when the output is U8C3
 template <>
 struct Convertor<visioncpp::pixel::U8C3> {
+  /// function convert
+  /// \brief Convert each channel of the input pixel to the U8C3 output type.
+  /// parameters:
+  /// \param t  input type needed to be converted
+  /// \return U8C3
+  template <typename U>
+  static inline visioncpp::pixel::U8C3 convert(
+      visioncpp::pixel::Storage<U, 3> t) {
+    return storage_cast<visioncpp::pixel::U8C3::data_type>(t);
+  }
+
   /// function convert
   /// \brief Convert the cl::sycl::float4 input type to the U8C3 output type.
   /// parameters:
@@ -373,6 +434,17 @@ struct Convertor<visioncpp::pixel::U8C3> {
 /// \brief specialisation of the Convertor when the output is U8C4
 template <>
 struct Convertor<visioncpp::pixel::U8C4> {
+  /// function convert
+  /// \brief Convert each channel of the input pixel to the U8C4 output type.
+  /// parameters:
+  /// \param t  input type needed to be converted
+  /// \return U8C4
+  template <typename U>
+  static inline visioncpp::pixel::U8C4 convert(
+      visioncpp::pixel::Storage<U, 4> t) {
+    return storage_cast<visioncpp::pixel::U8C4::data_type>(t);
+  }
+
   /// function convert
   /// \brief Convert the cl::sycl::float4 input type to the U8C4 output type.
   /// parameters:
@@ -461,6 +533,16 @@ struct Convertor<char> {
 /// \brief specialisation of the Convertor when the output is unsigned short
 template <>
 struct Convertor<unsigned short> {
+  /// function convert
+  /// \brief Convert the float input type to the unsigned short output type.
+  /// It is rounded to the nearest and saturated.
+  /// parameters:
+  /// \param t  input type needed to be converted
+  /// \return unsigned short
+  static inline unsigned short convert(float t) {
+    return channel_cast<unsigned short>(t);
+  }
+
   /// function convert
   /// \brief Convert the cl::sycl::uint4 t input type to the unsigned short
   /// output type.
@@ -480,6 +562,14 @@ struct Convertor<unsigned short> {
 /// \brief specialisation of the Convertor when the output is short
 template <>
 struct Convertor<short> {
+  /// function convert
+  /// \brief Convert the float input type to the short output type. It is
+  /// rounded to the nearest and saturated.
+  /// parameters:
+  /// \param t  input type needed to be converted
+  /// \return short
+  static inline short convert(float t) { return channel_cast<short>(t); }
+
   /// function convert
   /// \brief Convert the cl::sycl::int4 input type to the short output type.
   /// parameters:
@@ -546,6 +636,42 @@ struct Convertor<float> {
   static inline float convert(float t) { return t; }
 };
 
+/// \struct AccumulatorType
+/// \brief AccumulatorType is the pixel type used to compute a neighbour
+/// operation on the pixel type T. The half and 16 bit integer pixels are
+/// stored narrow but read as float, so the operation accumulates in float and
+/// its result is only narrowed when it is written to a narrow memory.
+/// template parameters:
+/// \tparam T is the pixel type of the memory
+template <typename T>
+struct AccumulatorType {
+  using Type = T;
+};
+
+/// \brief specialisation of the AccumulatorType for half
+template <>
+struct AccumulatorType<cl::sycl::half> {
+  using Type = float;
+};
+
+/// \brief specialisation of the AccumulatorType for the F16Cn pixels
+template <size_t N>
+struct AccumulatorType<visioncpp::pixel::Storage<cl::sycl::half, N>> {
+  using Type = visioncpp::pixel::Storage<float, N>;
+};
+
+/// \brief specialisation of the AccumulatorType for the S16Cn pixels
+template <size_t N>
+struct AccumulatorType<visioncpp::pixel::Storage<short, N>> {
+  using Type = visioncpp::pixel::Storage<float, N>;
+};
+
+/// \brief specialisation of the AccumulatorType for the U16Cn pixels
+template <size_t N>
+struct AccumulatorType<visioncpp::pixel::Storage<unsigned short, N>> {
+  using Type = visioncpp::pixel::Storage<float, N>;
+};
+
 /// function convert
 /// \brief template deduction for Convertor struct
 /// template parameters
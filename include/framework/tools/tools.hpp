@@ -29,4 +29,5 @@
 #include "time.hpp"
 #include "tuple.hpp"
 #include "type_dereferencer.hpp"
+#include "vectorise.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_TOOLS_TOOLS_HPP_
@@ -0,0 +1,170 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file vectorise.hpp
+/// \brief This file contains the types used to evaluate a point operation on
+/// the pixels of W consecutive columns at once.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_TOOLS_VECTORISE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_TOOLS_VECTORISE_HPP_
+
+namespace visioncpp {
+namespace internal {
+namespace tools {
+/// \struct PixelPack
+/// \brief PixelPack holds the pixels of W consecutive columns, one per lane.
+/// template parameters
+/// \tparam T : the pixel type
+/// \tparam W : the number of lanes
+template <typename T, size_t W>
+struct PixelPack {
+  T lane[W];
+};
+
+/// \struct VectorLanes
+/// \brief VectorLanes converts a PixelPack of a scalar type to a
+/// cl::sycl::vec holding one lane per element, and back.
+/// template parameters
+/// \tparam T : the pixel type
+/// \tparam W : the number of lanes
+template <typename T, size_t W>
+struct VectorLanes {
+  using Type = cl::sycl::vec<T, static_cast<int>(W)>;
+  /// \brief loads the lanes of the pack in a vector
+  static inline Type pack(PixelPack<T, W> p) {
+    Type v;
+    v.load(0, cl::sycl::private_ptr<T>(p.lane));
+    return v;
+  }
+  /// \brief stores the elements of the vector in the lanes of a pack
+  static inline PixelPack<T, W> unpack(Type v) {
+    PixelPack<T, W> p;
+    v.store(0, cl::sycl::private_ptr<T>(p.lane));
+    return p;
+  }
+};
+
+/// \brief specialisation of the VectorLanes for the pixels of N channels.
+/// The pack is stored channel by channel, as a pixel of N vectors, so an
+/// operation written for a pixel is applied to the W lanes at once.
+template <typename T, size_t N, size_t W>
+struct VectorLanes<visioncpp::pixel::Storage<T, N>, W> {
+  using Type = visioncpp::pixel::Storage<typename VectorLanes<T, W>::Type, N>;
+  /// \brief loads each channel of the lanes of the pack in a vector
+  static inline Type pack(
+      const PixelPack<visioncpp::pixel::Storage<T, N>, W> &p) {
+    Type v;
+    for (size_t c = 0; c < N; c++) {
+      PixelPack<T, W> channel;
+      for (size_t l = 0; l < W; l++) {
+        channel.lane[l] = p.lane[l][c];
+      }
+      v[c] = VectorLanes<T, W>::pack(channel);
+    }
+    return v;
+  }
+  /// \brief stores the vector of each channel in the lanes of a pack
+  static inline PixelPack<visioncpp::pixel::Storage<T, N>, W> unpack(
+      const Type &v) {
+    PixelPack<visioncpp::pixel::Storage<T, N>, W> p;
+    for (size_t c = 0; c < N; c++) {
+      PixelPack<T, W> channel = VectorLanes<T, W>::unpack(v[c]);
+      for (size_t l = 0; l < W; l++) {
+        p.lane[l][c] = channel.lane[l];
+      }
+    }
+    return p;
+  }
+};
+
+/// \struct IsVectorised
+/// \brief IsVectorised is true when the point operation functor OP declares
+/// static constexpr bool vectorised = true. Such a functor is also callable
+/// on the VectorLanes type of its inputs, and returns the VectorLanes type of
+/// its output.
+/// template parameters
+/// \tparam OP : the point operation functor
+template <typename OP>
+struct IsVectorised {
+ private:
+  template <typename U>
+  static constexpr bool check(decltype(U::vectorised) *) {
+    return U::vectorised;
+  }
+  template <typename U>
+  static constexpr bool check(...) {
+    return false;
+  }
+
+ public:
+  static constexpr bool value = check<OP>(nullptr);
+};
+
+/// \struct VectorApply
+/// \brief VectorApply calls the point operation functor OP on the lanes of
+/// its input packs. A functor which is not vectorised is called on each lane
+/// in a loop of W iterations the compiler can unroll.
+/// template parameters
+/// \tparam OP : the point operation functor
+/// \tparam OutT : the output pixel type of the functor
+/// \tparam W : the number of lanes
+/// \tparam Vectorised : whether or not the functor is vectorised
+template <typename OP, typename OutT, size_t W, bool Vectorised>
+struct VectorApply {
+  template <typename... InT>
+  static inline PixelPack<OutT, W> apply(const PixelPack<InT, W> &... in) {
+    PixelPack<OutT, W> out;
+    for (size_t l = 0; l < W; l++) {
+      out.lane[l] = OP()(in.lane[l]...);
+    }
+    return out;
+  }
+};
+
+/// \brief specialisation of the VectorApply when the functor is vectorised.
+/// The functor is called once on the vectors of the W lanes.
+template <typename OP, typename OutT, size_t W>
+struct VectorApply<OP, OutT, W, true> {
+  template <typename... InT>
+  static inline PixelPack<OutT, W> apply(const PixelPack<InT, W> &... in) {
+    return VectorLanes<OutT, W>::unpack(OP()(VectorLanes<InT, W>::pack(in)...));
+  }
+};
+
+/// function convert_pack
+/// \brief converts each lane of a pack to the pixel type T
+/// template parameters
+/// \tparam T : the output pixel type
+/// \tparam U : the input pixel type
+/// \tparam W : the number of lanes
+/// function parameters
+/// \param in : the input pack
+/// \return PixelPack
+template <typename T, typename U, size_t W>
+inline PixelPack<T, W> convert_pack(const PixelPack<U, W> &in) {
+  PixelPack<T, W> out;
+  for (size_t l = 0; l < W; l++) {
+    out.lane[l] = convert<T>(in.lane[l]);
+  }
+  return out;
+}
+}  // tools
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_TOOLS_VECTORISE_HPP_
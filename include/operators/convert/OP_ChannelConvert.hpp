@@ -0,0 +1,53 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_ChannelConvert.hpp
+/// \brief it converts the channels of a pixel between float, half and 16 bit
+/// integers
+
+namespace visioncpp {
+/// \brief This functor converts each channel of a pixel to the channel type
+/// T, keeping its value. A float converted to a 16 bit integer is rounded to
+/// the nearest and saturated.
+/// template parameters:
+/// \tparam T : the channel type of the output
+template <typename T>
+struct OP_ChannelConvert {
+  /// \param in - the pixel of N channels
+  /// \return Storage<T, N> - the pixel of N channels of type T
+  template <typename U, size_t N>
+  visioncpp::pixel::Storage<T, N> operator()(
+      visioncpp::pixel::Storage<U, N> in) {
+    return internal::storage_cast<T>(in);
+  }
+};
+
+/// \brief converts F32Cn to F16Cn
+using OP_F32ToF16 = OP_ChannelConvert<cl::sycl::half>;
+/// \brief converts F32Cn to S16Cn
+using OP_F32ToS16 = OP_ChannelConvert<short>;
+/// \brief converts F32Cn to U16Cn
+using OP_F32ToU16 = OP_ChannelConvert<unsigned short>;
+/// \brief converts F16Cn to F32Cn
+using OP_F16ToF32 = OP_ChannelConvert<float>;
+/// \brief converts S16Cn to F32Cn
+using OP_S16ToF32 = OP_ChannelConvert<float>;
+/// \brief converts U16Cn to F32Cn
+using OP_U16ToF32 = OP_ChannelConvert<float>;
+}
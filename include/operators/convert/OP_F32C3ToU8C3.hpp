@@ -23,6 +23,8 @@
 namespace visioncpp {
 /// \brief This functor performs conversion from [0.0f, 1.0f] to [0, 255]
 struct OP_F32C3ToU8C3 {
+  /// the functor is also called on the vectors of W consecutive pixels
+  static constexpr bool vectorised = true;
   /// \param in - three-channel float
   /// \return U8C3 - three-channel unsigned char
   visioncpp::pixel::U8C3 operator()(visioncpp::pixel::F32C3 in) {
@@ -32,5 +34,19 @@ struct OP_F32C3ToU8C3 {
         static_cast<unsigned char>(in[1] * FLOAT_TO_BYTE),
         static_cast<unsigned char>(in[2] * FLOAT_TO_BYTE));
   }
+  /// \param in - three channels of W float
+  /// \return Storage - three channels of W unsigned char
+  template <int W>
+  visioncpp::pixel::Storage<cl::sycl::vec<unsigned char, W>, 3> operator()(
+      visioncpp::pixel::Storage<cl::sycl::vec<float, W>, 3> in) {
+    const float FLOAT_TO_BYTE = 255.0f;
+    return visioncpp::pixel::Storage<cl::sycl::vec<unsigned char, W>, 3>(
+        (in[0] * FLOAT_TO_BYTE)
+            .template convert<unsigned char, cl::sycl::rounding_mode::rtz>(),
+        (in[1] * FLOAT_TO_BYTE)
+            .template convert<unsigned char, cl::sycl::rounding_mode::rtz>(),
+        (in[2] * FLOAT_TO_BYTE)
+            .template convert<unsigned char, cl::sycl::rounding_mode::rtz>());
+  }
 };
 }
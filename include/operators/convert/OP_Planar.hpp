@@ -0,0 +1,58 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_Planar.hpp
+/// \brief it converts an image between the interleaved and the planar layouts
+
+namespace visioncpp {
+/// \brief This functor gathers the pixel (in.I_c, in.I_r) from the N planes of
+/// a planar image. The planes are one below the other in the input, so the
+/// channel k of a pixel is k * Rows rows below the pixel of the first plane.
+/// template parameters:
+/// \tparam N : the number of channels
+template <size_t N>
+struct OP_FromPlanar {
+  /// \param in - the planar image of N * Rows rows
+  /// \return Storage<PixelType, N> - the pixel of N channels
+  template <typename NeighbourT>
+  visioncpp::pixel::Storage<typename NeighbourT::PixelType, N> operator()(
+      NeighbourT &in, float, float) {
+    const size_t rows = in.rows / N;
+    visioncpp::pixel::Storage<typename NeighbourT::PixelType, N> out;
+    for (size_t k = 0; k < N; k++) {
+      out[k] = in.at(in.I_c, in.I_r + k * rows);
+    }
+    return out;
+  }
+};
+
+/// \brief This functor writes the element (in.I_c, in.I_r) of a planar image
+/// from an interleaved image. The row in.I_r of the output belongs to the
+/// plane in.I_r / Rows.
+struct OP_ToPlanar {
+  /// \param in - the interleaved image of Rows rows
+  /// \return data_type - the channel of the plane
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType::data_type operator()(NeighbourT &in, float,
+                                                       float) {
+    const size_t plane = in.I_r / in.rows;
+    return in.at(in.I_c, in.I_r - plane * in.rows)[plane];
+  }
+};
+}
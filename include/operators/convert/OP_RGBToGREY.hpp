@@ -24,6 +24,8 @@ namespace visioncpp {
 /// \brief This functor performs RGB to GREY convertion following rule:
 /// GREY <- 0.299f * R + 0,587f * G + 0.114 * B
 struct OP_RGBToGREY {
+  /// the functor is also called on the vectors of W consecutive pixels
+  static constexpr bool vectorised = true;
   /// \param in - RGB pixel.
   /// \returns float - greyscale value.
   float operator()(visioncpp::pixel::F32C3 in) {
@@ -32,5 +34,12 @@ struct OP_RGBToGREY {
     // luminance , the most accurate one
     return 0.299f * in[0] + 0.587f * in[1] + 0.114f * in[2];
   }
+  /// \param in - RGB channels of W pixels.
+  /// \returns vec - greyscale values of the W pixels.
+  template <int W>
+  cl::sycl::vec<float, W> operator()(
+      visioncpp::pixel::Storage<cl::sycl::vec<float, W>, 3> in) {
+    return 0.299f * in[0] + 0.587f * in[1] + 0.114f * in[2];
+  }
 };
 }
@@ -23,6 +23,8 @@
 namespace visioncpp {
 /// \brief This functor performs conversion from [0, 255] to [0.0f, 1.0f]
 struct OP_U8C3ToF32C3 {
+  /// the functor is also called on the vectors of W consecutive pixels
+  static constexpr bool vectorised = true;
   /// \param in - three-channel unsigned char
   /// \return F32C3 - three-channel float
   visioncpp::pixel::F32C3 operator()(visioncpp::pixel::U8C3 in) {
@@ -32,5 +34,16 @@ struct OP_U8C3ToF32C3 {
                                    static_cast<float>(in[1] * BYTE_TO_FLOAT),
                                    static_cast<float>(in[2] * BYTE_TO_FLOAT));
   }
+  /// \param in - three channels of W unsigned char
+  /// \return Storage - three channels of W float
+  template <int W>
+  visioncpp::pixel::Storage<cl::sycl::vec<float, W>, 3> operator()(
+      visioncpp::pixel::Storage<cl::sycl::vec<unsigned char, W>, 3> in) {
+    const float BYTE_TO_FLOAT = 1.0f / 255.0f;
+    return visioncpp::pixel::Storage<cl::sycl::vec<float, W>, 3>(
+        in[0].template convert<float>() * BYTE_TO_FLOAT,
+        in[1].template convert<float>() * BYTE_TO_FLOAT,
+        in[2].template convert<float>() * BYTE_TO_FLOAT);
+  }
 };
 }
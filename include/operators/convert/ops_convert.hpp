@@ -24,9 +24,11 @@
 #define VISIONCPP_INCLUDE_OPERATORS_CONVERT_OPS_CONVERT_HPP_
 
 #include "OP_BGRToRGB.hpp"
+#include "OP_ChannelConvert.hpp"
 #include "OP_F32C3ToU8C3.hpp"
 #include "OP_HSVToRGB.hpp"
 #include "OP_HSVToU8C3.hpp"
+#include "OP_Planar.hpp"
 #include "OP_RGBToBGR.hpp"
 #include "OP_RGBToGREY.hpp"
 #include "OP_RGBToHSV.hpp"
@@ -0,0 +1,56 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_BoxSum.hpp
+/// \brief This file contains the sum of a box read from an integral image.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_CONVOLUTION_OP_BOXSUM_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_CONVOLUTION_OP_BOXSUM_HPP_
+
+namespace visioncpp {
+/// \struct OP_BoxSum
+/// \brief computes the sum of the input pixels in the box from Left columns on
+/// the left to Right columns on the right and from Top rows above to Bottom
+/// rows below the pixel. The neighbour is the integral image of the input, so
+/// only the four corners of the box are read whatever its size. It is used by
+/// box_sum which reads the integral image with border::Integral.
+/// template parameters:
+/// \tparam Top: the number of rows of the box above the pixel
+/// \tparam Left: the number of columns of the box on the left of the pixel
+/// \tparam Bottom: the number of rows of the box below the pixel
+/// \tparam Right: the number of columns of the box on the right of the pixel
+template <size_t Top, size_t Left, size_t Bottom, size_t Right>
+struct OP_BoxSum {
+  /// \param nbr - the integral image
+  /// \return PixelType - the sum of the box
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &nbr) {
+    const int c0 = nbr.I_c - static_cast<int>(Left) - 1;
+    const int c1 = nbr.I_c + static_cast<int>(Right);
+    const int r0 = nbr.I_r - static_cast<int>(Top) - 1;
+    const int r1 = nbr.I_r + static_cast<int>(Bottom);
+    typename NeighbourT::PixelType sum = nbr.at(c1, r1);
+    sum -= nbr.at(c0, r1);
+    sum -= nbr.at(c1, r0);
+    sum += nbr.at(c0, r0);
+    return sum;
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_CONVOLUTION_OP_BOXSUM_HPP_
@@ -0,0 +1,365 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_GaussianBlur.hpp
+/// \brief This file contains the separable Gaussian blur of any radius. The
+/// horizontal and the vertical passes add the two pixels at the same distance
+/// of the centre before multiplying them by their shared tap, so a window of
+/// 2 * Radius + 1 pixels costs Radius + 1 multiplies per pass. Each channel is
+/// accumulated in float and the unsigned char channels are rounded and
+/// saturated once, at the end of each pass.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_CONVOLUTION_OP_GAUSSIANBLUR_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_CONVOLUTION_OP_GAUSSIANBLUR_HPP_
+
+#include <cmath>
+#include <ratio>
+
+namespace visioncpp {
+/// \brief the default sigma of a Gaussian of radius Radius. It is the sigma
+/// used by OpenCV when the sigma is not given: 0.3 * (Radius - 1) + 0.8.
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+template <size_t Radius>
+using DefaultGaussianSigma = std::ratio<3 * Radius + 5, 10>;
+
+namespace internal {
+/// function gaussian_exp_series
+/// \brief the Taylor series of exp(x) used to compute the taps at compile time.
+/// It is only accurate for small x, see gaussian_exp.
+/// \param x : the exponent
+/// \param n : the index of the next term
+/// \param term : the current term of the series
+/// \param sum : the sum of the series so far
+/// \return double
+constexpr double gaussian_exp_series(double x, int n, double term,
+                                     double sum) {
+  return n > 16 ? sum : gaussian_exp_series(x, n + 1, term * x / n,
+                                            sum + term * x / n);
+}
+/// function gaussian_exp_square
+/// \brief squares v n times
+/// \param v : the value to square
+/// \param n : the number of squaring left
+/// \return double
+constexpr double gaussian_exp_square(double v, int n) {
+  return n == 0 ? v : gaussian_exp_square(v * v, n - 1);
+}
+/// function gaussian_exp
+/// \brief a constexpr exp(x) for x <= 0. The series is evaluated on x / 1024
+/// and the result is squared 10 times. The exponents under -128 are rounded
+/// to 0, as they are already 0 once converted to float.
+/// \param x : the exponent
+/// \return double
+constexpr double gaussian_exp(double x) {
+  return x < -128.0
+             ? 0.0
+             : gaussian_exp_square(
+                   gaussian_exp_series(x / 1024.0, 1, 1.0, 1.0), 10);
+}
+/// function gaussian_weight
+/// \brief the weight of the Gaussian, not normalised, at the distance k of the
+/// centre
+/// \param k : the distance of the centre
+/// \param sigma : the sigma of the Gaussian
+/// \return double
+constexpr double gaussian_weight(size_t k, double sigma) {
+  return gaussian_exp(-double(k * k) / (2.0 * sigma * sigma));
+}
+/// function gaussian_weight_sum
+/// \brief the sum of the weights of the window from the distance k to Radius.
+/// The weights of distance k > 0 are counted twice as they appear on both
+/// sides of the centre.
+/// \param k : the distance of the centre
+/// \param radius : the radius of the window
+/// \param sigma : the sigma of the Gaussian
+/// \return double
+constexpr double gaussian_weight_sum(size_t k, size_t radius, double sigma) {
+  return k > radius ? 0.0
+                    : (k == 0 ? 1.0 : 2.0) * gaussian_weight(k, sigma) +
+                          gaussian_weight_sum(k + 1, radius, sigma);
+}
+/// function gaussian_tap
+/// \brief the normalised tap of the Gaussian at the distance k of the centre.
+/// The 2 * Radius + 1 taps of the window sum to 1.
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+/// \tparam Sigma: the sigma of the Gaussian as a std::ratio
+/// function parameters:
+/// \param k : the distance of the centre
+/// \return float
+template <size_t Radius, typename Sigma>
+constexpr float gaussian_tap(size_t k) {
+  return static_cast<float>(
+      gaussian_weight(k, double(Sigma::num) / Sigma::den) /
+      gaussian_weight_sum(0, Radius, double(Sigma::num) / Sigma::den));
+}
+
+/// \brief the value of a channel of a blurred pixel
+template <typename Scalar>
+inline Scalar gaussian_cast(float v) {
+  return static_cast<Scalar>(v);
+}
+/// \brief the value of an unsigned char channel of a blurred pixel. It is
+/// rounded and saturated as in OpenCV.
+template <>
+inline unsigned char gaussian_cast<unsigned char>(float v) {
+  return static_cast<unsigned char>(cl::sycl::clamp(v + 0.5f, 0.0f, 255.0f));
+}
+/// \struct GaussianPixel
+/// \brief GaussianPixel is used to access each channel of the pixels read by
+/// the blur. Each channel is accumulated in float, so the sums of unsigned
+/// char pixels neither wrap nor are truncated before the end.
+/// template parameters
+/// \tparam T the pixel type
+template <typename T>
+struct GaussianPixel {
+  using Scalar = typename T::data_type;
+  static constexpr size_t Channels = T::elements;
+  static inline float get(const T &p, size_t ch) { return p[ch]; }
+  static inline void set(T &p, size_t ch, float v) {
+    p[ch] = gaussian_cast<Scalar>(v);
+  }
+};
+/// \brief specialisation of GaussianPixel when the pixel is a float
+template <>
+struct GaussianPixel<float> {
+  static constexpr size_t Channels = 1;
+  static inline float get(const float &p, size_t) { return p; }
+  static inline void set(float &p, size_t, float v) { p = v; }
+};
+/// \brief specialisation of GaussianPixel when the pixel is an unsigned char
+template <>
+struct GaussianPixel<unsigned char> {
+  static constexpr size_t Channels = 1;
+  static inline float get(const unsigned char &p, size_t) { return p; }
+  static inline void set(unsigned char &p, size_t, float v) {
+    p = gaussian_cast<unsigned char>(v);
+  }
+};
+/// function gaussian_add
+/// \brief adds the pair of pixels a and b weighted by their shared tap to
+/// the channels of acc
+/// \param a : the first pixel of the pair
+/// \param b : the second pixel of the pair
+/// \param w : the tap
+/// \param acc : the accumulated channels
+/// \return void
+template <typename PixelT>
+inline void gaussian_add(const PixelT &a, const PixelT &b, float w,
+                         float (&acc)[GaussianPixel<PixelT>::Channels]) {
+  using Pixel = GaussianPixel<PixelT>;
+  for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+    acc[ch] += w * (Pixel::get(a, ch) + Pixel::get(b, ch));
+  }
+}
+/// function gaussian_centre
+/// \brief initialises the channels of acc with the centre pixel weighted by
+/// its tap
+/// \param p : the centre pixel
+/// \param w : the tap
+/// \param acc : the accumulated channels
+/// \return void
+template <typename PixelT>
+inline void gaussian_centre(const PixelT &p, float w,
+                            float (&acc)[GaussianPixel<PixelT>::Channels]) {
+  using Pixel = GaussianPixel<PixelT>;
+  for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+    acc[ch] = w * Pixel::get(p, ch);
+  }
+}
+/// function gaussian_pixel
+/// \brief the blurred pixel made of the accumulated channels, each one being
+/// rounded and saturated once
+/// \param acc : the accumulated channels
+/// \return PixelT
+template <typename PixelT>
+inline PixelT gaussian_pixel(
+    const float (&acc)[GaussianPixel<PixelT>::Channels]) {
+  using Pixel = GaussianPixel<PixelT>;
+  PixelT out{};
+  for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+    Pixel::set(out, ch, acc[ch]);
+  }
+  return out;
+}
+
+/// \struct GaussianFold
+/// \brief GaussianFold unrolls the symmetric taps of the window from the
+/// distance K down to 1. The taps are compile time constants.
+/// template parameters:
+/// \tparam K: the distance of the centre of the current pair of pixels
+/// \tparam Radius: the radius of the Gaussian window
+/// \tparam Sigma: the sigma of the Gaussian as a std::ratio
+template <size_t K, size_t Radius, typename Sigma>
+struct GaussianFold {
+  /// function horizontal
+  /// \brief accumulates the pairs of pixels on the left and the right of the
+  /// centre
+  /// \param nbr : the input neighbour
+  /// \param acc : the accumulated channels
+  /// \return void
+  template <typename NeighbourT, size_t N>
+  static inline void horizontal(NeighbourT &nbr, float (&acc)[N]) {
+    constexpr float w = gaussian_tap<Radius, Sigma>(K);
+    gaussian_add(nbr.at(nbr.I_c - static_cast<int>(K), nbr.I_r),
+                 nbr.at(nbr.I_c + static_cast<int>(K), nbr.I_r), w, acc);
+    GaussianFold<K - 1, Radius, Sigma>::horizontal(nbr, acc);
+  }
+  /// function vertical
+  /// \brief accumulates the pairs of pixels above and below the centre
+  /// \param nbr : the input neighbour
+  /// \param acc : the accumulated channels
+  /// \return void
+  template <typename NeighbourT, size_t N>
+  static inline void vertical(NeighbourT &nbr, float (&acc)[N]) {
+    constexpr float w = gaussian_tap<Radius, Sigma>(K);
+    gaussian_add(nbr.at(nbr.I_c, nbr.I_r - static_cast<int>(K)),
+                 nbr.at(nbr.I_c, nbr.I_r + static_cast<int>(K)), w, acc);
+    GaussianFold<K - 1, Radius, Sigma>::vertical(nbr, acc);
+  }
+};
+/// \brief specialisation of GaussianFold ending the recursion at the centre,
+/// which is not part of a pair.
+template <size_t Radius, typename Sigma>
+struct GaussianFold<0, Radius, Sigma> {
+  template <typename NeighbourT, size_t N>
+  static inline void horizontal(NeighbourT &, float (&)[N]) {}
+  template <typename NeighbourT, size_t N>
+  static inline void vertical(NeighbourT &, float (&)[N]) {}
+};
+}  // internal
+
+/// function gaussian_taps
+/// \brief computes on the host the Radius + 1 normalised taps of a Gaussian
+/// whose sigma is only known at run time. taps[0] is the tap of the centre and
+/// taps[k] the tap shared by the two pixels at the distance k. The array is
+/// read by OP_GaussianBlurRowTaps and OP_GaussianBlurColTaps through a
+/// constant terminal of Radius + 1 columns and 1 row.
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+/// function parameters:
+/// \param sigma : the sigma of the Gaussian
+/// \param taps : the output array of Radius + 1 elements
+/// \return void
+template <size_t Radius>
+inline void gaussian_taps(float sigma, float *taps) {
+  double w[Radius + 1];
+  double sum = 0.0;
+  for (size_t k = 0; k <= Radius; k++) {
+    w[k] = std::exp(-double(k * k) / (2.0 * sigma * sigma));
+    sum += (k == 0 ? 1.0 : 2.0) * w[k];
+  }
+  for (size_t k = 0; k <= Radius; k++) {
+    taps[k] = static_cast<float>(w[k] / sum);
+  }
+}
+
+/// \struct OP_GaussianBlurRow
+/// \brief the horizontal pass of the separable Gaussian blur. The taps are
+/// generated at compile time from the Radius and the Sigma. Each channel of
+/// the pixel is filtered with the same taps.
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+/// \tparam Sigma: the sigma of the Gaussian as a std::ratio
+template <size_t Radius, typename Sigma = DefaultGaussianSigma<Radius>>
+struct OP_GaussianBlurRow {
+  /// \param nbr - Input image
+  /// \return PixelType - the horizontally blurred pixel
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &nbr) {
+    using PixelT = typename NeighbourT::PixelType;
+    float acc[internal::GaussianPixel<PixelT>::Channels];
+    internal::gaussian_centre(nbr.at(nbr.I_c, nbr.I_r),
+                              internal::gaussian_tap<Radius, Sigma>(0), acc);
+    internal::GaussianFold<Radius, Radius, Sigma>::horizontal(nbr, acc);
+    return internal::gaussian_pixel<PixelT>(acc);
+  }
+};
+
+/// \struct OP_GaussianBlurCol
+/// \brief the vertical pass of the separable Gaussian blur. The taps are
+/// generated at compile time from the Radius and the Sigma.
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+/// \tparam Sigma: the sigma of the Gaussian as a std::ratio
+template <size_t Radius, typename Sigma = DefaultGaussianSigma<Radius>>
+struct OP_GaussianBlurCol {
+  /// \param nbr - Input image
+  /// \return PixelType - the vertically blurred pixel
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &nbr) {
+    using PixelT = typename NeighbourT::PixelType;
+    float acc[internal::GaussianPixel<PixelT>::Channels];
+    internal::gaussian_centre(nbr.at(nbr.I_c, nbr.I_r),
+                              internal::gaussian_tap<Radius, Sigma>(0), acc);
+    internal::GaussianFold<Radius, Radius, Sigma>::vertical(nbr, acc);
+    return internal::gaussian_pixel<PixelT>(acc);
+  }
+};
+
+/// \struct OP_GaussianBlurRowTaps
+/// \brief the horizontal pass of the separable Gaussian blur when the sigma is
+/// only known at run time. The Radius + 1 taps are read from the filter, see
+/// gaussian_taps.
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+template <size_t Radius>
+struct OP_GaussianBlurRowTaps {
+  /// \param nbr - Input image
+  /// \param taps - the taps computed by gaussian_taps
+  /// \return PixelType - the horizontally blurred pixel
+  template <typename NeighbourT, typename FilterT>
+  typename NeighbourT::PixelType operator()(NeighbourT &nbr, FilterT &taps) {
+    using PixelT = typename NeighbourT::PixelType;
+    float acc[internal::GaussianPixel<PixelT>::Channels];
+    internal::gaussian_centre(nbr.at(nbr.I_c, nbr.I_r), taps.at(0, 0), acc);
+    for (int k = 1; k <= static_cast<int>(Radius); k++) {
+      internal::gaussian_add(nbr.at(nbr.I_c - k, nbr.I_r),
+                             nbr.at(nbr.I_c + k, nbr.I_r), taps.at(k, 0), acc);
+    }
+    return internal::gaussian_pixel<PixelT>(acc);
+  }
+};
+
+/// \struct OP_GaussianBlurColTaps
+/// \brief the vertical pass of the separable Gaussian blur when the sigma is
+/// only known at run time. The Radius + 1 taps are read from the filter, see
+/// gaussian_taps.
+/// template parameters:
+/// \tparam Radius: the radius of the Gaussian window
+template <size_t Radius>
+struct OP_GaussianBlurColTaps {
+  /// \param nbr - Input image
+  /// \param taps - the taps computed by gaussian_taps
+  /// \return PixelType - the vertically blurred pixel
+  template <typename NeighbourT, typename FilterT>
+  typename NeighbourT::PixelType operator()(NeighbourT &nbr, FilterT &taps) {
+    using PixelT = typename NeighbourT::PixelType;
+    float acc[internal::GaussianPixel<PixelT>::Channels];
+    internal::gaussian_centre(nbr.at(nbr.I_c, nbr.I_r), taps.at(0, 0), acc);
+    for (int k = 1; k <= static_cast<int>(Radius); k++) {
+      internal::gaussian_add(nbr.at(nbr.I_c, nbr.I_r - k),
+                             nbr.at(nbr.I_c, nbr.I_r + k), taps.at(k, 0), acc);
+    }
+    return internal::gaussian_pixel<PixelT>(acc);
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_CONVOLUTION_OP_GAUSSIANBLUR_HPP_
@@ -23,7 +23,9 @@
 #ifndef VISIONCPP_INCLUDE_OPERATORS_CONVOLUTION_OPS_CONV_HPP_
 #define VISIONCPP_INCLUDE_OPERATORS_CONVOLUTION_OPS_CONV_HPP_
 
+#include "OP_BoxSum.hpp"
 #include "OP_Filter2D.hpp"
+#include "OP_GaussianBlur.hpp"
 #include "OP_GaussianBlur3x3.hpp"
 #include "OP_SepFilter.hpp"
 #include "OP_SepGauss3x3.hpp"
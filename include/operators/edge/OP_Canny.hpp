@@ -0,0 +1,189 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_Canny.hpp
+/// \brief This file contains the functors of the Canny edge detector. The
+/// gradient, the non maximum suppression and the double threshold are
+/// neighbour operations fused in one kernel, and the hysteresis grows the
+/// strong edges through the weak ones until nothing changes, see canny.hpp.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_EDGE_OP_CANNY_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_EDGE_OP_CANNY_HPP_
+
+#include "../reduction/OP_Reduce.hpp"
+
+namespace visioncpp {
+namespace internal {
+/// \brief the classes of the pixels after the double threshold
+namespace canny_class {
+constexpr static unsigned char None = 0;
+constexpr static unsigned char Weak = 1;
+constexpr static unsigned char Strong = 2;
+};
+
+/// function canny_squared
+/// \brief the square of a threshold given as a std::ratio. The magnitudes
+/// are compared squared, so no square root is computed.
+/// \tparam Ratio: the threshold
+/// \return float
+template <typename Ratio>
+constexpr float canny_squared() {
+  return (static_cast<float>(Ratio::num) * Ratio::num) /
+         (static_cast<float>(Ratio::den) * Ratio::den);
+}
+
+/// function canny_magnitude
+/// \brief the squared magnitude of a gradient pixel (gx, gy)
+/// \param p : the gradient pixel
+/// \return float
+inline float canny_magnitude(const pixel::F32C2 &p) {
+  return p[0] * p[0] + p[1] * p[1];
+}
+}  // internal
+
+/// \struct OP_SobelGradient
+/// \brief the horizontal and the vertical 3x3 Sobel derivatives of the first
+/// channel of the image, computed together so the window is read once.
+struct OP_SobelGradient {
+  static constexpr size_t Radius = 1;
+  /// \param nbr - Input image
+  /// \return F32C2 - the gradient (gx, gy) of the pixel
+  template <typename NeighbourT>
+  pixel::F32C2 operator()(NeighbourT &nbr) {
+    const int c = nbr.I_c;
+    const int r = nbr.I_r;
+    float tl = internal::first_channel(nbr.at(c - 1, r - 1));
+    float tm = internal::first_channel(nbr.at(c, r - 1));
+    float tr = internal::first_channel(nbr.at(c + 1, r - 1));
+    float ml = internal::first_channel(nbr.at(c - 1, r));
+    float mr = internal::first_channel(nbr.at(c + 1, r));
+    float bl = internal::first_channel(nbr.at(c - 1, r + 1));
+    float bm = internal::first_channel(nbr.at(c, r + 1));
+    float br = internal::first_channel(nbr.at(c + 1, r + 1));
+    return pixel::F32C2((tr + 2.0f * mr + br) - (tl + 2.0f * ml + bl),
+                        (bl + 2.0f * bm + br) - (tl + 2.0f * tm + tr));
+  }
+};
+
+/// \struct OP_CannySuppress
+/// \brief the non maximum suppression and the double threshold of the Canny
+/// edge detector. The direction of the gradient is quantised to 0, 45, 90 or
+/// 135 degrees and the pixel is kept when its magnitude is a maximum along
+/// it. A kept pixel is strong above High, weak above Low and none otherwise.
+/// As in OpenCV, the neighbours outside of the image have a magnitude of 0,
+/// whatever the border policy and whether or not the gradient is fused.
+/// template parameters:
+/// \tparam Low: the low threshold of the gradient magnitude as a std::ratio
+/// \tparam High: the high threshold of the gradient magnitude as a std::ratio
+template <typename Low, typename High>
+struct OP_CannySuppress {
+  static constexpr size_t Radius = 1;
+  /// \param nbr - the gradient image of OP_SobelGradient
+  /// \return U8C1 - the class of the pixel
+  template <typename NeighbourT>
+  pixel::U8C1 operator()(NeighbourT &nbr) {
+    const int c = nbr.I_c;
+    const int r = nbr.I_r;
+    const pixel::F32C2 g = nbr.at(c, r);
+    const float m = internal::canny_magnitude(g);
+    if (m <= internal::canny_squared<Low>()) {
+      return internal::canny_class::None;
+    }
+    // tan(22.5) and tan(67.5) bound the sectors of the directions
+    const float ax = cl::sycl::fabs(g[0]);
+    const float ay = cl::sycl::fabs(g[1]);
+    int dc = 1;
+    int dr = 0;
+    if (ay > ax * 2.41421356f) {
+      dc = 0;
+      dr = 1;
+    } else if (ay > ax * 0.41421356f) {
+      // the rows grow downwards, so (1, 1) follows gx * gy > 0
+      dc = (g[0] * g[1] < 0.0f) ? -1 : 1;
+      dr = 1;
+    }
+    const float before =
+        nbr.inside(c - dc, r - dr)
+            ? internal::canny_magnitude(nbr.at(c - dc, r - dr))
+            : 0.0f;
+    const float after = nbr.inside(c + dc, r + dr)
+                            ? internal::canny_magnitude(nbr.at(c + dc, r + dr))
+                            : 0.0f;
+    // as in OpenCV, a tie along a diagonal suppresses the pixel
+    const bool diagonal = dc != 0 && dr != 0;
+    if (m <= before || m < after || (diagonal && m == after)) {
+      return internal::canny_class::None;
+    }
+    return (m > internal::canny_squared<High>())
+               ? internal::canny_class::Strong
+               : internal::canny_class::Weak;
+  }
+};
+
+/// \struct OP_CannyGrow
+/// \brief one step of the hysteresis: a weak pixel becomes strong when one of
+/// its 8 neighbours is strong.
+struct OP_CannyGrow {
+  static constexpr size_t Radius = 1;
+  /// \param nbr - the classes of the pixels
+  /// \return U8C1 - the new class of the pixel
+  template <typename NeighbourT>
+  pixel::U8C1 operator()(NeighbourT &nbr) {
+    const int c = nbr.I_c;
+    const int r = nbr.I_r;
+    const pixel::U8C1 p = nbr.at(c, r);
+    if (p[0] != internal::canny_class::Weak) {
+      return p;
+    }
+    for (int j = -1; j <= 1; j++) {
+      for (int i = -1; i <= 1; i++) {
+        if (nbr.at(c + i, r + j)[0] == internal::canny_class::Strong) {
+          return internal::canny_class::Strong;
+        }
+      }
+    }
+    return p;
+  }
+};
+
+/// \struct OP_CannyChanged
+/// \brief 1 where two images of classes differ and 0 elsewhere. Its maximum
+/// tells whether a hysteresis step changed the image.
+struct OP_CannyChanged {
+  /// \param t1 - First image
+  /// \param t2 - Second image
+  /// \return float - 1 when the pixels differ
+  template <typename T>
+  float operator()(T t1, T t2) {
+    return (t1[0] != t2[0]) ? 1.0f : 0.0f;
+  }
+};
+
+/// \struct OP_CannyEdge
+/// \brief 255 for the strong pixels, which are the edges, and 0 elsewhere
+struct OP_CannyEdge {
+  /// \param t - the class of the pixel
+  /// \return U8C1 - the edge map
+  template <typename T>
+  pixel::U8C1 operator()(T t) {
+    return (t[0] == internal::canny_class::Strong) ? 255 : 0;
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_EDGE_OP_CANNY_HPP_
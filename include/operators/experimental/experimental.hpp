@@ -28,7 +28,6 @@
 #include "OP_AniDiff.hpp"
 #include "OP_Div.hpp"
 #include "OP_FloatToF32C3.hpp"
-#include "OP_Median.hpp"
 #include "OP_Merge2Chns.hpp"
 #include "OP_Mul.hpp"
 #include "OP_PowerOf2.hpp"
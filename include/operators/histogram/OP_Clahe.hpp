@@ -0,0 +1,118 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_Clahe.hpp
+/// \brief This file contains the operators of the contrast limited adaptive
+/// histogram equalisation (CLAHE).
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_HISTOGRAM_OP_CLAHE_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_HISTOGRAM_OP_CLAHE_HPP_
+
+#include <ratio>
+
+namespace visioncpp {
+/// \struct OP_ClaheLut
+/// \brief computes the look up tables of the CLAHE from the histograms of the
+/// tiles. It is a global operation with one thread per bin and tile. As in
+/// OpenCV, each histogram is clipped at ClipLimit * TilePixels / Bins, the
+/// pixels above the clip are redistributed over all the bins and the table is
+/// the cumulative histogram scaled to [0, 1].
+/// template parameters:
+/// \tparam TilePixels: the number of pixels of a tile
+/// \tparam ClipLimit: the clip limit as a std::ratio, relative to the height
+/// of a flat histogram
+template <size_t TilePixels, typename ClipLimit>
+struct OP_ClaheLut {
+  /// \param nbr - the histograms, one row per tile
+  /// \return float - the value in [0, 1] of the bin nbr.I_c of the tile
+  /// nbr.I_r
+  template <typename NeighbourT>
+  float operator()(NeighbourT &nbr) {
+    const size_t bins = nbr.cols;
+    const size_t clip_value =
+        (ClipLimit::num * TilePixels) / (ClipLimit::den * bins);
+    const unsigned int clip =
+        static_cast<unsigned int>((clip_value > 1) ? clip_value : 1);
+    unsigned int excess = 0;
+    unsigned int cdf = 0;
+    for (size_t b = 0; b < bins; b++) {
+      const unsigned int count = nbr.at(b, nbr.I_r);
+      excess += (count > clip) ? count - clip : 0;
+      cdf += (b <= nbr.I_c) ? ((count > clip) ? clip : count) : 0;
+    }
+    // each bin receives the same share of the excess, the residual is spread
+    // over the bins every step bins
+    const unsigned int batch = excess / bins;
+    const unsigned int residual = excess - batch * bins;
+    const size_t step =
+        (residual > 0 && bins / residual > 1) ? bins / residual : 1;
+    const size_t extra = (residual > 0) ? (nbr.I_c / step + 1) : 0;
+    cdf += batch * (nbr.I_c + 1) +
+           static_cast<unsigned int>((extra < residual) ? extra : residual);
+    const float v = static_cast<float>(cdf) / static_cast<float>(TilePixels);
+    return (v < 1.0f) ? v : 1.0f;
+  }
+};
+
+/// \struct OP_Clahe
+/// \brief maps each pixel with the look up tables of the four tiles around it.
+/// The value of each table is weighted by the distance of the pixel to the
+/// centre of the tile, so there is no seam between the tiles. The pixels
+/// between the centre of a border tile and the border of the image only use
+/// the tables of the border tiles. It is used with lookup_operation.
+/// template parameters:
+/// \tparam Bins: the number of bins of the histograms
+/// \tparam TilesC: the number of tiles in the column dimension
+/// \tparam TilesR: the number of tiles in the row dimension
+/// \tparam TileCols: the column size of a tile
+/// \tparam TileRows: the row size of a tile
+template <size_t Bins, size_t TilesC, size_t TilesR, size_t TileCols,
+          size_t TileRows>
+struct OP_Clahe {
+  /// \param in - the pixel
+  /// \param lut - the look up tables, one row per tile
+  /// \param c - the column of the pixel
+  /// \param r - the row of the pixel
+  /// \return T - the equalised pixel
+  template <typename T, typename TableT>
+  T operator()(const T &in, TableT &lut, size_t c, size_t r) {
+    // the position of the pixel relative to the centres of the tiles, as
+    // computed by OpenCV
+    const float fx = static_cast<float>(c) / TileCols - 0.5f;
+    const float fy = static_cast<float>(r) / TileRows - 0.5f;
+    const int tx = static_cast<int>(cl::sycl::floor(fx));
+    const int ty = static_cast<int>(cl::sycl::floor(fy));
+    const float ax = fx - tx;
+    const float ay = fy - ty;
+    const int tx0 = (tx < 0) ? 0 : tx;
+    const int ty0 = (ty < 0) ? 0 : ty;
+    const int tx1 = (tx + 1 < static_cast<int>(TilesC)) ? tx + 1 : TilesC - 1;
+    const int ty1 = (ty + 1 < static_cast<int>(TilesR)) ? ty + 1 : TilesR - 1;
+    const size_t b = internal::histogram_bin<Bins>(in);
+    const float v00 = lut.at(b, ty0 * TilesC + tx0);
+    const float v10 = lut.at(b, ty0 * TilesC + tx1);
+    const float v01 = lut.at(b, ty1 * TilesC + tx0);
+    const float v11 = lut.at(b, ty1 * TilesC + tx1);
+    const float top = v00 + ax * (v10 - v00);
+    const float bottom = v01 + ax * (v11 - v01);
+    return internal::histogram_value(in, top + ay * (bottom - top));
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_HISTOGRAM_OP_CLAHE_HPP_
@@ -0,0 +1,110 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_EqualizeHist.hpp
+/// \brief This file contains the histogram equalisation operators and the
+/// bins of the pixels counted by the histogram node.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_HISTOGRAM_OP_EQUALIZEHIST_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_HISTOGRAM_OP_EQUALIZEHIST_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief the bin of a float value in [0, 1]. The values outside of [0, 1]
+/// are counted in the first or the last bin.
+template <size_t Bins>
+inline size_t histogram_bin(float v) {
+  const size_t b = (v > 0.0f) ? static_cast<size_t>(v * Bins) : 0;
+  return (b < Bins) ? b : Bins - 1;
+}
+/// \brief the bin of an unsigned char value in [0, 255]
+template <size_t Bins>
+inline size_t histogram_bin(unsigned char v) {
+  return (static_cast<size_t>(v) * Bins) >> 8;
+}
+/// \brief the bin of a single channel pixel
+template <size_t Bins, typename T>
+inline size_t histogram_bin(const pixel::Storage<T, 1> &p) {
+  return histogram_bin<Bins>(p[0]);
+}
+
+/// \brief the float pixel of a value v in [0, 1]
+inline float histogram_value(float, float v) { return v; }
+/// \brief the unsigned char pixel of a value v in [0, 1]
+inline unsigned char histogram_value(unsigned char, float v) {
+  return static_cast<unsigned char>(v * 255.0f + 0.5f);
+}
+/// \brief the single channel pixel of a value v in [0, 1]
+template <typename T>
+inline pixel::Storage<T, 1> histogram_value(const pixel::Storage<T, 1> &,
+                                            float v) {
+  return pixel::Storage<T, 1>(histogram_value(T(), v));
+}
+}  // internal
+
+/// \struct OP_EqualizeLut
+/// \brief computes the look up table of the histogram equalisation of an
+/// image of Pixels pixels from its histogram. It is a global operation of one
+/// thread per bin, each one summing the bins up to its own. As in OpenCV, the
+/// first non empty bin is mapped to 0 and the last one to 1, so the table is
+/// (cdf(b) - cdf_min) / (Pixels - cdf_min). An image of a single value keeps
+/// its value.
+/// template parameters:
+/// \tparam Pixels: the number of pixels of the image
+template <size_t Pixels>
+struct OP_EqualizeLut {
+  /// \param nbr - the histogram
+  /// \return float - the equalised value in [0, 1] of the bin nbr.I_c
+  template <typename NeighbourT>
+  float operator()(NeighbourT &nbr) {
+    unsigned int cdf = 0;
+    unsigned int cdf_min = 0;
+    for (size_t b = 0; b < nbr.cols; b++) {
+      const unsigned int count = nbr.at(b);
+      cdf_min = (cdf_min == 0) ? count : cdf_min;
+      cdf += (b <= nbr.I_c) ? count : 0;
+    }
+    if (cdf_min == Pixels) {
+      return static_cast<float>(nbr.I_c) / static_cast<float>(nbr.cols - 1);
+    }
+    // the bins before the first non empty bin are mapped to 0
+    return static_cast<float>((cdf > cdf_min) ? cdf - cdf_min : 0) /
+           static_cast<float>(Pixels - cdf_min);
+  }
+};
+
+/// \struct OP_EqualizeHist
+/// \brief maps each pixel to the value of its bin in the look up table of
+/// OP_EqualizeLut. It is used with lookup_operation for float pixels in
+/// [0, 1], unsigned char pixels and the single channel pixels of them.
+/// template parameters:
+/// \tparam Bins: the number of bins of the histogram
+template <size_t Bins>
+struct OP_EqualizeHist {
+  /// \param in - the pixel
+  /// \param lut - the look up table
+  /// \return T - the equalised pixel
+  template <typename T, typename TableT>
+  T operator()(const T &in, TableT &lut, size_t, size_t) {
+    return internal::histogram_value(in,
+                                     lut.at(internal::histogram_bin<Bins>(in)));
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_HISTOGRAM_OP_EQUALIZEHIST_HPP_
@@ -0,0 +1,184 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_Median.hpp
+/// \brief This file contains the median filters of 3x3 and 5x5 windows. The
+/// median is selected by a sorting network, a fixed sequence of compare and
+/// exchange made of min and max, so there is no branch depending on the
+/// pixels.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_MEDIAN_OP_MEDIAN_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_MEDIAN_OP_MEDIAN_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct MedianPixel
+/// \brief MedianPixel is used to access each channel of the pixels read by a
+/// median filter, as the median is computed on each channel separately.
+/// template parameters
+/// \tparam T the pixel type
+template <typename T>
+struct MedianPixel {
+  using Scalar = typename T::data_type;
+  static constexpr size_t Channels = T::elements;
+  static inline Scalar get(const T &p, size_t ch) { return p[ch]; }
+  static inline void set(T &p, size_t ch, Scalar v) { p[ch] = v; }
+};
+/// \brief specialisation of MedianPixel when the pixel is a float
+template <>
+struct MedianPixel<float> {
+  using Scalar = float;
+  static constexpr size_t Channels = 1;
+  static inline Scalar get(const float &p, size_t) { return p; }
+  static inline void set(float &p, size_t, Scalar v) { p = v; }
+};
+/// \brief specialisation of MedianPixel when the pixel is an unsigned char
+template <>
+struct MedianPixel<unsigned char> {
+  using Scalar = unsigned char;
+  static constexpr size_t Channels = 1;
+  static inline Scalar get(const unsigned char &p, size_t) { return p; }
+  static inline void set(unsigned char &p, size_t, Scalar v) { p = v; }
+};
+/// function sort2
+/// \brief the compare and exchange of a sorting network. After the call a is
+/// the smallest and b the largest of the two values.
+/// \param a : the first value
+/// \param b : the second value
+/// \return void
+template <typename T>
+static inline void sort2(T &a, T &b) {
+  const T lo = cl::sycl::min(a, b);
+  b = cl::sycl::max(a, b);
+  a = lo;
+}
+/// function median9
+/// \brief selects the median of 9 values with 19 compare and exchange
+/// \param v : the values, they are partially sorted by the function
+/// \return T
+template <typename T>
+static inline T median9(T (&v)[9]) {
+  sort2(v[1], v[2]); sort2(v[4], v[5]); sort2(v[7], v[8]);
+  sort2(v[0], v[1]); sort2(v[3], v[4]); sort2(v[6], v[7]);
+  sort2(v[1], v[2]); sort2(v[4], v[5]); sort2(v[7], v[8]);
+  sort2(v[0], v[3]); sort2(v[5], v[8]); sort2(v[4], v[7]);
+  sort2(v[3], v[6]); sort2(v[1], v[4]); sort2(v[2], v[5]);
+  sort2(v[4], v[7]); sort2(v[4], v[2]); sort2(v[6], v[4]);
+  sort2(v[4], v[2]);
+  return v[4];
+}
+/// function median25
+/// \brief selects the median of 25 values with 99 compare and exchange
+/// \param v : the values, they are partially sorted by the function
+/// \return T
+template <typename T>
+static inline T median25(T (&v)[25]) {
+  sort2(v[0], v[1]); sort2(v[3], v[4]); sort2(v[2], v[4]);
+  sort2(v[2], v[3]); sort2(v[6], v[7]); sort2(v[5], v[7]);
+  sort2(v[5], v[6]); sort2(v[9], v[10]); sort2(v[8], v[10]);
+  sort2(v[8], v[9]); sort2(v[12], v[13]); sort2(v[11], v[13]);
+  sort2(v[11], v[12]); sort2(v[15], v[16]); sort2(v[14], v[16]);
+  sort2(v[14], v[15]); sort2(v[18], v[19]); sort2(v[17], v[19]);
+  sort2(v[17], v[18]); sort2(v[21], v[22]); sort2(v[20], v[22]);
+  sort2(v[20], v[21]); sort2(v[23], v[24]); sort2(v[2], v[5]);
+  sort2(v[3], v[6]); sort2(v[0], v[6]); sort2(v[0], v[3]);
+  sort2(v[4], v[7]); sort2(v[1], v[7]); sort2(v[1], v[4]);
+  sort2(v[11], v[14]); sort2(v[8], v[14]); sort2(v[8], v[11]);
+  sort2(v[12], v[15]); sort2(v[9], v[15]); sort2(v[9], v[12]);
+  sort2(v[13], v[16]); sort2(v[10], v[16]); sort2(v[10], v[13]);
+  sort2(v[20], v[23]); sort2(v[17], v[23]); sort2(v[17], v[20]);
+  sort2(v[21], v[24]); sort2(v[18], v[24]); sort2(v[18], v[21]);
+  sort2(v[19], v[22]); sort2(v[8], v[17]); sort2(v[9], v[18]);
+  sort2(v[0], v[18]); sort2(v[0], v[9]); sort2(v[10], v[19]);
+  sort2(v[1], v[19]); sort2(v[1], v[10]); sort2(v[11], v[20]);
+  sort2(v[2], v[20]); sort2(v[2], v[11]); sort2(v[12], v[21]);
+  sort2(v[3], v[21]); sort2(v[3], v[12]); sort2(v[13], v[22]);
+  sort2(v[4], v[22]); sort2(v[4], v[13]); sort2(v[14], v[23]);
+  sort2(v[5], v[23]); sort2(v[5], v[14]); sort2(v[15], v[24]);
+  sort2(v[6], v[24]); sort2(v[6], v[15]); sort2(v[7], v[16]);
+  sort2(v[7], v[19]); sort2(v[13], v[21]); sort2(v[15], v[23]);
+  sort2(v[7], v[13]); sort2(v[7], v[15]); sort2(v[1], v[9]);
+  sort2(v[3], v[11]); sort2(v[5], v[17]); sort2(v[11], v[17]);
+  sort2(v[9], v[17]); sort2(v[4], v[10]); sort2(v[6], v[12]);
+  sort2(v[7], v[14]); sort2(v[4], v[6]); sort2(v[4], v[7]);
+  sort2(v[12], v[14]); sort2(v[10], v[14]); sort2(v[6], v[7]);
+  sort2(v[10], v[12]); sort2(v[6], v[10]); sort2(v[6], v[17]);
+  sort2(v[12], v[17]); sort2(v[7], v[17]); sort2(v[7], v[10]);
+  sort2(v[12], v[18]); sort2(v[7], v[12]); sort2(v[10], v[18]);
+  sort2(v[12], v[20]); sort2(v[10], v[20]); sort2(v[10], v[12]);
+  return v[12];
+}
+}  // internal
+
+/// \struct OP_Median3x3
+/// \brief This functor implements the median filter of a 3x3 window. It can
+/// be applied to float and to any pixel type, each channel is filtered
+/// separately. The halo is deduced from the Radius by neighbour_operation.
+struct OP_Median3x3 {
+  static constexpr size_t Radius = 1;
+  /// \param nbr - Input image
+  /// \return PixelType - the median of the window around the pixel
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &nbr) {
+    using Pixel = internal::MedianPixel<typename NeighbourT::PixelType>;
+    typename NeighbourT::PixelType out{};
+    for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+      typename Pixel::Scalar v[9];
+      int k = 0;
+      for (int j = -1; j <= 1; j++) {
+        for (int i = -1; i <= 1; i++) {
+          v[k++] = Pixel::get(nbr.at(nbr.I_c + i, nbr.I_r + j), ch);
+        }
+      }
+      Pixel::set(out, ch, internal::median9(v));
+    }
+    return out;
+  }
+};
+
+/// \struct OP_Median5x5
+/// \brief This functor implements the median filter of a 5x5 window. It can
+/// be applied to float and to any pixel type, each channel is filtered
+/// separately. The halo is deduced from the Radius by neighbour_operation.
+struct OP_Median5x5 {
+  static constexpr size_t Radius = 2;
+  /// \param nbr - Input image
+  /// \return PixelType - the median of the window around the pixel
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &nbr) {
+    using Pixel = internal::MedianPixel<typename NeighbourT::PixelType>;
+    typename NeighbourT::PixelType out{};
+    for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+      typename Pixel::Scalar v[25];
+      int k = 0;
+      for (int j = -2; j <= 2; j++) {
+        for (int i = -2; i <= 2; i++) {
+          v[k++] = Pixel::get(nbr.at(nbr.I_c + i, nbr.I_r + j), ch);
+        }
+      }
+      Pixel::set(out, ch, internal::median25(v));
+    }
+    return out;
+  }
+};
+
+/// \brief OP_Median is the 5x5 median filter
+using OP_Median = OP_Median5x5;
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_MEDIAN_OP_MEDIAN_HPP_
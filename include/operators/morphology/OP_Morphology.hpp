@@ -0,0 +1,134 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_Morphology.hpp
+/// \brief This file contains the functors of the morphological operations
+/// with flat rectangular and cross structuring elements. The rectangles are
+/// separable, so the erosion and the dilation are built from a horizontal and
+/// a vertical pass of a min or a max along a line, see morphology.hpp.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_MORPHOLOGY_OP_MORPHOLOGY_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_MORPHOLOGY_OP_MORPHOLOGY_HPP_
+
+#include "../reduction/OP_Reduce.hpp"
+
+namespace visioncpp {
+/// \brief defines the flat structuring elements of the morphological
+/// operations. They are given by their radius in each dimension, so the
+/// element is 2 * RadiusC + 1 columns by 2 * RadiusR + 1 rows.
+namespace morph {
+/// \brief the rectangle of 2 * RadiusC + 1 by 2 * RadiusR + 1 pixels
+template <size_t RadiusC, size_t RadiusR = RadiusC>
+struct Rect {};
+/// \brief the cross made of the centre row of 2 * RadiusC + 1 pixels and the
+/// centre column of 2 * RadiusR + 1 pixels
+template <size_t RadiusC, size_t RadiusR = RadiusC>
+struct Cross {};
+}
+
+namespace internal {
+/// \struct MorphErode
+/// \brief the erosion keeps the smallest value of the structuring element,
+/// channel by channel
+struct MorphErode {
+  template <typename T>
+  static inline void combine(T &a, const T &b) {
+    min_assign(a, b);
+  }
+};
+/// \struct MorphDilate
+/// \brief the dilation keeps the largest value of the structuring element,
+/// channel by channel
+struct MorphDilate {
+  template <typename T>
+  static inline void combine(T &a, const T &b) {
+    max_assign(a, b);
+  }
+};
+
+/// function morph_at
+/// \brief reads the pixel at the distance d of the centre along the line of
+/// the pass
+/// template parameters:
+/// \tparam Horizontal: true for the rows, false for the columns
+/// function parameters:
+/// \param nbr : the input neighbour
+/// \param d : the signed distance of the centre
+/// \return PixelType
+template <bool Horizontal, typename NeighbourT>
+inline typename NeighbourT::PixelType morph_at(NeighbourT &nbr, int d) {
+  return Horizontal ? nbr.at(nbr.I_c + d, nbr.I_r)
+                    : nbr.at(nbr.I_c, nbr.I_r + d);
+}
+}  // internal
+
+/// \struct OP_MorphLine
+/// \brief the min or the max of the 2 * Radius + 1 pixels of a row or of a
+/// column centred on the pixel.
+/// template parameters:
+/// \tparam MorphOP: internal::MorphErode or internal::MorphDilate
+/// \tparam Radius: the radius of the line
+/// \tparam Horizontal: true for a row, false for a column
+template <typename MorphOP, size_t Radius, bool Horizontal>
+struct OP_MorphLine {
+  /// \param nbr - Input image
+  /// \return PixelType - the eroded or dilated pixel
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &nbr) {
+    typename NeighbourT::PixelType out = nbr.at(nbr.I_c, nbr.I_r);
+    for (int k = 1; k <= static_cast<int>(Radius); k++) {
+      MorphOP::combine(out, internal::morph_at<Horizontal>(nbr, -k));
+      MorphOP::combine(out, internal::morph_at<Horizontal>(nbr, k));
+    }
+    return out;
+  }
+};
+
+/// \struct OP_MorphCombine
+/// \brief the min or the max of two images, channel by channel. It joins the
+/// row and the column of a cross.
+/// template parameters:
+/// \tparam MorphOP: internal::MorphErode or internal::MorphDilate
+template <typename MorphOP>
+struct OP_MorphCombine {
+  /// \param t1 - First image
+  /// \param t2 - Second image
+  /// \return T - the min or the max of the two pixels
+  template <typename T>
+  T operator()(T t1, T t2) {
+    MorphOP::combine(t1, t2);
+    return t1;
+  }
+};
+
+/// \struct OP_MorphDiff
+/// \brief the difference of two images of the same pixel type, used by the
+/// morphological gradient and the top hats. The first image is never smaller
+/// than the second one, so an unsigned pixel does not wrap around.
+struct OP_MorphDiff {
+  /// \param t1 - First image
+  /// \param t2 - Second image
+  /// \return T - the difference t1 - t2
+  template <typename T>
+  T operator()(T t1, T t2) {
+    return t1 - t2;
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_MORPHOLOGY_OP_MORPHOLOGY_HPP_
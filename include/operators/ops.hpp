@@ -27,6 +27,12 @@
 #include "convert/ops_convert.hpp"
 #include "convolution/ops_conv.hpp"
 #include "downsampling/ops_downsampling.hpp"
+#include "edge/ops_edge.hpp"
+#include "histogram/ops_histogram.hpp"
+#include "median/ops_median.hpp"
+#include "morphology/ops_morphology.hpp"
+#include "reduction/ops_reduction.hpp"
+#include "resize/ops_resize.hpp"
 // interop with openCV
 #include "opencvinterop.hpp"
 
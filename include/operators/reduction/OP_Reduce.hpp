@@ -0,0 +1,230 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_Reduce.hpp
+/// \brief This file contains the functors of the whole image reductions. A
+/// reduction functor maps each pixel to the reduced type, combines two reduced
+/// values and computes the result from the reduction of the whole image.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_REDUCTION_OP_REDUCE_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_REDUCTION_OP_REDUCE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief keeps the smallest of two values in a
+template <typename T>
+inline void min_assign(T &a, const T &b) {
+  a = (b < a) ? b : a;
+}
+/// \brief keeps the smallest of two pixels in a, channel by channel
+template <typename T, size_t N>
+inline void min_assign(pixel::Storage<T, N> &a, const pixel::Storage<T, N> &b) {
+  for (size_t i = 0; i < N; i++) {
+    a[i] = (b[i] < a[i]) ? b[i] : a[i];
+  }
+}
+/// \brief keeps the largest of two values in a
+template <typename T>
+inline void max_assign(T &a, const T &b) {
+  a = (a < b) ? b : a;
+}
+/// \brief keeps the largest of two pixels in a, channel by channel
+template <typename T, size_t N>
+inline void max_assign(pixel::Storage<T, N> &a, const pixel::Storage<T, N> &b) {
+  for (size_t i = 0; i < N; i++) {
+    a[i] = (a[i] < b[i]) ? b[i] : a[i];
+  }
+}
+/// \brief the value of a single channel pixel as a float
+template <typename T>
+inline float first_channel(const T &p) {
+  return static_cast<float>(p);
+}
+/// \brief the value of the first channel of a pixel as a float
+template <typename T, size_t N>
+inline float first_channel(const pixel::Storage<T, N> &p) {
+  return static_cast<float>(p[0]);
+}
+}  // internal
+
+/// \struct OP_ReduceSum
+/// \brief sums the pixels of the image, channel by channel. The sum has the
+/// pixel type of the input, so an 8 bit image should be converted to float
+/// first.
+struct OP_ReduceSum {
+  /// \param p - the pixel
+  /// \param c - the column of the pixel
+  /// \param r - the row of the pixel
+  /// \return T - the pixel
+  template <typename T>
+  T map(const T &p, size_t c, size_t r) {
+    return p;
+  }
+  /// \brief adds b to a
+  template <typename T>
+  void reduce(T &a, const T &b) {
+    a += b;
+  }
+  /// \param sum - the sum of the image
+  /// \param count - the number of pixels
+  /// \return T - the sum
+  template <typename T>
+  T result(const T &sum, size_t count) {
+    return sum;
+  }
+};
+
+/// \struct OP_ReduceMean
+/// \brief computes the mean of the pixels of the image, channel by channel.
+struct OP_ReduceMean {
+  /// \param p - the pixel
+  /// \param c - the column of the pixel
+  /// \param r - the row of the pixel
+  /// \return T - the pixel
+  template <typename T>
+  T map(const T &p, size_t c, size_t r) {
+    return p;
+  }
+  /// \brief adds b to a
+  template <typename T>
+  void reduce(T &a, const T &b) {
+    a += b;
+  }
+  /// \param sum - the sum of the image
+  /// \param count - the number of pixels
+  /// \return T - the mean
+  template <typename T>
+  T result(T sum, size_t count) {
+    sum *= 1.0f / static_cast<float>(count);
+    return sum;
+  }
+};
+
+/// \struct OP_ReduceMin
+/// \brief computes the minimum of the pixels of the image, channel by channel.
+struct OP_ReduceMin {
+  /// \param p - the pixel
+  /// \param c - the column of the pixel
+  /// \param r - the row of the pixel
+  /// \return T - the pixel
+  template <typename T>
+  T map(const T &p, size_t c, size_t r) {
+    return p;
+  }
+  /// \brief keeps the minimum of a and b in a
+  template <typename T>
+  void reduce(T &a, const T &b) {
+    internal::min_assign(a, b);
+  }
+  /// \param min - the minimum of the image
+  /// \param count - the number of pixels
+  /// \return T - the minimum
+  template <typename T>
+  T result(const T &min, size_t count) {
+    return min;
+  }
+};
+
+/// \struct OP_ReduceMax
+/// \brief computes the maximum of the pixels of the image, channel by channel.
+struct OP_ReduceMax {
+  /// \param p - the pixel
+  /// \param c - the column of the pixel
+  /// \param r - the row of the pixel
+  /// \return T - the pixel
+  template <typename T>
+  T map(const T &p, size_t c, size_t r) {
+    return p;
+  }
+  /// \brief keeps the maximum of a and b in a
+  template <typename T>
+  void reduce(T &a, const T &b) {
+    internal::max_assign(a, b);
+  }
+  /// \param max - the maximum of the image
+  /// \param count - the number of pixels
+  /// \return T - the maximum
+  template <typename T>
+  T result(const T &max, size_t count) {
+    return max;
+  }
+};
+
+/// \struct OP_ReduceArgMax
+/// \brief finds the maximum of a single channel image and its location. When
+/// the maximum appears several times, the first one in row major order is
+/// kept. The coordinates are stored as floats, so they are exact up to 2^24.
+struct OP_ReduceArgMax {
+  /// \param p - the pixel
+  /// \param c - the column of the pixel
+  /// \param r - the row of the pixel
+  /// \return F32C3 - the value, the column and the row of the pixel
+  template <typename T>
+  visioncpp::pixel::F32C3 map(const T &p, size_t c, size_t r) {
+    return visioncpp::pixel::F32C3(internal::first_channel(p),
+                                   static_cast<float>(c),
+                                   static_cast<float>(r));
+  }
+  /// \brief keeps the largest value of a and b in a
+  void reduce(visioncpp::pixel::F32C3 &a, const visioncpp::pixel::F32C3 &b) {
+    if ((b[0] > a[0]) ||
+        ((b[0] == a[0]) &&
+         ((b[2] < a[2]) || ((b[2] == a[2]) && (b[1] < a[1]))))) {
+      a = b;
+    }
+  }
+  /// \param max - the maximum of the image and its location
+  /// \param count - the number of pixels
+  /// \return F32C3 - the maximum, its column and its row
+  visioncpp::pixel::F32C3 result(const visioncpp::pixel::F32C3 &max,
+                                 size_t count) {
+    return max;
+  }
+};
+
+/// \struct OP_ReduceMeanStdDev
+/// \brief computes the mean and the standard deviation of a single channel
+/// image from the sum of its pixels and of their squares.
+struct OP_ReduceMeanStdDev {
+  /// \param p - the pixel
+  /// \param c - the column of the pixel
+  /// \param r - the row of the pixel
+  /// \return F32C2 - the pixel and its square
+  template <typename T>
+  visioncpp::pixel::F32C2 map(const T &p, size_t c, size_t r) {
+    const float v = internal::first_channel(p);
+    return visioncpp::pixel::F32C2(v, v * v);
+  }
+  /// \brief adds b to a
+  void reduce(visioncpp::pixel::F32C2 &a, const visioncpp::pixel::F32C2 &b) {
+    a += b;
+  }
+  /// \param sums - the sum of the pixels and of their squares
+  /// \param count - the number of pixels
+  /// \return F32C2 - the mean and the standard deviation
+  visioncpp::pixel::F32C2 result(const visioncpp::pixel::F32C2 &sums,
+                                 size_t count) {
+    const float mean = sums[0] / static_cast<float>(count);
+    const float var = sums[1] / static_cast<float>(count) - mean * mean;
+    return visioncpp::pixel::F32C2(
+        mean, cl::sycl::sqrt(cl::sycl::fmax(var, 0.0f)));
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_REDUCTION_OP_REDUCE_HPP_
@@ -0,0 +1,273 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_Resize.hpp
+/// \brief This file contains the interpolations of the resize node.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_RESIZE_OP_RESIZE_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_RESIZE_OP_RESIZE_HPP_
+
+namespace visioncpp {
+/// \brief defines the interpolations of the resize node. They are passed as
+/// an optional type after the size of the output, e.g.
+/// resize<1280, 720, interpolation::Bicubic>(in). The pixel centres are
+/// aligned as in OpenCV.
+namespace interpolation {
+/// \brief the closest pixel of the input
+struct Nearest {};
+/// \brief the linear interpolation of the 2x2 closest pixels of the input
+struct Bilinear {};
+/// \brief the cubic interpolation of the 4x4 closest pixels of the input
+struct Bicubic {};
+/// \brief the average of the input pixels covered by the output pixel,
+/// weighted by the covered area
+struct Area {};
+}
+
+namespace internal {
+/// \brief the value of a channel of an interpolated pixel
+template <typename Scalar>
+inline Scalar resize_cast(float v) {
+  return static_cast<Scalar>(v);
+}
+/// \brief the value of an unsigned char channel of an interpolated pixel. It
+/// is rounded and saturated as in OpenCV.
+template <>
+inline unsigned char resize_cast<unsigned char>(float v) {
+  return static_cast<unsigned char>(cl::sycl::clamp(v + 0.5f, 0.0f, 255.0f));
+}
+/// \struct ResizePixel
+/// \brief ResizePixel is used to access each channel of the pixels read by an
+/// interpolation, as each channel is interpolated separately.
+/// template parameters
+/// \tparam T the pixel type
+template <typename T>
+struct ResizePixel {
+  using Scalar = typename T::data_type;
+  static constexpr size_t Channels = T::elements;
+  static inline float get(const T &p, size_t ch) { return p[ch]; }
+  static inline void set(T &p, size_t ch, float v) {
+    p[ch] = resize_cast<Scalar>(v);
+  }
+};
+/// \brief specialisation of ResizePixel when the pixel is a float
+template <>
+struct ResizePixel<float> {
+  static constexpr size_t Channels = 1;
+  static inline float get(const float &p, size_t) { return p; }
+  static inline void set(float &p, size_t, float v) { p = v; }
+};
+/// \brief specialisation of ResizePixel when the pixel is an unsigned char
+template <>
+struct ResizePixel<unsigned char> {
+  static constexpr size_t Channels = 1;
+  static inline float get(const unsigned char &p, size_t) { return p; }
+  static inline void set(unsigned char &p, size_t, float v) {
+    p = resize_cast<unsigned char>(v);
+  }
+};
+/// function resize_at
+/// \brief the pixel (c, r) of the input. The pixels outside of the input are
+/// replicated, or zero when ZeroOutside is true.
+/// \param in : the input
+/// \param c : the column
+/// \param r : the row
+/// \return PixelType
+template <bool ZeroOutside, typename NeighbourT>
+inline typename NeighbourT::PixelType resize_at(NeighbourT &in, int c, int r) {
+  return (!ZeroOutside || (c >= 0 && r >= 0 && c < static_cast<int>(in.cols) &&
+                           r < static_cast<int>(in.rows)))
+             ? in.at(c, r)
+             : typename NeighbourT::PixelType{};
+}
+/// function resize_sum
+/// \brief the separable weighted sum of the N x N pixels of the input whose
+/// top left pixel is (c0, r0). The pixels outside of the input are replicated,
+/// or zero when ZeroOutside is true.
+/// \param in : the input
+/// \param c0 : the first column
+/// \param r0 : the first row
+/// \param wc : the weight of each column
+/// \param wr : the weight of each row
+/// \return PixelType
+template <size_t N, bool ZeroOutside, typename NeighbourT>
+inline typename NeighbourT::PixelType resize_sum(NeighbourT &in, int c0,
+                                                 int r0, const float (&wc)[N],
+                                                 const float (&wr)[N]) {
+  using Pixel = ResizePixel<typename NeighbourT::PixelType>;
+  float acc[Pixel::Channels] = {0.0f};
+  for (int j = 0; j < static_cast<int>(N); j++) {
+    for (int i = 0; i < static_cast<int>(N); i++) {
+      const auto p = resize_at<ZeroOutside>(in, c0 + i, r0 + j);
+      const float w = wc[i] * wr[j];
+      for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+        acc[ch] += w * Pixel::get(p, ch);
+      }
+    }
+  }
+  typename NeighbourT::PixelType out{};
+  for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+    Pixel::set(out, ch, acc[ch]);
+  }
+  return out;
+}
+/// function cubic_weights
+/// \brief the weights of the 4 pixels around a position t in [0, 1) after
+/// the second one, with the cubic convolution of OpenCV (A = -0.75)
+/// \param t : the position
+/// \param w : the weights
+/// \return void
+inline void cubic_weights(float t, float (&w)[4]) {
+  constexpr float A = -0.75f;
+  w[0] = ((A * (t + 1.0f) - 5.0f * A) * (t + 1.0f) + 8.0f * A) * (t + 1.0f) -
+         4.0f * A;
+  w[1] = ((A + 2.0f) * t - (A + 3.0f)) * t * t + 1.0f;
+  w[2] = ((A + 2.0f) * (1.0f - t) - (A + 3.0f)) * (1.0f - t) * (1.0f - t) +
+         1.0f;
+  w[3] = 1.0f - w[0] - w[1] - w[2];
+}
+/// \struct Interpolate
+/// \brief Interpolate samples the input at the position (fc, fr), where the
+/// integer positions are the centres of the pixels. It is shared by the resize
+/// and the warp operations.
+/// template parameters:
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+template <typename Interp>
+struct Interpolate;
+/// function nearest_index
+/// \brief the pixel covering the position x measured from the left or top
+/// edge of the image, where the pixel i covers [i, i + 1). The position is
+/// truncated as in OpenCV, towards minus infinity so that the positions before
+/// the image stay outside of it.
+/// \param x : the position from the edge of the image
+/// \return int
+inline int nearest_index(float x) {
+  return static_cast<int>(cl::sycl::floor(x));
+}
+/// \brief specialisation of Interpolate for interpolation::Nearest. The centre
+/// of the pixel i is at i, so the position from the edge is fc + 0.5.
+template <>
+struct Interpolate<interpolation::Nearest> {
+  template <bool ZeroOutside, typename NeighbourT>
+  static inline typename NeighbourT::PixelType sample(NeighbourT &in, float fc,
+                                                      float fr) {
+    return resize_at<ZeroOutside>(in, nearest_index(fc + 0.5f),
+                                  nearest_index(fr + 0.5f));
+  }
+};
+/// \brief specialisation of Interpolate for interpolation::Bilinear
+template <>
+struct Interpolate<interpolation::Bilinear> {
+  template <bool ZeroOutside, typename NeighbourT>
+  static inline typename NeighbourT::PixelType sample(NeighbourT &in, float fc,
+                                                      float fr) {
+    const float c0 = cl::sycl::floor(fc);
+    const float r0 = cl::sycl::floor(fr);
+    const float wc[2] = {1.0f - (fc - c0), fc - c0};
+    const float wr[2] = {1.0f - (fr - r0), fr - r0};
+    return resize_sum<2, ZeroOutside>(in, static_cast<int>(c0),
+                                      static_cast<int>(r0), wc, wr);
+  }
+};
+/// \brief specialisation of Interpolate for interpolation::Bicubic
+template <>
+struct Interpolate<interpolation::Bicubic> {
+  template <bool ZeroOutside, typename NeighbourT>
+  static inline typename NeighbourT::PixelType sample(NeighbourT &in, float fc,
+                                                      float fr) {
+    const float c0 = cl::sycl::floor(fc);
+    const float r0 = cl::sycl::floor(fr);
+    float wc[4];
+    float wr[4];
+    cubic_weights(fc - c0, wc);
+    cubic_weights(fr - r0, wr);
+    return resize_sum<4, ZeroOutside>(in, static_cast<int>(c0) - 1,
+                                      static_cast<int>(r0) - 1, wc, wr);
+  }
+};
+}  // internal
+
+/// \struct OP_Resize
+/// \brief computes the output pixel (in.I_c, in.I_r) of a resize with the
+/// interpolation Interp. It is used by the resize node, whose input in is the
+/// whole image, and scale_c and scale_r are the ratio between the input and
+/// the output size in each dimension.
+/// The interpolation::Bilinear and interpolation::Bicubic resize replicate
+/// the pixels outside of the input.
+/// template parameters:
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+template <typename Interp>
+struct OP_Resize {
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &in, float scale_c,
+                                            float scale_r) {
+    return internal::Interpolate<Interp>::template sample<false>(
+        in, (in.I_c + 0.5f) * scale_c - 0.5f, (in.I_r + 0.5f) * scale_r - 0.5f);
+  }
+};
+
+/// \brief specialisation of OP_Resize for interpolation::Nearest. As in
+/// OpenCV, the output pixel takes the input pixel covering its top left
+/// corner, which is I_c * scale_c from the edge of the input.
+template <>
+struct OP_Resize<interpolation::Nearest> {
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &in, float scale_c,
+                                            float scale_r) {
+    return internal::Interpolate<interpolation::Nearest>::template sample<
+        false>(in, in.I_c * scale_c - 0.5f, in.I_r * scale_r - 0.5f);
+  }
+};
+
+/// \brief specialisation of OP_Resize for interpolation::Area. The output
+/// pixel covers scale_c x scale_r input pixels, the pixels partly covered
+/// are weighted by the covered area.
+template <>
+struct OP_Resize<interpolation::Area> {
+  template <typename NeighbourT>
+  typename NeighbourT::PixelType operator()(NeighbourT &in, float scale_c,
+                                            float scale_r) {
+    using Pixel = internal::ResizePixel<typename NeighbourT::PixelType>;
+    const float c_begin = in.I_c * scale_c;
+    const float r_begin = in.I_r * scale_r;
+    const float c_end = c_begin + scale_c;
+    const float r_end = r_begin + scale_r;
+    float acc[Pixel::Channels] = {0.0f};
+    for (int r = static_cast<int>(r_begin); r < r_end; r++) {
+      const float wr = cl::sycl::fmin(r + 1.0f, r_end) -
+                       cl::sycl::fmax(static_cast<float>(r), r_begin);
+      for (int c = static_cast<int>(c_begin); c < c_end; c++) {
+        const float wc = cl::sycl::fmin(c + 1.0f, c_end) -
+                         cl::sycl::fmax(static_cast<float>(c), c_begin);
+        const auto p = in.at(c, r);
+        for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+          acc[ch] += wc * wr * Pixel::get(p, ch);
+        }
+      }
+    }
+    typename NeighbourT::PixelType out{};
+    const float area = scale_c * scale_r;
+    for (size_t ch = 0; ch < Pixel::Channels; ch++) {
+      Pixel::set(out, ch, acc[ch] / area);
+    }
+    return out;
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_RESIZE_OP_RESIZE_HPP_
@@ -0,0 +1,95 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_Warp.hpp
+/// \brief This file contains the geometric transforms of an image sampled with
+/// an interpolation: the affine and perspective warps and the remap.
+
+#ifndef VISIONCPP_INCLUDE_OPERATORS_RESIZE_OP_WARP_HPP_
+#define VISIONCPP_INCLUDE_OPERATORS_RESIZE_OP_WARP_HPP_
+
+namespace visioncpp {
+/// \struct OP_WarpAffine
+/// \brief computes the output pixel (in.I_c, in.I_r) of an affine warp. The
+/// transform m is the 2x3 matrix, in row major order, mapping each output
+/// pixel to its position in the input (the inverse map of OpenCV). The pixels
+/// outside of the input are zero.
+/// template parameters:
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+template <typename Interp>
+struct OP_WarpAffine {
+  /// \param in - the input image
+  /// \param m - the 6 coefficients of the transform
+  /// \return PixelType - the output pixel
+  template <typename NeighbourT, typename TransformT>
+  typename NeighbourT::PixelType operator()(NeighbourT &in, TransformT &m) {
+    const float c = static_cast<float>(in.I_c);
+    const float r = static_cast<float>(in.I_r);
+    return internal::Interpolate<Interp>::template sample<true>(
+        in, m.at(0) * c + m.at(1) * r + m.at(2),
+        m.at(3) * c + m.at(4) * r + m.at(5));
+  }
+};
+
+/// \struct OP_WarpPerspective
+/// \brief computes the output pixel (in.I_c, in.I_r) of a perspective warp.
+/// The transform m is the 3x3 homography, in row major order, mapping each
+/// output pixel to its position in the input (the inverse map of OpenCV). The
+/// pixels outside of the input are zero.
+/// template parameters:
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+template <typename Interp>
+struct OP_WarpPerspective {
+  /// \param in - the input image
+  /// \param m - the 9 coefficients of the transform
+  /// \return PixelType - the output pixel
+  template <typename NeighbourT, typename TransformT>
+  typename NeighbourT::PixelType operator()(NeighbourT &in, TransformT &m) {
+    const float c = static_cast<float>(in.I_c);
+    const float r = static_cast<float>(in.I_r);
+    const float w = m.at(6) * c + m.at(7) * r + m.at(8);
+    const float inv_w = (w != 0.0f) ? 1.0f / w : 0.0f;
+    return internal::Interpolate<Interp>::template sample<true>(
+        in, (m.at(0) * c + m.at(1) * r + m.at(2)) * inv_w,
+        (m.at(3) * c + m.at(4) * r + m.at(5)) * inv_w);
+  }
+};
+
+/// \struct OP_Remap
+/// \brief samples the input at the position given by the map for each output
+/// pixel, e.g. to undistort or rectify an image. It is used with
+/// lookup_operation, whose input is the map and whose table is the image. The
+/// map is a pixel::F32C2 image of the column and row in the input. The pixels
+/// outside of the input are zero.
+/// template parameters:
+/// \tparam Interp: the interpolation defined in visioncpp::interpolation
+template <typename Interp>
+struct OP_Remap {
+  /// \param map - the position in the input of the output pixel
+  /// \param in - the input image
+  /// \return PixelType - the output pixel
+  template <typename MapT, typename NeighbourT>
+  typename NeighbourT::PixelType operator()(const MapT &map, NeighbourT &in,
+                                            size_t, size_t) {
+    return internal::Interpolate<Interp>::template sample<true>(in, map[0],
+                                                                map[1]);
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_OPERATORS_RESIZE_OP_WARP_HPP_
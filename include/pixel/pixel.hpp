@@ -24,6 +24,8 @@
 /// {F/U/S}{SIZE_OF_CHANNEL}C{NUMBER_OF_CHANNELS} \n
 /// F32C4 - represents float[4] \n
 /// U8C3  - represents unsigned char[3] \n
+/// F16C1 - represents cl::sycl::half[1] \n
+/// S16C2 - represents short[2] \n
 
 #ifndef VISIONCPP_INCLUDE_PIXEL_PIXEL_HPP_
 #define VISIONCPP_INCLUDE_PIXEL_PIXEL_HPP_
@@ -93,7 +95,7 @@ struct Storage {
   REGISTER_OPERATORS(/, Storage)
   REGISTER_OPERATORS(*, Storage)
   template <typename... P>
-  Storage(P... p) {
+  Storage(P... p) : m_data() {
     auto tp = visioncpp::internal::tools::tuple::make_tuple(p...);
     internal::AssignValueToArray<0 != sizeof...(P), 0, decltype(m_data),
                                  P...>::avta(m_data, tp);
@@ -140,6 +142,136 @@ typedef Storage<unsigned char, 3> U8C3;
 /// is perfect for storing pixels of RGBA and permutations.
 typedef Storage<unsigned char, 4> U8C4;
 
+/// \struct F16C1
+/// \brief This struct is generalisation for one channel half that is perfect
+/// for storing smooth intermediate images of R in half of the memory.
+typedef Storage<cl::sycl::half, 1> F16C1;
+
+/// \struct F16C2
+/// \brief This struct is generalisation for two channels half that is perfect
+/// for storing smooth intermediate images of RG and permutations.
+typedef Storage<cl::sycl::half, 2> F16C2;
+
+/// \struct F16C3
+/// \brief This struct is generalisation for three channels half that is
+/// perfect for storing smooth intermediate images of RGB and permutations.
+typedef Storage<cl::sycl::half, 3> F16C3;
+
+/// \struct F16C4
+/// \brief This struct is generalisation for four channels half that is perfect
+/// for storing smooth intermediate images of RGBA and permutations.
+typedef Storage<cl::sycl::half, 4> F16C4;
+
+/// \struct S16C1
+/// \brief This struct is generalisation for one channel short that is perfect
+/// for storing signed images like gradients.
+typedef Storage<short, 1> S16C1;
+
+/// \struct S16C2
+/// \brief This struct is generalisation for two channels short that is perfect
+/// for storing signed images like the gradients in x and y.
+typedef Storage<short, 2> S16C2;
+
+/// \struct S16C3
+/// \brief This struct is generalisation for three channels short that is
+/// perfect for storing signed images of RGB and permutations.
+typedef Storage<short, 3> S16C3;
+
+/// \struct S16C4
+/// \brief This struct is generalisation for four channels short that is
+/// perfect for storing signed images of RGBA and permutations.
+typedef Storage<short, 4> S16C4;
+
+/// \struct U16C1
+/// \brief This struct is generalisation for one channel unsigned short that
+/// is perfect for storing pixels of R with a high dynamic range.
+typedef Storage<unsigned short, 1> U16C1;
+
+/// \struct U16C2
+/// \brief This struct is generalisation for two channels unsigned short that
+/// is perfect for storing pixels of RG with a high dynamic range.
+typedef Storage<unsigned short, 2> U16C2;
+
+/// \struct U16C3
+/// \brief This struct is generalisation for three channels unsigned short that
+/// is perfect for storing pixels of RGB with a high dynamic range.
+typedef Storage<unsigned short, 3> U16C3;
+
+/// \struct U16C4
+/// \brief This struct is generalisation for four channels unsigned short that
+/// is perfect for storing pixels of RGBA with a high dynamic range.
+typedef Storage<unsigned short, 4> U16C4;
+
 }  // end of pixel
+
+namespace internal {
+/// \struct ChannelCast
+/// \brief ChannelCast converts the value of one channel to the channel type T.
+/// template parameters:
+/// \tparam T : the channel type of the output
+template <typename T>
+struct ChannelCast {
+  template <typename U>
+  static inline T cast(U v) {
+    return static_cast<T>(v);
+  }
+};
+
+/// \brief specialisation of the ChannelCast when the output is short. A float
+/// is rounded to the nearest and saturated to the range of short.
+template <>
+struct ChannelCast<short> {
+  static inline short cast(float v) {
+    return static_cast<short>(
+        cl::sycl::clamp(cl::sycl::floor(v + 0.5f), -32768.0f, 32767.0f));
+  }
+  template <typename U>
+  static inline short cast(U v) {
+    return static_cast<short>(v);
+  }
+};
+
+/// \brief specialisation of the ChannelCast when the output is unsigned short.
+/// A float is rounded to the nearest and saturated to the range of unsigned
+/// short.
+template <>
+struct ChannelCast<unsigned short> {
+  static inline unsigned short cast(float v) {
+    return static_cast<unsigned short>(
+        cl::sycl::clamp(cl::sycl::floor(v + 0.5f), 0.0f, 65535.0f));
+  }
+  template <typename U>
+  static inline unsigned short cast(U v) {
+    return static_cast<unsigned short>(v);
+  }
+};
+
+/// function channel_cast
+/// \brief template deduction for ChannelCast
+/// \tparam T : the channel type of the output
+/// \tparam U : the channel type of the input
+/// \param v : the value of the channel
+/// \return T
+template <typename T, typename U>
+inline T channel_cast(U v) {
+  return ChannelCast<T>::cast(v);
+}
+
+/// function storage_cast
+/// \brief converts each channel of a pixel to the channel type T.
+/// \tparam T : the channel type of the output
+/// \tparam U : the channel type of the input
+/// \tparam N : the number of channels
+/// \param in : the pixel
+/// \return Storage<T, N>
+template <typename T, typename U, size_t N>
+inline pixel::Storage<T, N> storage_cast(const pixel::Storage<U, N> &in) {
+  pixel::Storage<T, N> out;
+  for (size_t i = 0; i < N; i++) {
+    out[i] = channel_cast<T>(in[i]);
+  }
+  return out;
+}
+}  // namespace internal
 }  // namespace visioncpp
 #endif  // VISIONCPP_INCLUDE_PIXEL_PIXEL_HPP_
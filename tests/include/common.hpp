@@ -58,6 +58,35 @@ void verify(const cv::Mat &ref, std::shared_ptr<T> img) {
   }
 }
 
+// verification function for the outputs which are not stored as unsigned
+// char. The reference is read with the type of the VisionCpp output.
+template <typename T>
+void verify_near(const cv::Mat &ref, std::shared_ptr<T> img, float tolerance) {
+  int cv_cn = ref.channels();
+
+  const T *pixelPtr = (const T *)ref.data;
+
+  for (int i = 0; i < ref.rows; i++) {
+    for (int j = 0; j < ref.cols; j++) {
+      for (int c = 0; c < cv_cn; c++) {
+        auto expected = (float)(pixelPtr[i * ref.cols * cv_cn + j * cv_cn + c]);
+        auto tested = (float)(img.get()[i * ref.cols * cv_cn + j * cv_cn + c]);
+        ASSERT_NEAR(expected, tested, tolerance)
+            << "\nrow: " << i << " col: " << j << " channel: " << c
+            << " expected: " << expected << " tested: " << tested;
+      }
+    }
+  }
+}
+
+// creates a device of the same backend and target as the tested one, which
+// records its kernels in the profiler. It is used to count the kernels.
+template <visioncpp::backend BK, visioncpp::device DV>
+visioncpp::internal::Device_<BK, DV> make_profiled_device(
+    const visioncpp::internal::Device_<BK, DV> &, visioncpp::profiler &prof) {
+  return visioncpp::make_device<BK, DV>(prof);
+}
+
 // singleton that is used for generating a data for tests
 // create 256 textures that are 256x256 with all possible combinations of pixel
 // values for unsigned char storage.
@@ -0,0 +1,91 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+#include <cstdio>
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // the last candidate has a workgroup above the maximum of the SYCL
+  // devices, so it cannot be launched on them and must be skipped. The
+  // native backend has no workgroup limit and may choose it
+  using candidates =
+      visioncpp::tiles<visioncpp::tile<8, 8, 8, 8>,
+                       visioncpp::tile<16, 16, 8, 8>,
+                       visioncpp::tile<128, 128, 128, 128>>;
+  const std::string names[] = {"8 8 8 8", "16 16 8 8", "128 128 128 128"};
+  const std::string path = "visioncpp_autotune_test_" +
+                           std::to_string(POLICY) + "_" +
+                           std::to_string(i) + ".txt";
+  std::remove(path.c_str());
+
+  // 1) load in data
+  unsigned char *frame_ptr =
+      common::singleton::DataSet::Instance().m_data[i].get();
+  std::shared_ptr<float> ret_val(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ref_val(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image: the untuned execution
+  {
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(frame_ptr);
+    auto out = visioncpp::terminal<float, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ref_val.get());
+    auto grey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+        visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in));
+    auto exec = visioncpp::assign(out, visioncpp::gaussian_blur<2>(grey));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(exec, q);
+  }
+
+  std::string shape;
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(frame_ptr);
+    auto out = visioncpp::terminal<float, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto grey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+        visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in));
+    auto exec = visioncpp::assign(out, visioncpp::gaussian_blur<2>(grey));
+
+    // 4) execute pipe: the first execution tunes, the second one reuses the
+    // cached winner
+    visioncpp::autotuner tuner(path, 2);
+    visioncpp::execute_autotuned<POLICY, candidates>(exec, q, tuner);
+    EXPECT_EQ(1u, tuner.size());
+    EXPECT_TRUE(tuner.find(visioncpp::internal::tuning_key(exec, q), shape));
+    visioncpp::execute_autotuned<POLICY, candidates>(exec, q, tuner);
+    EXPECT_EQ(1u, tuner.size());
+  }
+
+  // 5) verify: the winner is one of the candidates and the tuned result
+  // equals the untuned one
+  EXPECT_TRUE(shape == names[0] || shape == names[1] || shape == names[2])
+      << shape;
+  cv::Mat ref(rows, cols, CV_32FC1, ref_val.get());
+  verify_near(ref, ret_val, 0.0f);
+  std::remove(path.c_str());
+}
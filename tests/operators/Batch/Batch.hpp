@@ -0,0 +1,121 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "../../include/common.hpp"
+
+// the difference of the grey levels of a frame and of a background frame
+template <typename Frame, typename Background>
+auto grey_difference(Frame frame, Background background)
+    -> decltype(visioncpp::point_operation<visioncpp::OP_Sub>(
+        visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+            visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(frame)),
+        visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+            visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(
+                background)))) {
+  return visioncpp::point_operation<visioncpp::OP_Sub>(
+      visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+          visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(frame)),
+      visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+          visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(background)));
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  constexpr size_t batch = 3;
+  constexpr size_t frame_size = cols * rows * 3;
+  const int depth = common::singleton::DataSet::m_depth;
+  unsigned char *background_ptr =
+      common::singleton::DataSet::Instance().m_data[i].get();
+  // 1) load in data: the batch holds the frames following the background
+  std::vector<unsigned char> frames(batch * frame_size);
+  for (size_t b = 0; b < batch; b++) {
+    const int f = (i + 1 + b) % depth;
+    const unsigned char *frame_ptr =
+        common::singleton::DataSet::Instance().m_data[f].get();
+    std::copy(frame_ptr, frame_ptr + frame_size,
+              frames.begin() + b * frame_size);
+  }
+
+  std::shared_ptr<float> ret_val(new float[batch * rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ref_val(new float[batch * rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image: each frame executed on its own
+  for (size_t b = 0; b < batch; b++) {
+    auto frame = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                     visioncpp::memory_type::Buffer2D>(
+        frames.data() + b * frame_size);
+    auto background = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                          visioncpp::memory_type::Buffer2D>(
+        background_ptr);
+    auto out = visioncpp::terminal<float, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ref_val.get() + b * rows * cols);
+    auto assign_node =
+        visioncpp::assign(out, grey_difference(frame, background));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+
+  {
+    // 3) define graph. The background is a single image shared by the batch
+    auto in = visioncpp::terminal_batch<visioncpp::pixel::U8C3, cols, rows,
+                                        batch,
+                                        visioncpp::memory_type::Buffer2D>(
+        frames.data());
+    auto background = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                          visioncpp::memory_type::Buffer2D>(
+        background_ptr);
+    auto out = visioncpp::terminal_batch<float, cols, rows, batch,
+                                         visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto assign_node = visioncpp::assign(out, grey_difference(in, background));
+    // 4) execute pipe
+    visioncpp::execute_batch<POLICY, 16, 16, 8, 8>(assign_node, q);
+
+    // an input or an output holding neither one image nor the whole batch
+    // would be read or written past its end
+    auto short_in = visioncpp::terminal_batch<visioncpp::pixel::U8C3, cols,
+                                              rows, batch - 1,
+                                              visioncpp::memory_type::Buffer2D>(
+        frames.data());
+    auto short_out =
+        visioncpp::terminal_batch<float, cols, rows, batch - 1,
+                                  visioncpp::memory_type::Buffer2D>();
+    auto short_input = visioncpp::assign(out, grey_difference(short_in, in));
+    auto short_output =
+        visioncpp::assign(short_out, grey_difference(in, background));
+    EXPECT_THROW((visioncpp::execute_batch<POLICY, 16, 16, 8, 8>(short_input,
+                                                                  q)),
+                 std::invalid_argument);
+    EXPECT_THROW((visioncpp::execute_batch<POLICY, 16, 16, 8, 8>(short_output,
+                                                                  q)),
+                 std::invalid_argument);
+  }
+  // 5) verify
+  for (size_t b = 0; b < batch; b++) {
+    cv::Mat ref(rows, cols, CV_32FC1, ref_val.get() + b * rows * cols);
+    std::shared_ptr<float> image(ret_val, ret_val.get() + b * rows * cols);
+    verify_near(ref, image, 0.0f);
+  }
+}
@@ -0,0 +1,87 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// filters the grey image of the frame with the border policy Border and
+// compares it with OpenCV extending the image with cv_border. The filter is
+// not symmetric, so each border policy reads different pixels.
+template <typename Border, size_t POLICY, typename QUEUE, typename DATA>
+void check_border(QUEUE &q, DATA data, const cv::Mat &grey, int cv_border) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  constexpr int radius = 2;
+  float filter_array[25];
+  for (int k = 0; k < 25; k++) {
+    filter_array[k] = (k + 1) / 325.0f;
+  }
+  std::shared_ptr<float> ret_val(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+
+  // gold_standard image: the border is added by copyMakeBorder, so only the
+  // pixels inside of the padded image are filtered
+  cv::Mat padded, filtered;
+  cv::copyMakeBorder(grey, padded, radius, radius, radius, radius, cv_border,
+                     cv::Scalar(0));
+  filter2D(padded, filtered, -1, cv::Mat(5, 5, CV_32F, filter_array),
+           cv::Point(-1, -1), 0, cv::BORDER_CONSTANT);
+  cv::Mat ref = filtered(cv::Rect(radius, radius, cols, rows)).clone();
+
+  {
+    auto filter_node =
+        visioncpp::terminal<float, 5, 5, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto return_node = visioncpp::terminal<float, cols, rows,
+                                           visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto grey_node = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+        visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(data));
+    auto node =
+        visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One, Border>(
+            grey_node, filter_node);
+    auto assign_node = visioncpp::assign(return_node, node);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  verify_near(ref, ret_val, 1e-4f);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  // 1) load in data
+  cv::Mat frame(common::singleton::DataSet::Instance().m_height,
+                common::singleton::DataSet::Instance().m_width, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+
+  // 2) create the grey image filtered by the tests
+  cv::Mat scaled, grey;
+  frame.convertTo(scaled, CV_32FC3, 1.0 / 255.0);
+  cv::transform(scaled, grey, cv::Matx13f(0.299f, 0.587f, 0.114f));
+
+  // 3) compare every border policy, the right and bottom edges included
+  check_border<visioncpp::border::Constant, POLICY>(q, data, grey,
+                                                    cv::BORDER_CONSTANT);
+  check_border<visioncpp::border::Replicate, POLICY>(q, data, grey,
+                                                     cv::BORDER_REPLICATE);
+  check_border<visioncpp::border::Reflect, POLICY>(q, data, grey,
+                                                   cv::BORDER_REFLECT);
+  check_border<visioncpp::border::Reflect101, POLICY>(q, data, grey,
+                                                      cv::BORDER_REFLECT_101);
+  check_border<visioncpp::border::Wrap, POLICY>(q, data, grey,
+                                                cv::BORDER_WRAP);
+}
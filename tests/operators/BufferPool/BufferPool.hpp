@@ -0,0 +1,142 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // the nodes of the tree which are not leaves, each of them needs its own
+  // memory when nothing is given back to the pool
+  constexpr size_t intermediates = 19;
+  const int j = (i + 1) % common::singleton::DataSet::m_depth;
+  float dx_array[9] = {-1.0 / 8.0, 0.0, 1.0 / 8.0,  -2.0 / 8.0, 0.0,
+                       2.0 / 8.0,  -1.0 / 8.0, 0.0, 1.0 / 8.0};
+  float dy_array[9] = {-1.0 / 8.0, -2.0 / 8.0, -1.0 / 8.0, 0.0,      0.0,
+                       0.0,        1.0 / 8.0,  2.0 / 8.0,  1.0 / 8.0};
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+  cv::Mat next(rows, cols, CV_8UC3,
+               common::singleton::DataSet::Instance().m_data[j].get());
+
+  std::shared_ptr<float> ret_val(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_other(new float[rows * cols],
+                                   [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image: the temporal gradient weighted by the
+  // spatial gradients of a Lucas-Kanade step
+  cv::Mat grey[2];
+  cv::Mat frames[2] = {frame, next};
+  for (int f = 0; f < 2; f++) {
+    cv::Mat scaled;
+    frames[f].convertTo(scaled, CV_32FC3, 1.0 / 255.0);
+    cv::transform(scaled, grey[f], cv::Matx13f(0.299f, 0.587f, 0.114f));
+  }
+  cv::Mat ix, iy;
+  filter2D(grey[0], ix, -1, cv::Mat(3, 3, CV_32F, dx_array), cv::Point(-1, -1),
+           0, cv::BORDER_REPLICATE);
+  filter2D(grey[0], iy, -1, cv::Mat(3, 3, CV_32F, dy_array), cv::Point(-1, -1),
+           0, cv::BORDER_REPLICATE);
+  cv::Mat it = grey[1] - grey[0];
+  cv::Mat ref = ix.mul(it) + iy.mul(it);
+
+  {
+    // 3) define graph
+    auto in_next = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                       visioncpp::memory_type::Buffer2D>(
+        common::singleton::DataSet::Instance().m_data[j].get());
+    auto dx_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(dx_array);
+    auto dy_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(dy_array);
+    auto return_node = visioncpp::terminal<float, cols, rows,
+                                           visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+
+    auto grey_prev = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+        visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(data));
+    auto grey_next = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+        visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in_next));
+    auto ix_node = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        grey_prev, dx_node);
+    auto iy_node = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        grey_prev, dy_node);
+    auto it_node =
+        visioncpp::point_operation<visioncpp::OP_Sub>(grey_next, grey_prev);
+    auto sum_node = visioncpp::point_operation<visioncpp::OP_Add>(
+        visioncpp::point_operation<visioncpp::OP_Mul>(ix_node, it_node),
+        visioncpp::point_operation<visioncpp::OP_Mul>(iy_node, it_node));
+    auto assign_node = visioncpp::assign(return_node, sum_node);
+
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+
+    // 5) check the pool once on a device whose pool is empty. The pool only
+    // grows when no free memory fits, so its size is the peak of the live
+    // memories, and executing again reuses them
+    if (i == 0) {
+      visioncpp::profiler prof;
+      auto dev = make_profiled_device(q, prof);
+      visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, dev);
+      const size_t peak = dev.get_buffer_pool().size();
+      EXPECT_LT(2 * peak, intermediates);
+      visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, dev);
+      EXPECT_EQ(peak, dev.get_buffer_pool().size());
+      // no free memory is kept without capacity
+      dev.get_buffer_pool().set_capacity(0);
+      EXPECT_EQ(0u, dev.get_buffer_pool().size());
+      visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, dev);
+      EXPECT_EQ(0u, dev.get_buffer_pool().size());
+      dev.get_buffer_pool().set_capacity(
+          visioncpp::internal::BufferPool::default_capacity);
+
+      // two copies of the device share the pool, each thread executing on
+      // one of them keeps its own memories
+      auto other_node = visioncpp::terminal<float, cols, rows,
+                                            visioncpp::memory_type::Buffer2D>(
+          ret_other.get());
+      auto other_assign = visioncpp::assign(other_node, sum_node);
+      auto dev_copy = dev;
+      std::thread first([&]() {
+        for (int k = 0; k < 4; k++) {
+          visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, dev);
+        }
+      });
+      std::thread second([&]() {
+        for (int k = 0; k < 4; k++) {
+          visioncpp::execute<POLICY, 16, 16, 8, 8>(other_assign, dev_copy);
+        }
+      });
+      first.join();
+      second.join();
+    }
+  }
+  // 6) verify
+  verify_near(ref, ret_val, 1e-4f);
+  if (i == 0) {
+    verify_near(ref, ret_other, 1e-4f);
+  }
+}
@@ -0,0 +1,105 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+constexpr size_t canny_cols = common::singleton::DataSet::m_width;
+constexpr size_t canny_rows = common::singleton::DataSet::m_height;
+
+// the image blurred by the Gaussian the canny node applies first. The blur
+// of an unsigned char image is rounded, and cv::Canny starts from it so the
+// gradients of both are the same integers.
+template <size_t POLICY, typename QUEUE>
+cv::Mat canny_blurred(QUEUE &q, cv::Mat img) {
+  cv::Mat blurred(canny_rows, canny_cols, CV_8UC1);
+  {
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C1, canny_cols,
+                                  canny_rows,
+                                  visioncpp::memory_type::Buffer2D>(img.data);
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C1, canny_cols,
+                                   canny_rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        blurred.data);
+    auto assign_node = visioncpp::assign(out, visioncpp::gaussian_blur<1>(in));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  return blurred;
+}
+
+// compares the canny node with cv::Canny on the same thresholds. The
+// magnitudes are compared squared, so the reference uses the L2 norm.
+template <size_t POLICY, intmax_t Low, intmax_t High, typename QUEUE>
+void check_canny(QUEUE &q, cv::Mat img) {
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[canny_cols * canny_rows],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image
+  cv::Mat ref;
+  cv::Canny(canny_blurred<POLICY>(q, img), ref, Low, High, 3, true);
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C1, canny_cols,
+                                  canny_rows,
+                                  visioncpp::memory_type::Buffer2D>(img.data);
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C1, canny_cols,
+                                   canny_rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto assign_node = visioncpp::assign(
+        out, visioncpp::canny<POLICY, std::ratio<Low>, std::ratio<High>>(in));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify
+  verify_near(ref, ret_val, 0.0f);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  // 1) load in data. A hashed texture, whose gradients reach the border
+  cv::Mat texture(canny_rows, canny_cols, CV_8UC1);
+  for (int r = 0; r < texture.rows; r++) {
+    for (int c = 0; c < texture.cols; c++) {
+      const unsigned int h =
+          (c * 73856093u) ^ (r * 19349663u) ^ (i * 83492791u);
+      texture.at<unsigned char>(r, c) = static_cast<unsigned char>(h >> 8);
+    }
+  }
+  check_canny<POLICY, 100, 300>(q, texture);
+
+  // a step from row 128 whose height goes down from 100 to 20 over the
+  // first 80 columns. Its edge is on row 127 or 128 of every column and its
+  // magnitude is about 3 times the height, so only the first columns are
+  // strong and the hysteresis grows the edge over about 180 weak pixels, far
+  // more than the steps of a kernel.
+  cv::Mat step = cv::Mat::zeros(canny_rows, canny_cols, CV_8UC1);
+  for (int c = 20; c < 236; c++) {
+    step(cv::Rect(c, 128, 1, 72)).setTo(std::max(20, 120 - c));
+  }
+  cv::Mat strong;
+  cv::Mat grown;
+  cv::Mat blurred = canny_blurred<POLICY>(q, step);
+  cv::Canny(blurred, strong, 200, 200, 3, true);
+  cv::Canny(blurred, grown, 40, 200, 3, true);
+  ASSERT_EQ(0, strong.at<unsigned char>(127, 200));
+  ASSERT_EQ(255, grown.at<unsigned char>(127, 200));
+  check_canny<POLICY, 40, 200>(q, step);
+}
@@ -0,0 +1,142 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// the same convolution as OP_Filter2D_One with a different type, so a tree
+// using both has no common subexpression
+struct Filter2D_Other {
+  template <typename NeighbourT, typename FilterT>
+  float operator()(NeighbourT& nbr, FilterT& fltr) {
+    return visioncpp::OP_Filter2D_One()(nbr, fltr);
+  }
+};
+
+// the difference of the filtered grey images of two frames
+template <typename LeftOP, typename RightOP, typename LHS, typename RHS,
+          typename FLT>
+auto filtered_difference(LHS lhs, RHS rhs, FLT filter_node)
+    -> decltype(visioncpp::point_operation<visioncpp::OP_Sub>(
+        visioncpp::neighbour_operation<LeftOP>(
+            visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+                visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(lhs)),
+            filter_node),
+        visioncpp::neighbour_operation<RightOP>(
+            visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+                visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(rhs)),
+            filter_node))) {
+  return visioncpp::point_operation<visioncpp::OP_Sub>(
+      visioncpp::neighbour_operation<LeftOP>(
+          visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+              visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(lhs)),
+          filter_node),
+      visioncpp::neighbour_operation<RightOP>(
+          visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+              visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(rhs)),
+          filter_node));
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  const int j = (i + 1) % common::singleton::DataSet::m_depth;
+  float filter_array[9] = {1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0,
+                           1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0,
+                           1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0};
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+  cv::Mat next(rows, cols, CV_8UC3,
+               common::singleton::DataSet::Instance().m_data[j].get());
+
+  std::shared_ptr<float> ret_val(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image
+  cv::Mat kernel = cv::Mat::ones(3, 3, CV_32F) / 9.0f;
+  cv::Mat filtered[2];
+  cv::Mat frames[2] = {frame, next};
+  for (int f = 0; f < 2; f++) {
+    cv::Mat scaled, grey;
+    frames[f].convertTo(scaled, CV_32FC3, 1.0 / 255.0);
+    cv::transform(scaled, grey, cv::Matx13f(0.299f, 0.587f, 0.114f));
+    filter2D(grey, filtered[f], -1, kernel, cv::Point(-1, -1), 0,
+             cv::BORDER_REPLICATE);
+  }
+  cv::Mat ref = filtered[0] - filtered[1];
+
+  {
+    // 3) define graph
+    auto in = data;
+    auto in_next = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                       visioncpp::memory_type::Buffer2D>(
+        common::singleton::DataSet::Instance().m_data[j].get());
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto return_node = visioncpp::terminal<float, cols, rows,
+                                           visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+
+    // the two filters have the same type but read different frames
+    auto two_frames = visioncpp::assign(
+        return_node,
+        filtered_difference<visioncpp::OP_Filter2D_One,
+                            visioncpp::OP_Filter2D_One>(in, in_next,
+                                                        filter_node));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(two_frames, q);
+
+    // 5) count the kernels once, against the same tree without any candidate
+    if (i == 0) {
+      visioncpp::profiler prof;
+      auto dev = make_profiled_device(q, prof);
+      auto other_node = visioncpp::terminal<float, cols, rows,
+                                            visioncpp::memory_type::Buffer2D>();
+      auto distinct = visioncpp::assign(
+          other_node,
+          filtered_difference<visioncpp::OP_Filter2D_One, Filter2D_Other>(
+              in, in_next, filter_node));
+      visioncpp::execute<POLICY, 16, 16, 8, 8>(distinct, dev);
+      const size_t expected = prof.records().size();
+      prof.clear();
+
+      visioncpp::execute<POLICY, 16, 16, 8, 8>(two_frames, dev);
+      EXPECT_EQ(expected, prof.records().size());
+      prof.clear();
+
+      // the filter of a single frame is shared: NoFuse executes it once and
+      // Fuse at most adds the kernel writing it
+      auto same_frame = visioncpp::assign(
+          other_node,
+          filtered_difference<visioncpp::OP_Filter2D_One,
+                              visioncpp::OP_Filter2D_One>(in, in,
+                                                          filter_node));
+      visioncpp::execute<POLICY, 16, 16, 8, 8>(same_frame, dev);
+      if (POLICY == visioncpp::policy::NoFuse) {
+        EXPECT_LT(prof.records().size(), expected);
+      } else {
+        EXPECT_LE(prof.records().size(), expected + 1);
+      }
+    }
+  }
+  // 6) verify
+  verify_near(ref, ret_val, 1e-4f);
+}
@@ -0,0 +1,65 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  cv::Mat ref;
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[rows * cols * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image
+  cvtColor(frame, ref, CV_BGR2RGB);
+
+  {
+    // 3) the sizes of the terminals are given at runtime
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, visioncpp::dynamic,
+                                  visioncpp::dynamic,
+                                  visioncpp::memory_type::Buffer2D>(
+        common::singleton::DataSet::Instance().m_data[i].get(), cols, rows);
+    auto return_node =
+        visioncpp::terminal<visioncpp::pixel::U8C3, visioncpp::dynamic,
+                            visioncpp::dynamic,
+                            visioncpp::memory_type::Buffer2D>(ret_val.get(),
+                                                              cols, rows);
+    auto node = visioncpp::point_operation<visioncpp::OP_BGRToRGB>(in);
+    auto assign_node = visioncpp::assign(return_node, node);
+    // 4) execute pipe
+    EXPECT_NO_THROW((visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q)));
+
+    // 5) an output smaller than the input is rejected before the launch
+    auto small_node =
+        visioncpp::terminal<visioncpp::pixel::U8C3, visioncpp::dynamic,
+                            visioncpp::dynamic,
+                            visioncpp::memory_type::Buffer2D>(cols / 2,
+                                                              rows / 2);
+    auto mismatch = visioncpp::assign(small_node, node);
+    EXPECT_THROW((visioncpp::execute<POLICY, 16, 16, 8, 8>(mismatch, q)),
+                 std::invalid_argument);
+  }
+  // 6) verify
+  verify(ref, ret_val);
+}
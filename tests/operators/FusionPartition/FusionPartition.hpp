@@ -0,0 +1,90 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// the filtered grey image of a frame
+template <typename IN, typename FLT>
+auto filtered_grey(IN in, FLT filter_node)
+    -> decltype(visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+            visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in)),
+        filter_node)) {
+  return visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+      visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+          visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in)),
+      filter_node);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  float filter_array[9] = {1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0,
+                           1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0,
+                           1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0};
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+
+  std::shared_ptr<float> ret_val(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image
+  cv::Mat scaled, grey, ref;
+  frame.convertTo(scaled, CV_32FC3, 1.0 / 255.0);
+  cv::transform(scaled, grey, cv::Matx13f(0.299f, 0.587f, 0.114f));
+  filter2D(grey, ref, -1, cv::Mat::ones(3, 3, CV_32F) / 9.0f,
+           cv::Point(-1, -1), 0, cv::BORDER_REPLICATE);
+
+  {
+    // 3) define graph
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto return_node = visioncpp::terminal<float, cols, rows,
+                                           visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto assign_node =
+        visioncpp::assign(return_node, filtered_grey(data, filter_node));
+
+    // 4) execute pipe with 64x64 tiles. The U8C3, F32C3 and float tiles of
+    // the input of the filter need about 80KB of local memory when fused
+    visioncpp::execute<POLICY, 64, 64, 8, 8>(assign_node, q);
+
+    // 5) count the kernels once. With 16x16 tiles the fused input fits in
+    // the local memory budget, with 64x64 tiles it is given its own kernel
+    if (i == 0 && POLICY == visioncpp::policy::Fuse) {
+      visioncpp::profiler prof;
+      auto dev = make_profiled_device(q, prof);
+      auto other_node = visioncpp::terminal<float, cols, rows,
+                                            visioncpp::memory_type::Buffer2D>();
+      auto small_tiles =
+          visioncpp::assign(other_node, filtered_grey(data, filter_node));
+      visioncpp::execute<POLICY, 16, 16, 8, 8>(small_tiles, dev);
+      EXPECT_EQ(1u, prof.records().size());
+      prof.clear();
+
+      visioncpp::execute<POLICY, 64, 64, 8, 8>(assign_node, dev);
+      EXPECT_EQ(2u, prof.records().size());
+    }
+  }
+  // 6) verify
+  verify_near(ref, ret_val, 1e-4f);
+}
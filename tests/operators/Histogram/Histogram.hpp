@@ -0,0 +1,94 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  constexpr size_t bins = 256;
+  // 1) load in data. The frame is a smooth ramp, so a texture is made of it:
+  // each 32x32 tile of the CLAHE has its own level and a few values around
+  // it, which are above the clip limit, plus a sparse bright pattern
+  cv::Mat texture(rows, cols, CV_8UC1);
+  for (int r = 0; r < texture.rows; r++) {
+    for (int c = 0; c < texture.cols; c++) {
+      const unsigned int h =
+          (c * 73856093u) ^ (r * 19349663u) ^ (i * 83492791u);
+      const unsigned int level = ((c / 32) * 37 + (r / 32) * 101) & 255;
+      texture.at<unsigned char>(r, c) = static_cast<unsigned char>(
+          ((h >> 16) & 15) == 0 ? 255 - (h & 31) : (level + h % 5) & 255);
+    }
+  }
+
+  std::shared_ptr<unsigned int> hist_val(
+      new unsigned int[bins], [](unsigned int *dataMem) { delete[] dataMem; });
+  std::shared_ptr<unsigned char> equal_val(
+      new unsigned char[cols * rows],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  std::shared_ptr<unsigned char> clahe_val(
+      new unsigned char[cols * rows],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image
+  cv::Mat hist_ref;
+  const int channels[] = {0};
+  const int size[] = {static_cast<int>(bins)};
+  const float range[] = {0.0f, 256.0f};
+  const float *ranges[] = {range};
+  cv::calcHist(&texture, 1, channels, cv::Mat(), hist_ref, 1, size, ranges);
+  hist_ref.convertTo(hist_ref, CV_32S);
+  cv::Mat equal_ref;
+  cv::equalizeHist(texture, equal_ref);
+  cv::Mat clahe_ref;
+  cv::createCLAHE(40.0, cv::Size(8, 8))->apply(texture, clahe_ref);
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C1, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        texture.data);
+    auto hist = visioncpp::terminal<unsigned int, bins, 1,
+                                    visioncpp::memory_type::Buffer2D>(
+        hist_val.get());
+    auto equal = visioncpp::terminal<visioncpp::pixel::U8C1, cols, rows,
+                                     visioncpp::memory_type::Buffer2D>(
+        equal_val.get());
+    auto clahe = visioncpp::terminal<visioncpp::pixel::U8C1, cols, rows,
+                                     visioncpp::memory_type::Buffer2D>(
+        clahe_val.get());
+    auto hist_node = visioncpp::assign(hist, visioncpp::histogram<bins>(in));
+    auto equal_node = visioncpp::assign(equal, visioncpp::equalize_hist(in));
+    auto clahe_node =
+        visioncpp::assign(clahe, visioncpp::clahe<8, 8, std::ratio<40>>(in));
+
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(hist_node, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(equal_node, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(clahe_node, q);
+  }
+
+  // 5) verify. The counts are exact. The tables are computed in float rather
+  // than in the integers of OpenCV, and the CLAHE interpolates the tables
+  // before rounding them, so the pixels may be 1 apart
+  verify_near(hist_ref.t(), hist_val, 0.0f);
+  verify_near(equal_ref, equal_val, 1.0f);
+  verify_near(clahe_ref, clahe_val, 1.0f);
+}
@@ -0,0 +1,64 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // 1) load in data, in memories shared with the device
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+  std::vector<unsigned char, visioncpp::aligned_allocator<unsigned char>>
+      shared_frame(frame.data, frame.data + rows * cols * 3);
+  visioncpp::aligned_allocator<float> allocator;
+  std::shared_ptr<float> ret_val(
+      allocator.allocate(rows * cols * 3),
+      [allocator](float *dataMem) mutable {
+        allocator.deallocate(dataMem, rows * cols * 3);
+      });
+
+  // 2) create gold_standard image
+  cv::Mat ref;
+  frame.convertTo(ref, CV_32FC3, 1.0 / 255.0);
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        shared_frame.data(), visioncpp::use_host_ptr);
+    auto out = visioncpp::terminal<visioncpp::pixel::F32C3, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get(), visioncpp::use_host_ptr);
+    auto assign_node = visioncpp::assign(
+        out, visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify
+  verify_near(ref, ret_val, 1e-6f);
+
+  // a pointer which is not aligned cannot be shared with the device. The
+  // terminal is one row shorter so that it stays inside of the frame
+  EXPECT_THROW((visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows - 1,
+                                    visioncpp::memory_type::Buffer2D>(
+                   shared_frame.data() + 1, visioncpp::use_host_ptr)),
+               std::invalid_argument);
+}
@@ -0,0 +1,107 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// the integral image of OpenCV without its first row and column of zeros
+inline cv::Mat integral_reference(const cv::Mat &grey) {
+  cv::Mat sum, ref;
+  cv::integral(grey, sum, CV_64F);
+  sum(cv::Rect(1, 1, grey.cols, grey.rows)).convertTo(ref, CV_32F);
+  return ref;
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // not a multiple of ScanOp::Chunk, so the last chunk of a row is partial
+  constexpr size_t small_cols = 100;
+  constexpr size_t small_rows = 40;
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+  cv::Mat scaled, grey;
+  frame.convertTo(scaled, CV_32FC3, 1.0 / 255.0);
+  cv::transform(scaled, grey, cv::Matx13f(0.299f, 0.587f, 0.114f));
+  cv::Mat small = grey(cv::Rect(0, 0, small_cols, small_rows)).clone();
+
+  std::shared_ptr<float> ret_integral(
+      new float[rows * cols], [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_small(new float[small_rows * small_cols],
+                                   [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_box(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_asym(new float[rows * cols],
+                                  [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard images. The box sums count the pixels outside
+  // of the image as zero
+  cv::Mat ref_integral = integral_reference(grey);
+  cv::Mat ref_small = integral_reference(small);
+  cv::Mat ref_box, ref_asym;
+  cv::boxFilter(grey, ref_box, -1, cv::Size(7, 7), cv::Point(-1, -1), false,
+                cv::BORDER_CONSTANT);
+  // 1 row above, 2 columns on the left, 3 rows below, 4 columns on the right
+  cv::boxFilter(grey, ref_asym, -1, cv::Size(7, 5), cv::Point(2, 1), false,
+                cv::BORDER_CONSTANT);
+
+  {
+    // 3) define graph, the 256 columns are scanned in several chunks
+    auto grey_node = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+        visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(data));
+    auto out_integral = visioncpp::terminal<float, cols, rows,
+                                            visioncpp::memory_type::Buffer2D>(
+        ret_integral.get());
+    auto out_box = visioncpp::terminal<float, cols, rows,
+                                       visioncpp::memory_type::Buffer2D>(
+        ret_box.get());
+    auto out_asym = visioncpp::terminal<float, cols, rows,
+                                        visioncpp::memory_type::Buffer2D>(
+        ret_asym.get());
+    auto in_small =
+        visioncpp::terminal<float, small_cols, small_rows,
+                            visioncpp::memory_type::Buffer2D>(
+            reinterpret_cast<float *>(small.data));
+    auto out_small =
+        visioncpp::terminal<float, small_cols, small_rows,
+                            visioncpp::memory_type::Buffer2D>(ret_small.get());
+
+    // 4) execute pipe
+    auto assign_integral =
+        visioncpp::assign(out_integral, visioncpp::integral_image(grey_node));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_integral, q);
+    auto assign_small =
+        visioncpp::assign(out_small, visioncpp::integral_image(in_small));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_small, q);
+    auto assign_box = visioncpp::assign(
+        out_box, visioncpp::box_sum<3>(visioncpp::integral_image(grey_node)));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_box, q);
+    auto assign_asym = visioncpp::assign(
+        out_asym,
+        visioncpp::box_sum<1, 2, 3, 4>(visioncpp::integral_image(grey_node)));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_asym, q);
+  }
+  // 5) verify. The sums of the whole image reach 2^16, where a float
+  // keeps 2^-8 of precision
+  verify_near(ref_integral, ret_integral, 0.05f);
+  verify_near(ref_small, ret_small, 1e-3f);
+  verify_near(ref_box, ret_box, 0.05f);
+  verify_near(ref_asym, ret_asym, 0.05f);
+}
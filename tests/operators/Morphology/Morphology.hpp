@@ -0,0 +1,124 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// the structuring element of OpenCV matching a visioncpp element
+template <typename Element>
+struct CVElement;
+template <size_t RadiusC, size_t RadiusR>
+struct CVElement<visioncpp::morph::Rect<RadiusC, RadiusR>> {
+  static cv::Mat get() {
+    return cv::getStructuringElement(
+        cv::MORPH_RECT, cv::Size(2 * RadiusC + 1, 2 * RadiusR + 1));
+  }
+};
+template <size_t RadiusC, size_t RadiusR>
+struct CVElement<visioncpp::morph::Cross<RadiusC, RadiusR>> {
+  static cv::Mat get() {
+    return cv::getStructuringElement(
+        cv::MORPH_CROSS, cv::Size(2 * RadiusC + 1, 2 * RadiusR + 1));
+  }
+};
+
+// each morphological operation with its OpenCV counterpart
+#define MORPH_TEST_OP(NAME, FUNC, CV_OP)                                      \
+  struct NAME {                                                               \
+    static constexpr int cv_op = CV_OP;                                       \
+    template <typename Element, typename RHS>                                 \
+    static auto build(RHS rhs) -> decltype(visioncpp::FUNC<Element>(rhs)) {   \
+      return visioncpp::FUNC<Element>(rhs);                                   \
+    }                                                                         \
+  };
+MORPH_TEST_OP(Erode, erode, cv::MORPH_ERODE)
+MORPH_TEST_OP(Dilate, dilate, cv::MORPH_DILATE)
+MORPH_TEST_OP(Open, morph_open, cv::MORPH_OPEN)
+MORPH_TEST_OP(Close, morph_close, cv::MORPH_CLOSE)
+MORPH_TEST_OP(Gradient, morph_gradient, cv::MORPH_GRADIENT)
+MORPH_TEST_OP(TopHat, top_hat, cv::MORPH_TOPHAT)
+MORPH_TEST_OP(BlackHat, black_hat, cv::MORPH_BLACKHAT)
+#undef MORPH_TEST_OP
+
+// compares the operation Op with the element Element with cv::morphologyEx
+template <typename Op, typename Element, size_t POLICY, typename QUEUE>
+void check_morphology(QUEUE &q, cv::Mat texture) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[cols * rows * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image. The default border of OpenCV never adds
+  // a value to the element, as the replicated border of visioncpp
+  cv::Mat ref;
+  cv::morphologyEx(texture, ref, Op::cv_op, CVElement<Element>::get());
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        texture.data);
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto assign_node =
+        visioncpp::assign(out, Op::template build<Element>(in));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify
+  verify_near(ref, ret_val, 0.0f);
+}
+
+// all the operations with the element Element
+template <typename Element, size_t POLICY, typename QUEUE>
+void check_element(QUEUE &q, cv::Mat texture) {
+  check_morphology<Erode, Element, POLICY>(q, texture);
+  check_morphology<Dilate, Element, POLICY>(q, texture);
+  check_morphology<Open, Element, POLICY>(q, texture);
+  check_morphology<Close, Element, POLICY>(q, texture);
+  check_morphology<Gradient, Element, POLICY>(q, texture);
+  check_morphology<TopHat, Element, POLICY>(q, texture);
+  check_morphology<BlackHat, Element, POLICY>(q, texture);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // 1) load in data. The frame is a smooth ramp, which the morphological
+  // operations barely change, so the first and last channels are replaced by
+  // a texture of bright and dark spots
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+  cv::Mat texture = frame.clone();
+  for (int r = 0; r < texture.rows; r++) {
+    for (int c = 0; c < texture.cols; c++) {
+      const unsigned int h =
+          (c * 73856093u) ^ (r * 19349663u) ^ (i * 83492791u);
+      texture.at<cv::Vec3b>(r, c)[0] = static_cast<unsigned char>(h >> 8);
+      texture.at<cv::Vec3b>(r, c)[2] =
+          static_cast<unsigned char>(((h >> 16) & 7) == 0 ? 255 : h & 63);
+    }
+  }
+
+  // the elements are not square, so a swap of their columns and rows fails
+  check_element<visioncpp::morph::Rect<2, 1>, POLICY>(q, texture);
+  check_element<visioncpp::morph::Cross<1, 2>, POLICY>(q, texture);
+}
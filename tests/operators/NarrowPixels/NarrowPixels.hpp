@@ -0,0 +1,128 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// blurs the narrow image of pixels PixelT holding the values with the 5x5
+// Gaussian and compares it with the Gaussian of OpenCV on the float values.
+// A narrow accumulator would overflow or round the values near the limits
+template <typename PixelT, size_t POLICY, typename QUEUE, typename T>
+void check_blur(QUEUE &q, std::shared_ptr<T> narrow, cv::Mat values) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  std::shared_ptr<float> ret_val(new float[cols * rows],
+                                 [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image. A sigma of 0 would make OpenCV use its
+  // table of binomial taps, so the DefaultGaussianSigma is given
+  cv::Mat ref;
+  cv::GaussianBlur(values, ref, cv::Size(5, 5), 1.1);
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<PixelT, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        narrow.get());
+    auto out = visioncpp::terminal<visioncpp::pixel::F32C1, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto blur_node = visioncpp::assign(
+        out, visioncpp::gaussian_blur<2, visioncpp::DefaultGaussianSigma<2>,
+                                      visioncpp::border::Reflect101>(in));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(blur_node, q);
+  }
+  // 5) verify. The float sums of values up to 2^16 keep 1/128 of a unit,
+  // and the taps are applied in another order than in OpenCV
+  verify_near(ref, ret_val, 0.1f);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // 1) load in data. The frame is replaced by hashed values close to the
+  // limits of each type: just below 65535 for unsigned short, around both
+  // limits for short, and between 60000 and 60224 for half, whose step is 32
+  // there
+  std::shared_ptr<unsigned short> u16(
+      new unsigned short[cols * rows],
+      [](unsigned short *dataMem) { delete[] dataMem; });
+  std::shared_ptr<short> s16(new short[cols * rows],
+                             [](short *dataMem) { delete[] dataMem; });
+  std::shared_ptr<cl::sycl::half> f16(
+      new cl::sycl::half[cols * rows],
+      [](cl::sycl::half *dataMem) { delete[] dataMem; });
+  cv::Mat u16_values(rows, cols, CV_32FC1);
+  cv::Mat s16_values(rows, cols, CV_32FC1);
+  cv::Mat f16_values(rows, cols, CV_32FC1);
+  cv::Mat doubled(rows, cols, CV_32FC1);
+  for (int r = 0; r < static_cast<int>(rows); r++) {
+    for (int c = 0; c < static_cast<int>(cols); c++) {
+      const unsigned int h =
+          (c * 73856093u) ^ (r * 19349663u) ^ (i * 83492791u);
+      const size_t k = r * cols + c;
+      u16.get()[k] = static_cast<unsigned short>(65535 - ((h >> 8) & 255));
+      s16.get()[k] = static_cast<short>(
+          (h & 1) ? 32767 - ((h >> 8) & 255) : -32768 + ((h >> 8) & 255));
+      const float half_value = 60000.0f + 32.0f * ((h >> 16) & 7);
+      f16.get()[k] = cl::sycl::half(half_value);
+      u16_values.at<float>(r, c) = u16.get()[k];
+      s16_values.at<float>(r, c) = s16.get()[k];
+      f16_values.at<float>(r, c) = half_value;
+      // the values of the scheduled intermediate go beyond short
+      doubled.at<float>(r, c) = 2.0f * s16.get()[k] + 0.25f * (h >> 24);
+    }
+  }
+  check_blur<visioncpp::pixel::U16C1, POLICY>(q, u16, u16_values);
+  check_blur<visioncpp::pixel::S16C1, POLICY>(q, s16, s16_values);
+  check_blur<visioncpp::pixel::F16C1, POLICY>(q, f16, f16_values);
+
+  // the intermediate result of a scheduled blur is stored as short, so it is
+  // rounded and saturated before the second blur reads it
+  std::shared_ptr<float> ret_val(new float[cols * rows],
+                                 [](float *dataMem) { delete[] dataMem; });
+  // 2) create gold_standard image
+  cv::Mat first, narrow, widened, ref;
+  cv::GaussianBlur(doubled, first, cv::Size(3, 3), 0.8);
+  first.convertTo(narrow, CV_16S);
+  narrow.convertTo(widened, CV_32F);
+  cv::GaussianBlur(widened, ref, cv::Size(5, 5), 1.1);
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::F32C1, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        reinterpret_cast<float *>(doubled.data));
+    auto out = visioncpp::terminal<visioncpp::pixel::F32C1, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto stored = visioncpp::schedule<POLICY, visioncpp::pixel::S16C1>(
+        visioncpp::gaussian_blur<1, visioncpp::DefaultGaussianSigma<1>,
+                                 visioncpp::border::Reflect101>(in));
+    auto blur_node = visioncpp::assign(
+        out, visioncpp::gaussian_blur<2, visioncpp::DefaultGaussianSigma<2>,
+                                      visioncpp::border::Reflect101>(stored));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(blur_node, q);
+  }
+  // 5) verify. The first blur may round a value halfway between two
+  // integers differently from OpenCV, which moves the result by less than
+  // the centre tap of the second blur
+  verify_near(ref, ret_val, 0.5f);
+}
@@ -0,0 +1,132 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// converts the float image to the 16 bit integer channel type T, compares it
+// with the saturated conversion of OpenCV and converts it back to float
+template <typename T, int CV_TYPE, typename NarrowOP, size_t POLICY,
+          typename QUEUE>
+void check_round_trip(QUEUE &q, cv::Mat values) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  std::shared_ptr<T> ret_narrow(new T[cols * rows * 3],
+                                [](T *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_float(new float[cols * rows * 3],
+                                   [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard images
+  cv::Mat ref_narrow, ref_float;
+  values.convertTo(ref_narrow, CV_TYPE);
+  ref_narrow.convertTo(ref_float, CV_32FC3);
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::F32C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        reinterpret_cast<float *>(values.data));
+    auto out_narrow = visioncpp::terminal<visioncpp::pixel::Storage<T, 3>,
+                                          cols, rows,
+                                          visioncpp::memory_type::Buffer2D>(
+        ret_narrow.get());
+
+    // 4) execute pipe
+    auto narrow_node = visioncpp::assign(
+        out_narrow, visioncpp::point_operation<NarrowOP>(in));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(narrow_node, q);
+  }
+  {
+    // the narrow image is read back from the host memory
+    auto in_narrow = visioncpp::terminal<visioncpp::pixel::Storage<T, 3>,
+                                         cols, rows,
+                                         visioncpp::memory_type::Buffer2D>(
+        ret_narrow.get());
+    auto out_float = visioncpp::terminal<visioncpp::pixel::F32C3, cols, rows,
+                                         visioncpp::memory_type::Buffer2D>(
+        ret_float.get());
+    auto widen_node = visioncpp::assign(
+        out_float,
+        visioncpp::point_operation<visioncpp::OP_ChannelConvert<float>>(
+            in_narrow));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(widen_node, q);
+  }
+  // 5) verify
+  verify_near(ref_narrow, ret_narrow, 0.0f);
+  verify_near(ref_float, ret_float, 0.0f);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+  cv::Mat scaled;
+  frame.convertTo(scaled, CV_32FC3, 1.0 / 255.0);
+
+  // the first channel is outside of short on both sides, the second one is
+  // inside of short and goes below unsigned short, and the third one goes
+  // above short but stays inside of unsigned short. No value is halfway
+  // between two integers, where OpenCV rounds to even
+  cv::Mat values(rows, cols, CV_32FC3);
+  for (int r = 0; r < values.rows; r++) {
+    for (int c = 0; c < values.cols; c++) {
+      values.at<cv::Vec3f>(r, c) =
+          cv::Vec3f((c % 2) ? 40000.0f : -40000.0f,
+                    (c - 128) * 100.25f + r * 0.25f + 0.1f,
+                    (r == 0) ? -1.0f : r * 255.25f + 0.1f);
+    }
+  }
+  check_round_trip<short, CV_16SC3, visioncpp::OP_F32ToS16, POLICY>(q, values);
+  check_round_trip<unsigned short, CV_16UC3, visioncpp::OP_F32ToU16, POLICY>(
+      q, values);
+
+  // the half round trip keeps 11 significant bits of the values in [0, 1]
+  std::shared_ptr<cl::sycl::half> ret_half(
+      new cl::sycl::half[cols * rows * 3],
+      [](cl::sycl::half *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_float(new float[cols * rows * 3],
+                                   [](float *dataMem) { delete[] dataMem; });
+  {
+    // 3) define graph
+    auto out_half = visioncpp::terminal<visioncpp::pixel::F16C3, cols, rows,
+                                        visioncpp::memory_type::Buffer2D>(
+        ret_half.get());
+    // 4) execute pipe
+    auto half_node = visioncpp::assign(
+        out_half, visioncpp::point_operation<visioncpp::OP_F32ToF16>(
+                      visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(
+                          data)));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(half_node, q);
+  }
+  {
+    auto in_half = visioncpp::terminal<visioncpp::pixel::F16C3, cols, rows,
+                                       visioncpp::memory_type::Buffer2D>(
+        ret_half.get());
+    auto out_float = visioncpp::terminal<visioncpp::pixel::F32C3, cols, rows,
+                                         visioncpp::memory_type::Buffer2D>(
+        ret_float.get());
+    auto float_node = visioncpp::assign(
+        out_float, visioncpp::point_operation<visioncpp::OP_F16ToF32>(in_half));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(float_node, q);
+  }
+  // 5) verify
+  verify_near(scaled, ret_float, 1e-3f);
+}
@@ -0,0 +1,104 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  constexpr size_t radius = 2;
+  using Border = visioncpp::border::Reflect101;
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+
+  std::shared_ptr<unsigned char> ret_default(
+      new unsigned char[rows * cols * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  std::shared_ptr<unsigned char> ret_sigma(
+      new unsigned char[rows * cols * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_float(new float[rows * cols],
+                                   [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_taps(new float[rows * cols],
+                                  [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard images. OpenCV reflects the border without the
+  // edge pixel by default, and a sigma of 0 is the DefaultGaussianSigma
+  cv::Mat ref_default, ref_sigma, scaled, grey, ref_float, ref_taps;
+  cv::GaussianBlur(frame, ref_default, cv::Size(5, 5), 0);
+  cv::GaussianBlur(frame, ref_sigma, cv::Size(5, 5), 1.5);
+  frame.convertTo(scaled, CV_32FC3, 1.0 / 255.0);
+  cv::transform(scaled, grey, cv::Matx13f(0.299f, 0.587f, 0.114f));
+  cv::GaussianBlur(grey, ref_float, cv::Size(5, 5), 0);
+  cv::GaussianBlur(grey, ref_taps, cv::Size(5, 5), 2.5);
+
+  {
+    // 3) define graph
+    auto out_default = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                           visioncpp::memory_type::Buffer2D>(
+        ret_default.get());
+    auto out_sigma = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                         visioncpp::memory_type::Buffer2D>(
+        ret_sigma.get());
+    auto out_float = visioncpp::terminal<float, cols, rows,
+                                         visioncpp::memory_type::Buffer2D>(
+        ret_float.get());
+    auto out_taps = visioncpp::terminal<float, cols, rows,
+                                        visioncpp::memory_type::Buffer2D>(
+        ret_taps.get());
+
+    // the unsigned char image with the default and an explicit sigma
+    auto blur_default = visioncpp::gaussian_blur<
+        radius, visioncpp::DefaultGaussianSigma<radius>, Border>(data);
+    auto blur_sigma =
+        visioncpp::gaussian_blur<radius, std::ratio<3, 2>, Border>(data);
+
+    // the float image with the default sigma and with the taps of a sigma
+    // given at run time
+    auto grey_node = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+        visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(data));
+    auto blur_float = visioncpp::gaussian_blur<
+        radius, visioncpp::DefaultGaussianSigma<radius>, Border>(grey_node);
+    float taps[radius + 1];
+    visioncpp::gaussian_taps<radius>(2.5f, taps);
+    auto taps_node =
+        visioncpp::terminal<float, radius + 1, 1,
+                            visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(taps);
+    auto blur_taps =
+        visioncpp::gaussian_blur<radius, Border>(grey_node, taps_node);
+
+    // 4) execute pipe
+    auto assign_default = visioncpp::assign(out_default, blur_default);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_default, q);
+    auto assign_sigma = visioncpp::assign(out_sigma, blur_sigma);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_sigma, q);
+    auto assign_float = visioncpp::assign(out_float, blur_float);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_float, q);
+    auto assign_taps = visioncpp::assign(out_taps, blur_taps);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_taps, q);
+  }
+  // 5) verify, the unsigned char passes are rounded once each
+  verify(ref_default, ret_default);
+  verify(ref_sigma, ret_sigma);
+  verify_near(ref_float, ret_float, 1e-4f);
+  verify_near(ref_taps, ret_taps, 1e-4f);
+}
@@ -0,0 +1,57 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  cv::Mat ref;
+  // 1) load in data
+  cv::Mat frame(common::singleton::DataSet::Instance().m_height,
+                common::singleton::DataSet::Instance().m_width, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[common::singleton::DataSet::Instance().m_height *
+                        common::singleton::DataSet::Instance().m_width * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image, medianBlur replicates the border
+  cv::medianBlur(frame, ref, 7);
+
+  {
+    // 3) define graph
+    auto return_node = visioncpp::terminal<
+        visioncpp::pixel::U8C3, common::singleton::DataSet::m_width,
+        common::singleton::DataSet::m_height, visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+
+    // the histogram median of a 7x7 window, each channel being filtered
+    // separately
+    auto node =
+        visioncpp::neighbour_operation<visioncpp::OP_MedianHist<3>>(data);
+
+    // assign data from node to return_node
+    auto assign_node = visioncpp::assign(return_node, node);
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify
+  verify(ref, ret_val);
+}
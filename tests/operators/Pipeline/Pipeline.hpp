@@ -0,0 +1,107 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// executes the three stages of the pipeline one by one on the frame
+template <size_t POLICY, typename QUEUE>
+void run_stages(QUEUE &q, unsigned char *frame_ptr,
+                std::shared_ptr<float> ret_val) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  std::shared_ptr<float> grey(new float[rows * cols],
+                              [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> blur(new float[rows * cols],
+                              [](float *dataMem) { delete[] dataMem; });
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                visioncpp::memory_type::Buffer2D>(frame_ptr);
+  auto grey_node = visioncpp::terminal<float, cols, rows,
+                                       visioncpp::memory_type::Buffer2D>(
+      grey.get());
+  auto blur_node = visioncpp::terminal<float, cols, rows,
+                                       visioncpp::memory_type::Buffer2D>(
+      blur.get());
+  auto out = visioncpp::terminal<float, cols, rows,
+                                 visioncpp::memory_type::Buffer2D>(
+      ret_val.get());
+  auto grey_stage = visioncpp::assign(
+      grey_node,
+      visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+          visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in)));
+  visioncpp::execute<POLICY, 16, 16, 8, 8>(grey_stage, q);
+  auto blur_stage =
+      visioncpp::assign(blur_node, visioncpp::gaussian_blur<1>(grey_node));
+  visioncpp::execute<POLICY, 16, 16, 8, 8>(blur_stage, q);
+  auto out_stage =
+      visioncpp::assign(out, visioncpp::gaussian_blur<2>(blur_node));
+  visioncpp::execute<POLICY, 16, 16, 8, 8>(out_stage, q);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  const int j = (i + 1) % common::singleton::DataSet::m_depth;
+  // 1) load in data
+  unsigned char *frame_ptr =
+      common::singleton::DataSet::Instance().m_data[i].get();
+  unsigned char *next_ptr =
+      common::singleton::DataSet::Instance().m_data[j].get();
+
+  std::shared_ptr<float> ret_val(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ret_next(new float[rows * cols],
+                                  [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ref_val(new float[rows * cols],
+                                 [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<float> ref_next(new float[rows * cols],
+                                  [](float *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image: each stage executed on its own
+  run_stages<POLICY>(q, frame_ptr, ref_val);
+  run_stages<POLICY>(q, next_ptr, ref_next);
+
+  {
+    // 3) define the pipeline. The stages are scheduled, so the pipeline owns
+    // the intermediate memories between them under both policies
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(frame_ptr);
+    auto out = visioncpp::terminal<float, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>();
+    auto grey = visioncpp::schedule<POLICY>(
+        visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+            visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in)));
+    auto blur = visioncpp::schedule<POLICY>(visioncpp::gaussian_blur<1>(grey));
+    auto pipe = visioncpp::make_pipeline<POLICY, 16, 16, 8, 8>(
+        visioncpp::assign(out, visioncpp::gaussian_blur<2>(blur)), q,
+        visioncpp::inputs(in), visioncpp::outputs(out));
+    // 4) run the pipeline on two frames, the second run reuses the memories
+    // of the first one
+    pipe.run(frame_ptr, ret_val.get());
+    const size_t intermediates = pipe.intermediate_count();
+    EXPECT_LE(2u, intermediates);
+    pipe.run(next_ptr, ret_next.get());
+    EXPECT_EQ(intermediates, pipe.intermediate_count());
+  }
+  // 5) verify
+  cv::Mat ref(rows, cols, CV_32FC1, ref_val.get());
+  cv::Mat ref_second(rows, cols, CV_32FC1, ref_next.get());
+  verify_near(ref, ret_val, 0.0f);
+  verify_near(ref_second, ret_next, 0.0f);
+}
@@ -0,0 +1,80 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  const int j = (i + 1) % common::singleton::DataSet::m_depth;
+  const int k = (i + 2) % common::singleton::DataSet::m_depth;
+  unsigned char *frame_ptr =
+      common::singleton::DataSet::Instance().m_data[i].get();
+  unsigned char *next_ptr =
+      common::singleton::DataSet::Instance().m_data[j].get();
+  unsigned char *third_ptr =
+      common::singleton::DataSet::Instance().m_data[k].get();
+  cv::Mat ref, ref_next, ref_third;
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3, frame_ptr);
+  cv::Mat next(rows, cols, CV_8UC3, next_ptr);
+  cv::Mat third(rows, cols, CV_8UC3, third_ptr);
+
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[rows * cols * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  std::shared_ptr<unsigned char> ret_next(
+      new unsigned char[rows * cols * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  std::shared_ptr<unsigned char> ret_third(
+      new unsigned char[rows * cols * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image
+  cvtColor(frame, ref, CV_BGR2RGB);
+  cvtColor(next, ref_next, CV_BGR2RGB);
+  cvtColor(third, ref_third, CV_BGR2RGB);
+
+  {
+    // 3) define the pipeline
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(frame_ptr);
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>();
+    auto node = visioncpp::point_operation<visioncpp::OP_BGRToRGB>(in);
+    auto pipe = visioncpp::make_pipeline<POLICY, 16, 16, 8, 8>(
+        visioncpp::assign(out, node), q, visioncpp::inputs(in),
+        visioncpp::outputs(out));
+    // 4) the second frame is launched before the first one is waited for and
+    // uses the other slot. The third one reuses the slot of the first one,
+    // so it waits for it. Each frame must still reach its own output
+    EXPECT_EQ(2u, pipe.in_flight());
+    auto done = pipe.run_async(frame_ptr, ret_val.get());
+    auto done_next = pipe.run_async(next_ptr, ret_next.get());
+    auto done_third = pipe.run_async(third_ptr, ret_third.get());
+    done_third.wait();
+    done_next.wait();
+    done.wait();
+  }
+  // 5) verify
+  verify(ref, ret_val);
+  verify(ref_next, ret_next);
+  verify(ref_third, ret_third);
+}
@@ -0,0 +1,84 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // 1) load in data. Each channel is a different hashed texture, so a
+  // channel read from the wrong plane or pixel is seen
+  cv::Mat texture(rows, cols, CV_8UC3);
+  for (int r = 0; r < texture.rows; r++) {
+    for (int c = 0; c < texture.cols; c++) {
+      const unsigned int h =
+          (c * 73856093u) ^ (r * 19349663u) ^ (i * 83492791u);
+      texture.at<cv::Vec3b>(r, c) =
+          cv::Vec3b(static_cast<unsigned char>(h >> 8),
+                    static_cast<unsigned char>(h >> 16),
+                    static_cast<unsigned char>(h >> 24));
+    }
+  }
+  std::shared_ptr<unsigned char> planar_val(
+      new unsigned char[cols * rows * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[cols * rows * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image: the planes of cv::split one below the
+  // other
+  std::vector<cv::Mat> planes;
+  cv::split(texture, planes);
+  cv::Mat planar_ref;
+  cv::vconcat(planes, planar_ref);
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        texture.data);
+    auto planar =
+        visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                            visioncpp::memory_type::Buffer2D,
+                            visioncpp::layout::Planar>(planar_val.get());
+    auto to_planar_node = visioncpp::assign(planar, visioncpp::to_planar(in));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(to_planar_node, q);
+  }
+  {
+    // 3) define graph: the planar image written above is read back
+    auto planar =
+        visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                            visioncpp::memory_type::Buffer2D,
+                            visioncpp::layout::Planar>(planar_val.get());
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto from_planar_node =
+        visioncpp::assign(out, visioncpp::from_planar<3>(planar));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(from_planar_node, q);
+  }
+  // 5) verify: the planar image matches cv::split, and the round trip from
+  // interleaved to planar to interleaved gives the texture back
+  verify_near(planar_ref, planar_val, 0.0f);
+  verify_near(texture, ret_val, 0.0f);
+}
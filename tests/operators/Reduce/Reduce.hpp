@@ -0,0 +1,154 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// the tolerance of a float reduction is relative to the reduced value
+inline float reduce_tolerance(double expected) {
+  return static_cast<float>(1e-4 * std::max(1.0, std::abs(expected)));
+}
+
+// compares the reductions of a float grey image with OpenCV
+template <size_t COLS, size_t ROWS, size_t POLICY, typename QUEUE>
+void check_grey_reductions(QUEUE &q, cv::Mat grey) {
+  float sum[1], mean[1], min[1], max[1], argmax[3], mean_stddev[2];
+  // 2) create gold_standard values
+  double ref_min, ref_max;
+  cv::Point ref_min_loc, ref_max_loc;
+  cv::minMaxLoc(grey, &ref_min, &ref_max, &ref_min_loc, &ref_max_loc);
+  cv::Scalar ref_mean, ref_stddev;
+  cv::meanStdDev(grey, ref_mean, ref_stddev);
+  const double ref_sum = cv::sum(grey)[0];
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<float, COLS, ROWS,
+                                  visioncpp::memory_type::Buffer2D>(
+        reinterpret_cast<float *>(grey.data));
+    auto out_sum =
+        visioncpp::terminal<float, 1, 1, visioncpp::memory_type::Buffer2D>(
+            sum);
+    auto out_mean =
+        visioncpp::terminal<float, 1, 1, visioncpp::memory_type::Buffer2D>(
+            mean);
+    auto out_min =
+        visioncpp::terminal<float, 1, 1, visioncpp::memory_type::Buffer2D>(
+            min);
+    auto out_max =
+        visioncpp::terminal<float, 1, 1, visioncpp::memory_type::Buffer2D>(
+            max);
+    auto out_argmax =
+        visioncpp::terminal<visioncpp::pixel::F32C3, 1, 1,
+                            visioncpp::memory_type::Buffer2D>(argmax);
+    auto out_mean_stddev =
+        visioncpp::terminal<visioncpp::pixel::F32C2, 1, 1,
+                            visioncpp::memory_type::Buffer2D>(mean_stddev);
+
+    // 4) execute pipe
+    auto assign_sum = visioncpp::assign(out_sum, visioncpp::reduce_sum(in));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_sum, q);
+    auto assign_mean = visioncpp::assign(out_mean, visioncpp::reduce_mean(in));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_mean, q);
+    auto assign_min = visioncpp::assign(out_min, visioncpp::reduce_min(in));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_min, q);
+    auto assign_max = visioncpp::assign(out_max, visioncpp::reduce_max(in));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_max, q);
+    auto assign_argmax =
+        visioncpp::assign(out_argmax, visioncpp::reduce_argmax(in));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_argmax, q);
+    auto assign_mean_stddev =
+        visioncpp::assign(out_mean_stddev, visioncpp::mean_stddev(in));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_mean_stddev, q);
+  }
+  // 5) verify
+  EXPECT_NEAR(ref_sum, sum[0], reduce_tolerance(ref_sum)) << COLS << "x"
+                                                          << ROWS;
+  EXPECT_NEAR(ref_mean[0], mean[0], reduce_tolerance(ref_mean[0]));
+  EXPECT_EQ(static_cast<float>(ref_min), min[0]);
+  EXPECT_EQ(static_cast<float>(ref_max), max[0]);
+  EXPECT_EQ(static_cast<float>(ref_max), argmax[0]);
+  EXPECT_EQ(ref_max_loc.x, static_cast<int>(argmax[1]));
+  EXPECT_EQ(ref_max_loc.y, static_cast<int>(argmax[2]));
+  EXPECT_NEAR(ref_mean[0], mean_stddev[0], reduce_tolerance(ref_mean[0]));
+  EXPECT_NEAR(ref_stddev[0], mean_stddev[1], 1e-3);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // 1) load in data
+  cv::Mat frame(rows, cols, CV_8UC3,
+                common::singleton::DataSet::Instance().m_data[i].get());
+  cv::Mat scaled, grey;
+  frame.convertTo(scaled, CV_32FC3, 1.0 / 255.0);
+  cv::transform(scaled, grey, cv::Matx13f(0.299f, 0.587f, 0.114f));
+
+  // the whole frame has more pixels than partial values, 37x23 has fewer and
+  // 100x41 has more without being a multiple of them. The two crops are not
+  // multiples of the workgroup size either
+  check_grey_reductions<cols, rows, POLICY>(q, grey);
+  check_grey_reductions<37, 23, POLICY>(
+      q, grey(cv::Rect(0, 0, 37, 23)).clone());
+  check_grey_reductions<100, 41, POLICY>(
+      q, grey(cv::Rect(0, 0, 100, 41)).clone());
+
+  // the channel by channel reductions of the colour frame
+  float sum[3], mean[3];
+  unsigned char min[3], max[3];
+  {
+    // 3) define graph
+    auto out_sum = visioncpp::terminal<visioncpp::pixel::F32C3, 1, 1,
+                                       visioncpp::memory_type::Buffer2D>(sum);
+    auto out_mean = visioncpp::terminal<visioncpp::pixel::F32C3, 1, 1,
+                                        visioncpp::memory_type::Buffer2D>(mean);
+    auto out_min = visioncpp::terminal<visioncpp::pixel::U8C3, 1, 1,
+                                       visioncpp::memory_type::Buffer2D>(min);
+    auto out_max = visioncpp::terminal<visioncpp::pixel::U8C3, 1, 1,
+                                       visioncpp::memory_type::Buffer2D>(max);
+    auto float_node =
+        visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(data);
+
+    // 4) execute pipe
+    auto assign_sum =
+        visioncpp::assign(out_sum, visioncpp::reduce_sum(float_node));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_sum, q);
+    auto assign_mean =
+        visioncpp::assign(out_mean, visioncpp::reduce_mean(float_node));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_mean, q);
+    auto assign_min = visioncpp::assign(out_min, visioncpp::reduce_min(data));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_min, q);
+    auto assign_max = visioncpp::assign(out_max, visioncpp::reduce_max(data));
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_max, q);
+  }
+  // 5) verify
+  const cv::Scalar ref_sum = cv::sum(scaled);
+  const cv::Scalar ref_mean = cv::mean(scaled);
+  std::vector<cv::Mat> channels;
+  cv::split(frame, channels);
+  for (int c = 0; c < 3; c++) {
+    double ref_min, ref_max;
+    cv::minMaxLoc(channels[c], &ref_min, &ref_max);
+    EXPECT_NEAR(ref_sum[c], sum[c], reduce_tolerance(ref_sum[c]))
+        << "channel: " << c;
+    EXPECT_NEAR(ref_mean[c], mean[c], reduce_tolerance(ref_mean[c]))
+        << "channel: " << c;
+    EXPECT_EQ(static_cast<int>(ref_min), min[c]) << "channel: " << c;
+    EXPECT_EQ(static_cast<int>(ref_max), max[c]) << "channel: " << c;
+  }
+}
@@ -0,0 +1,95 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// compares the resize of the texture to COLS x ROWS with cv::resize, the
+// pixels being at most tolerance apart
+template <size_t COLS, size_t ROWS, typename Interp, size_t POLICY,
+          typename QUEUE>
+void check_resize(QUEUE &q, cv::Mat texture, int cv_interp, float tolerance) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[COLS * ROWS * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image
+  cv::Mat ref;
+  cv::resize(texture, ref, cv::Size(COLS, ROWS), 0, 0, cv_interp);
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        texture.data);
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto assign_node =
+        visioncpp::assign(out, visioncpp::resize<COLS, ROWS, Interp>(in));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify
+  verify_near(ref, ret_val, tolerance);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // 1) load in data. The frame is a smooth ramp, which any interpolation
+  // reproduces, so each channel is replaced by a hashed texture
+  cv::Mat texture(rows, cols, CV_8UC3);
+  for (int r = 0; r < texture.rows; r++) {
+    for (int c = 0; c < texture.cols; c++) {
+      const unsigned int h =
+          (c * 73856093u) ^ (r * 19349663u) ^ (i * 83492791u);
+      texture.at<cv::Vec3b>(r, c) =
+          cv::Vec3b(static_cast<unsigned char>(h >> 8),
+                    static_cast<unsigned char>(h >> 16),
+                    static_cast<unsigned char>(h >> 24));
+    }
+  }
+
+  // the scales are powers of two, so the float positions of the nodes are
+  // the double positions of OpenCV. 128x128 halves the frame and 512x64
+  // doubles the columns and divides the rows by four. The nearest pixels
+  // are exact. OpenCV interpolates 8 bit images with fixed point weights,
+  // rounded once for the bilinear and the area, and per pass for the 16
+  // weights of the bicubic
+  check_resize<128, 128, visioncpp::interpolation::Nearest, POLICY>(
+      q, texture, cv::INTER_NEAREST, 0.0f);
+  check_resize<512, 64, visioncpp::interpolation::Nearest, POLICY>(
+      q, texture, cv::INTER_NEAREST, 0.0f);
+  check_resize<128, 128, visioncpp::interpolation::Bilinear, POLICY>(
+      q, texture, cv::INTER_LINEAR, 1.0f);
+  check_resize<512, 64, visioncpp::interpolation::Bilinear, POLICY>(
+      q, texture, cv::INTER_LINEAR, 1.0f);
+  check_resize<128, 128, visioncpp::interpolation::Bicubic, POLICY>(
+      q, texture, cv::INTER_CUBIC, 2.0f);
+  check_resize<512, 64, visioncpp::interpolation::Bicubic, POLICY>(
+      q, texture, cv::INTER_CUBIC, 2.0f);
+  // OpenCV only averages the covered area when the image is shrunk
+  check_resize<128, 128, visioncpp::interpolation::Area, POLICY>(
+      q, texture, cv::INTER_AREA, 1.0f);
+  check_resize<128, 64, visioncpp::interpolation::Area, POLICY>(
+      q, texture, cv::INTER_AREA, 1.0f);
+}
@@ -0,0 +1,98 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// the image is 250 columns wide, which is not a multiple of the vector width
+// of any device, so the last columns of each row are evaluated one by one
+constexpr size_t vector_cols = 250;
+constexpr size_t vector_rows = 64;
+
+// converts the texture to grey and back and forth to float with the tile
+// LC x LR and the workgroup LCT x LRT
+template <size_t POLICY, size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename QUEUE>
+void run_point_ops(QUEUE &q, cv::Mat texture, std::shared_ptr<float> grey,
+                   std::shared_ptr<unsigned char> round_trip) {
+  auto in = visioncpp::terminal<visioncpp::pixel::U8C3, vector_cols,
+                                vector_rows, visioncpp::memory_type::Buffer2D>(
+      texture.data);
+  auto grey_out =
+      visioncpp::terminal<float, vector_cols, vector_rows,
+                          visioncpp::memory_type::Buffer2D>(grey.get());
+  auto round_trip_out =
+      visioncpp::terminal<visioncpp::pixel::U8C3, vector_cols, vector_rows,
+                          visioncpp::memory_type::Buffer2D>(round_trip.get());
+  auto grey_node = visioncpp::assign(
+      grey_out, visioncpp::point_operation<visioncpp::OP_RGBToGREY>(
+                    visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in)));
+  visioncpp::execute<POLICY, LC, LR, LCT, LRT>(grey_node, q);
+  auto round_trip_node = visioncpp::assign(
+      round_trip_out,
+      visioncpp::point_operation<visioncpp::OP_F32C3ToU8C3>(
+          visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in)));
+  visioncpp::execute<POLICY, LC, LR, LCT, LRT>(round_trip_node, q);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t pixels = vector_cols * vector_rows;
+  // 1) load in data
+  cv::Mat texture(vector_rows, vector_cols, CV_8UC3);
+  for (int r = 0; r < texture.rows; r++) {
+    for (int c = 0; c < texture.cols; c++) {
+      const unsigned int h =
+          (c * 73856093u) ^ (r * 19349663u) ^ (i * 83492791u);
+      texture.at<cv::Vec3b>(r, c) =
+          cv::Vec3b(static_cast<unsigned char>(h >> 8),
+                    static_cast<unsigned char>(h >> 16),
+                    static_cast<unsigned char>(h >> 24));
+    }
+  }
+  std::shared_ptr<float> grey_scalar(
+      new float[pixels], [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<unsigned char> round_trip_scalar(
+      new unsigned char[pixels * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+
+  // 2) create gold_standard image: the 18 columns of the tile are not made
+  // of whole vectors, so each column is evaluated by the scalar loop
+  run_point_ops<POLICY, 18, 16, 6, 8>(q, texture, grey_scalar,
+                                      round_trip_scalar);
+  cv::Mat grey_ref(vector_rows, vector_cols, CV_32FC1, grey_scalar.get());
+  cv::Mat round_trip_ref(vector_rows, vector_cols, CV_8UC3,
+                         round_trip_scalar.get());
+
+  // 3) define graph and 4) execute pipe: with 16 and 32 columns per tile, the
+  // columns are evaluated in vectors on the devices with a vector width. The
+  // 16 columns of 8 threads leave some of the threads without a vector
+  std::shared_ptr<float> grey_val(new float[pixels],
+                                  [](float *dataMem) { delete[] dataMem; });
+  std::shared_ptr<unsigned char> round_trip_val(
+      new unsigned char[pixels * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  run_point_ops<POLICY, 16, 16, 8, 8>(q, texture, grey_val, round_trip_val);
+  // 5) verify: the vectors compute the same bits as the scalar loop
+  verify_near(grey_ref, grey_val, 0.0f);
+  verify_near(round_trip_ref, round_trip_val, 0.0f);
+
+  run_point_ops<POLICY, 32, 8, 8, 8>(q, texture, grey_val, round_trip_val);
+  verify_near(grey_ref, grey_val, 0.0f);
+  verify_near(round_trip_ref, round_trip_val, 0.0f);
+}
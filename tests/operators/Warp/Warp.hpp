@@ -0,0 +1,193 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// compares the affine warp of the texture by the inverse map m with
+// cv::warpAffine
+template <typename Interp, size_t POLICY, typename QUEUE>
+void check_warp_affine(QUEUE &q, cv::Mat texture, const float (&m)[6],
+                       int cv_interp) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[cols * rows * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  float transform[6];
+  std::copy(m, m + 6, transform);
+
+  // 2) create gold_standard image
+  cv::Mat ref;
+  cv::warpAffine(texture, ref, cv::Mat(2, 3, CV_32F, transform),
+                 cv::Size(cols, rows), cv_interp | cv::WARP_INVERSE_MAP,
+                 cv::BORDER_CONSTANT, cv::Scalar::all(0));
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        texture.data);
+    auto transform_node =
+        visioncpp::terminal<float, 3, 2, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(transform);
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto assign_node = visioncpp::assign(
+        out, visioncpp::warp_affine<cols, rows, Interp>(in, transform_node));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify. OpenCV interpolates 8 bit images with fixed point weights, so
+  // the results may differ by one
+  verify_near(ref, ret_val, 1.0f);
+}
+
+// compares the perspective warp of the texture by the inverse map m with
+// cv::warpPerspective
+template <typename Interp, size_t POLICY, typename QUEUE>
+void check_warp_perspective(QUEUE &q, cv::Mat texture, const float (&m)[9],
+                            int cv_interp) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[cols * rows * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  float transform[9];
+  std::copy(m, m + 9, transform);
+
+  // 2) create gold_standard image
+  cv::Mat ref;
+  cv::warpPerspective(texture, ref, cv::Mat(3, 3, CV_32F, transform),
+                      cv::Size(cols, rows), cv_interp | cv::WARP_INVERSE_MAP,
+                      cv::BORDER_CONSTANT, cv::Scalar::all(0));
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        texture.data);
+    auto transform_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(transform);
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto assign_node = visioncpp::assign(
+        out,
+        visioncpp::warp_perspective<cols, rows, Interp>(in, transform_node));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify
+  verify_near(ref, ret_val, 1.0f);
+}
+
+// compares the remap of the texture by the affine map m with cv::remap
+template <typename Interp, size_t POLICY, typename QUEUE>
+void check_remap(QUEUE &q, cv::Mat texture, const float (&m)[6],
+                 int cv_interp) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  std::shared_ptr<unsigned char> ret_val(
+      new unsigned char[cols * rows * 3],
+      [](unsigned char *dataMem) { delete[] dataMem; });
+  cv::Mat map(rows, cols, CV_32FC2);
+  for (int r = 0; r < map.rows; r++) {
+    for (int c = 0; c < map.cols; c++) {
+      map.at<cv::Vec2f>(r, c) =
+          cv::Vec2f(m[0] * c + m[1] * r + m[2], m[3] * c + m[4] * r + m[5]);
+    }
+  }
+
+  // 2) create gold_standard image
+  cv::Mat ref;
+  cv::remap(texture, ref, map, cv::Mat(), cv_interp, cv::BORDER_CONSTANT,
+            cv::Scalar::all(0));
+
+  {
+    // 3) define graph
+    auto in = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                  visioncpp::memory_type::Buffer2D>(
+        texture.data);
+    auto map_node = visioncpp::terminal<visioncpp::pixel::F32C2, cols, rows,
+                                        visioncpp::memory_type::Buffer2D>(
+        reinterpret_cast<float *>(map.data));
+    auto out = visioncpp::terminal<visioncpp::pixel::U8C3, cols, rows,
+                                   visioncpp::memory_type::Buffer2D>(
+        ret_val.get());
+    auto assign_node =
+        visioncpp::assign(out, visioncpp::remap<Interp>(in, map_node));
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify
+  verify_near(ref, ret_val, 1.0f);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t cols = common::singleton::DataSet::m_width;
+  constexpr size_t rows = common::singleton::DataSet::m_height;
+  // 1) load in data. The frame is a smooth ramp, which hides a sample taken
+  // at the wrong position, so each channel is replaced by a hashed texture
+  cv::Mat texture(rows, cols, CV_8UC3);
+  for (int r = 0; r < texture.rows; r++) {
+    for (int c = 0; c < texture.cols; c++) {
+      const unsigned int h =
+          (c * 73856093u) ^ (r * 19349663u) ^ (i * 83492791u);
+      texture.at<cv::Vec3b>(r, c) =
+          cv::Vec3b(static_cast<unsigned char>(h >> 8),
+                    static_cast<unsigned char>(h >> 16),
+                    static_cast<unsigned char>(h >> 24));
+    }
+  }
+
+  // OpenCV quantises the positions to 1/32 of a pixel, which changes the
+  // sample of a texture, so the coefficients are chosen for the positions
+  // to be exact multiples of 1/8 of a pixel. The perspective warp and the
+  // remap of OpenCV round the ties of the nearest pixel to even rather than
+  // up, so their positions are never halfway between two pixels.
+  // a shift by a quarter of a pixel, which moves part of the output outside
+  // of the input
+  const float shift[6] = {1.0f, 0.0f, 20.25f, 0.0f, 1.0f, -30.25f};
+  // a zoom by 2 with a rotation, which stays inside of the input
+  const float rotate[6] = {0.5f, -0.25f, 100.0f, 0.25f, 0.5f, 30.0f};
+  // a transform through the homogeneous coordinates, which moves part of
+  // the output outside of the input
+  const float homography[9] = {1.0f,  0.5f, 20.25f, -0.5f, 1.0f,
+                               60.25f, 0.0f, 0.0f,   2.0f};
+
+  check_warp_affine<visioncpp::interpolation::Nearest, POLICY>(
+      q, texture, shift, cv::INTER_NEAREST);
+  check_warp_affine<visioncpp::interpolation::Bilinear, POLICY>(
+      q, texture, shift, cv::INTER_LINEAR);
+  check_warp_affine<visioncpp::interpolation::Nearest, POLICY>(
+      q, texture, rotate, cv::INTER_NEAREST);
+  check_warp_affine<visioncpp::interpolation::Bilinear, POLICY>(
+      q, texture, rotate, cv::INTER_LINEAR);
+  check_warp_perspective<visioncpp::interpolation::Bilinear, POLICY>(
+      q, texture, homography, cv::INTER_LINEAR);
+  check_warp_perspective<visioncpp::interpolation::Nearest, POLICY>(
+      q, texture, homography, cv::INTER_NEAREST);
+  check_remap<visioncpp::interpolation::Nearest, POLICY>(q, texture, shift,
+                                                         cv::INTER_NEAREST);
+  check_remap<visioncpp::interpolation::Bilinear, POLICY>(q, texture, shift,
+                                                          cv::INTER_LINEAR);
+}
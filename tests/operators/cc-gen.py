@@ -36,8 +36,8 @@ def main():
     # read it
     templatesrc = Template( templatein.read() )
 
-    # define targets
-    targets = [ "cpu", "gpu" ]
+    # define targets as pairs of backend and device
+    targets = [ ("sycl", "cpu"), ("sycl", "gpu"), ("native", "cpu") ]
     storages = [ "Buffer2D" ]
     executions = [ "Fuse", "NoFuse" ]
 
@@ -46,17 +46,18 @@ def main():
       # for each folder
       for name in dirs:
         # for each target
-        for target in targets:
+        for backend, target in targets:
           # for each storage
           for storage in storages:
             # for each execution policy
             for execution in executions:
-                d={ 'test_name':name, 'test_target':target,
+                d={ 'test_name':name, 'test_backend':backend,
+                'test_target':target,
                 'test_storage': storage, 'test_execution':execution,
                 'test_dir' : args.testdir[0] }
                 # replace
                 result = templatesrc.substitute(d)
-                s = [args.builddir[0],'autogen/'+ name +'/'+ name.upper()+'_'+storage.upper()+'_'+ target.upper() +'_'+execution.upper()+'.cpp']
+                s = [args.builddir[0],'autogen/'+ name +'/'+ name.upper()+'_'+storage.upper()+'_'+ backend.upper()+'_'+ target.upper() +'_'+execution.upper()+'.cpp']
                 path = os.path.join('',*s)
                 print(path)
                 os.makedirs(os.path.dirname(path), exist_ok=True)